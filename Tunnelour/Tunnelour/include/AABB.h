@@ -0,0 +1,221 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_AABB_H_
+#define TUNNELOUR_AABB_H_
+
+#include <d3dx10math.h>
+#include "Fixed_Pixel.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : AABB is the axis aligned bounds of a tile or collision
+//                block in world coordinates (y is up). It is a plain value
+//                so collision tests can be made without creating bitmaps.
+//                The edges are in fixed pixels so the tests are exact
+//                integer compares. The tests match the ones Bitmap_Helper
+//                has always made on bitmaps, edges which only touch count as
+//                colliding.
+//-----------------------------------------------------------------------------
+struct AABB {
+  AABB() : left(0), right(0), bottom(0), top(0) {
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Constructor, the edges are in pixels and are rounded to
+  //               the nearest fixed pixel.
+  //---------------------------------------------------------------------------
+  AABB(float left_x, float right_x, float bottom_y, float top_y) : left(Fixed_Pixel_Helper::FromPixels(left_x)),
+                                                                    right(Fixed_Pixel_Helper::FromPixels(right_x)),
+                                                                    bottom(Fixed_Pixel_Helper::FromPixels(bottom_y)),
+                                                                    top(Fixed_Pixel_Helper::FromPixels(top_y)) {
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the bounds with edges already in fixed pixels
+  //---------------------------------------------------------------------------
+  static AABB FromFixedPixels(Fixed_Pixel left_x, Fixed_Pixel right_x, Fixed_Pixel bottom_y, Fixed_Pixel top_y) {
+    AABB bounds;
+    bounds.left = left_x;
+    bounds.right = right_x;
+    bounds.bottom = bottom_y;
+    bounds.top = top_y;
+    return bounds;
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the bounds of a block of the given size centred on
+  //               the given position. The centre is rounded before the size
+  //               is added so blocks of the same size are the same size.
+  //---------------------------------------------------------------------------
+  static AABB FromCentre(D3DXVECTOR2 centre, D3DXVECTOR2 size) {
+    return FromCentre(Fixed_Pixel_Helper::FromPixels(centre), size);
+  }
+
+  static AABB FromCentre(Fixed_Point centre, D3DXVECTOR2 size) {
+    Fixed_Pixel half_size_x = Fixed_Pixel_Helper::FromPixels(size.x) / 2;
+    Fixed_Pixel half_size_y = Fixed_Pixel_Helper::FromPixels(size.y) / 2;
+    return FromFixedPixels(centre.x - half_size_x,
+                           centre.x + half_size_x,
+                           centre.y - half_size_y,
+                           centre.y + half_size_y);
+  }
+
+  float GetLeft() const {
+    return Fixed_Pixel_Helper::ToPixels(left);
+  }
+
+  float GetRight() const {
+    return Fixed_Pixel_Helper::ToPixels(right);
+  }
+
+  float GetBottom() const {
+    return Fixed_Pixel_Helper::ToPixels(bottom);
+  }
+
+  float GetTop() const {
+    return Fixed_Pixel_Helper::ToPixels(top);
+  }
+
+  D3DXVECTOR2 GetTopLeft() const {
+    return D3DXVECTOR2(GetLeft(), GetTop());
+  }
+
+  D3DXVECTOR2 GetBottomRight() const {
+    return D3DXVECTOR2(GetRight(), GetBottom());
+  }
+
+  D3DXVECTOR2 GetCentre() const {
+    return D3DXVECTOR2(Fixed_Pixel_Helper::ToPixels(left + right) / 2,
+                       Fixed_Pixel_Helper::ToPixels(bottom + top) / 2);
+  }
+
+  Fixed_Point GetFixedCentre() const {
+    return Fixed_Point((left + right) / 2, (bottom + top) / 2);
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the smallest bounds containing both bounds
+  //---------------------------------------------------------------------------
+  AABB Union(AABB const &other) const {
+    AABB union_bounds = *this;
+    if (other.left < union_bounds.left) { union_bounds.left = other.left; }
+    if (other.right > union_bounds.right) { union_bounds.right = other.right; }
+    if (other.bottom < union_bounds.bottom) { union_bounds.bottom = other.bottom; }
+    if (other.top > union_bounds.top) { union_bounds.top = other.top; }
+    return union_bounds;
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns whether the bounds overlap in the X dimension, or
+  //               share a left or right edge
+  //---------------------------------------------------------------------------
+  bool IsXColliding(AABB const &other) const {
+    if (other.left > left && other.left < right) { return true; }
+    if (other.right < right && other.right > left) { return true; }
+    if (left > other.left && left < other.right) { return true; }
+    if (right < other.right && right > other.left) { return true; }
+    return (other.left == left || other.right == right);
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns whether the bounds overlap in the Y dimension, or
+  //               share a top or bottom edge
+  //---------------------------------------------------------------------------
+  bool IsYColliding(AABB const &other) const {
+    if (other.top < top && other.top > bottom) { return true; }
+    if (other.bottom < top && other.bottom > bottom) { return true; }
+    if (top < other.top && top > other.bottom) { return true; }
+    if (bottom < other.top && bottom > other.bottom) { return true; }
+    return (top == other.top || bottom == other.bottom);
+  }
+
+  bool IsIntersecting(AABB const &other) const {
+    return IsYColliding(other) && IsXColliding(other);
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns whether the bounds overlap or touch at an edge or
+  //               corner
+  //---------------------------------------------------------------------------
+  bool IsTouching(AABB const &other) const {
+    return (left <= other.right && right >= other.left &&
+            bottom <= other.top && top >= other.bottom);
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns whether any left or right edge of one bounds lines
+  //               up with one of the other
+  //---------------------------------------------------------------------------
+  bool IsXAdjacent(AABB const &other) const {
+    return (other.left == left || other.left == right ||
+            other.right == left || other.right == right);
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns whether any top or bottom edge of one bounds lines
+  //               up with one of the other
+  //---------------------------------------------------------------------------
+  bool IsYAdjacent(AABB const &other) const {
+    return (other.top == top || other.top == bottom ||
+            other.bottom == top || other.bottom == bottom);
+  }
+
+  bool IsLeftXAdjacent(AABB const &other) const {
+    return other.left == left;
+  }
+
+  bool IsRightXAdjacent(AABB const &other) const {
+    return other.right == right;
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns which side of these bounds the other bounds
+  //               collides with in the Y dimension; "Top", "Bottom",
+  //               "Adjacent" when they span the same rows or "" if neither.
+  //---------------------------------------------------------------------------
+  char const * GetTopOrBottomCollisionSide(AABB const &other) const {
+    char const *collision_side = "";
+    if (other.top < top && other.top > bottom) { collision_side = "Bottom"; }
+    if (other.bottom < top && other.bottom > bottom) { collision_side = "Top"; }
+    if (top < other.top && top > other.bottom) { collision_side = "Top"; }
+    if (bottom < other.top && bottom > other.bottom) { collision_side = "Bottom"; }
+    if (top == other.top && bottom == other.bottom) { collision_side = "Adjacent"; }
+    return collision_side;
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns which side of these bounds the other bounds
+  //               collides with in the X dimension; "Right", "Left",
+  //               "Adjacent" when they span the same columns or "" if neither.
+  //---------------------------------------------------------------------------
+  char const * GetRightOrLeftCollisionSide(AABB const &other) const {
+    char const *collision_side = "";
+    if (other.left > left && other.left < right) { collision_side = "Right"; }
+    if (other.right < right && other.right > left) { collision_side = "Left"; }
+    if (left > other.left && left < other.right) { collision_side = "Left"; }
+    if (right < other.right && right > other.left) { collision_side = "Right"; }
+    if (other.left == left && other.right == right) { collision_side = "Adjacent"; }
+    return collision_side;
+  }
+
+  Fixed_Pixel left;
+  Fixed_Pixel right;
+  Fixed_Pixel bottom;
+  Fixed_Pixel top;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_AABB_H_
@@ -0,0 +1,110 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_AABB_BATCH_H_
+#define TUNNELOUR_AABB_BATCH_H_
+
+#include <vector>
+#include "AABB.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : AABB_Batch stores a list of bounds as separate arrays of
+//                fixed pixel edges so one box can be tested against all of
+//                them four at a time with SSE2 integer compares. Builds
+//                without SSE2 use the scalar test.
+//-----------------------------------------------------------------------------
+class AABB_Batch {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  AABB_Batch();
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~AABB_Batch();
+
+  //---------------------------------------------------------------------------
+  // Description : Adds bounds to the end of the batch
+  //---------------------------------------------------------------------------
+  void Add(AABB const &bounds);
+
+  //---------------------------------------------------------------------------
+  // Description : Removes the bounds at the index, the bounds after it move
+  //               down one place so the order is kept.
+  //---------------------------------------------------------------------------
+  void Remove(unsigned int index);
+
+  //---------------------------------------------------------------------------
+  // Description : Removes all the bounds
+  //---------------------------------------------------------------------------
+  void Clear();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the bounds at the index
+  //---------------------------------------------------------------------------
+  AABB GetAABB(unsigned int index);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of bounds in the batch
+  //---------------------------------------------------------------------------
+  unsigned int GetSize();
+
+  //---------------------------------------------------------------------------
+  // Description : Replaces out_hit_mask with one bit per bounds, set if the
+  //               bounds touch the box (see AABB::IsTouching). Bit i%32 of
+  //               word i/32 is for the bounds at index i.
+  //---------------------------------------------------------------------------
+  void GetTouchingMask(AABB const &box, std::vector<unsigned int> *out_hit_mask);
+
+  //---------------------------------------------------------------------------
+  // Description : Same as GetTouchingMask but always tests one bounds at a
+  //               time, used when the build has no SSE2.
+  //---------------------------------------------------------------------------
+  void GetTouchingMaskScalar(AABB const &box, std::vector<unsigned int> *out_hit_mask);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns whether the bit for the index is set in a mask
+  //               made by GetTouchingMask
+  //---------------------------------------------------------------------------
+  static bool IsHit(std::vector<unsigned int> const &hit_mask, unsigned int index);
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Clears the mask and sizes it for the batch
+  //---------------------------------------------------------------------------
+  void ResetMask(std::vector<unsigned int> *out_hit_mask);
+
+  //---------------------------------------------------------------------------
+  // Description : Sets the bits for the bounds from the first index onwards
+  //               which touch the box, one bounds at a time.
+  //---------------------------------------------------------------------------
+  void SetTouchingBitsScalar(AABB const &box, unsigned int first_index, std::vector<unsigned int> *out_hit_mask);
+
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  std::vector<Fixed_Pixel> m_min_x;
+  std::vector<Fixed_Pixel> m_min_y;
+  std::vector<Fixed_Pixel> m_max_x;
+  std::vector<Fixed_Pixel> m_max_y;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_AABB_BATCH_H_
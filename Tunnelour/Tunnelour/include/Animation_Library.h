@@ -0,0 +1,129 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_ANIMATION_LIBRARY_H_
+#define TUNNELOUR_ANIMATION_LIBRARY_H_
+
+#include <unordered_map>
+#include <vector>
+#include "Avatar_Component.h"
+#include "Tileset_Helper.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Animation_Library holds the avatar's animation tilesets once
+//                they are loaded. Each subset is indexed by its parent state
+//                and state ids and its frames are ordered by frame number,
+//                so a state change or a new frame is a lookup and the
+//                metadata is read in place rather than copied. The collision
+//                blocks of every frame are baked into the game world's
+//                coordinates for both directions when the library is built.
+//-----------------------------------------------------------------------------
+class Animation_Library {
+ public:
+  typedef unsigned int Subset_Handle;
+
+  static const Subset_Handle NO_SUBSET = 0xFFFFFFFF;
+
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  Animation_Library();
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Animation_Library();
+
+  //---------------------------------------------------------------------------
+  // Description : Adds a loaded animation tileset and interns its state
+  //               names. Build has to be called again before it is found.
+  //---------------------------------------------------------------------------
+  void Add(Tileset_Helper::Animation_Tileset_Metadata const &metadata);
+
+  //---------------------------------------------------------------------------
+  // Description : Orders the frames of every subset so frame number n is at
+  //               index n - 1, bakes their collision blocks and indexes the
+  //               subsets by state. Handles, references and collision block
+  //               pointers stay valid until the next Add or Clear.
+  //---------------------------------------------------------------------------
+  void Build();
+
+  //---------------------------------------------------------------------------
+  // Description : Forgets every tileset
+  //---------------------------------------------------------------------------
+  void Clear();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the handle of the subset for the state, NO_SUBSET
+  //               if the parent state has no such animation
+  //---------------------------------------------------------------------------
+  Subset_Handle Find(unsigned int parent_state, unsigned int state);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the tileset and the subset of a found handle
+  //---------------------------------------------------------------------------
+  Tileset_Helper::Animation_Tileset_Metadata const & GetMetadata(Subset_Handle handle);
+  Tileset_Helper::Animation_Subset const & GetSubset(Subset_Handle handle);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns frame number frame_index + 1 of a subset, a frame
+  //               without collision blocks if the tileset skipped it
+  //---------------------------------------------------------------------------
+  Tileset_Helper::Frame_Metadata const & GetFrame(Subset_Handle handle, unsigned int frame_index);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the baked collision blocks of frame number
+  //               frame_index + 1 of a subset facing the direction
+  //---------------------------------------------------------------------------
+  Avatar_Component::Frame_Collision_Blocks const * GetCollisionBlocks(Subset_Handle handle, unsigned int frame_index, Avatar_Component::Direction direction);
+
+ protected:
+
+ private:
+  struct Subset_Entry {
+    unsigned int metadata_index;
+    unsigned int subset_index;
+    // Index of the subset's first frame in m_collision_blocks
+    unsigned int first_collision_blocks;
+  };
+
+  // Facing right, or not facing either way, and facing left
+  static const unsigned int DIRECTION_COUNT = 2;
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the key of the state in the index
+  //---------------------------------------------------------------------------
+  static long long GetKey(unsigned int parent_state, unsigned int state);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the collision blocks of a frame in the game world's
+  //               coordinates, as offsets from the avatar's centre
+  //---------------------------------------------------------------------------
+  static Avatar_Component::Frame_Collision_Blocks BakeCollisionBlocks(Tileset_Helper::Frame_Metadata const &frame, float tileset_animation_top_left_y, unsigned int frame_index, Avatar_Component::Direction direction);
+
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  std::vector<Tileset_Helper::Animation_Tileset_Metadata> m_metadata;
+  std::vector<Subset_Entry> m_subsets;
+  std::unordered_map<long long, Subset_Handle> m_handles;
+  std::vector<Avatar_Component::Frame_Collision_Blocks> m_collision_blocks;
+  Tileset_Helper::Frame_Metadata m_missing_frame;
+  Avatar_Component::Frame_Collision_Blocks m_missing_collision_blocks;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_ANIMATION_LIBRARY_H_
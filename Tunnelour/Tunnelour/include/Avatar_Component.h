@@ -30,14 +30,102 @@ namespace Tunnelour {
 //-----------------------------------------------------------------------------
 class Avatar_Component: public Tunnelour::Bitmap_Component {
  public:
+  //---------------------------------------------------------------------------
+  // Description : Ids of the parent states, states and commands named in the
+  //               Charlie animation tilesets and used by the controllers.
+  //               Avatar_State_Names hands out ids from KNOWN_STATE_COUNT on
+  //               for any other name a tileset brings in.
+  //---------------------------------------------------------------------------
+  enum State_ID {
+    NO_STATE = 0,
+    CHARLIE_CLIMBING,
+    HANGING,
+    CLIMBING_1,
+    CLIMBING_TO_STANDING,
+    GRABBING_TO_HANGING,
+    ASCENDING_TO_GRABBING,
+    DESCENDING_TO_GRABBING,
+    CLIMBING_2,
+    POP_UP,
+    CHARLIE_FALLING,
+    DOWN_FACING_FALLING,
+    DOWN_FACING_FALLING_TO_DEATH,
+    DOWN_FACING_DEATH,
+    DOWN_FALLING_WALL_IMPACT_RIGHT,
+    UP_FACING_FALLING,
+    UP_FACING_FALLING_TO_DEATH,
+    UP_FACING_DEATH,
+    UP_FALLING_WALL_IMPACT_LEFT,
+    CHARLIE_JUMPING,
+    VERTICAL_JUMP_TAKEOFF,
+    VERTICAL_JUMP_ARC,
+    VERTICAL_JUMP_LANDING,
+    GAP_JUMP_TAKEOFF,
+    GAP_JUMP_ARC_RISE,
+    GAP_JUMP_ARC_FALL,
+    GAP_JUMP_FALLING,
+    GAP_JUMP_LANDING,
+    WALL_JUMP_TAKEOFF,
+    WALL_JUMP_RISE_ARC,
+    WALL_JUMP_FALL_ARC,
+    WALL_JUMP_LANDING,
+    WALL_JUMP_RISING,
+    WALL_JUMP_FALLING,
+    CHARLIE_RUNNING,
+    RUNNING,
+    STANDING_TO_RUNNING,
+    WALL_COLLIDING,
+    STOPPING,
+    WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF,
+    WALL_COLLIDING_FROM_MID_SPEED_ARC,
+    WALL_COLLIDING_FROM_MID_SPEED_FALLING,
+    WALL_COLLIDING_FROM_MID_SPEED_LANDING,
+    WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF,
+    WALL_COLLIDING_FROM_HIGH_SPEED_ARC,
+    WALL_COLLIDING_FROM_HIGH_SPEED_FALLING,
+    WALL_COLLIDING_FROM_HIGH_SPEED_LANDING,
+    FALSE_START,
+    CHARLIE_STANDING,
+    STANDING,
+    INITIAL,
+    LOOKING,
+    IDLE_1,
+    SLOW_RUNNING,
+    DOWN,
+    JUMPING,
+    KNOWN_STATE_COUNT
+  };
+
+  enum Direction {
+    NO_DIRECTION = 0,
+    RIGHT,
+    LEFT
+  };
+
+  // The collision blocks named in the animation tilesets
+  enum Collision_Block_ID {
+    NO_COLLISION_BLOCK = 0,
+    AVATAR_BLOCK,
+    RIGHT_FOOT_BLOCK,
+    LEFT_FOOT_BLOCK,
+    HAND_BLOCK,
+    ARM_BLOCK,
+    COLLISION_BLOCK_COUNT
+  };
+
    struct Avatar_Collision_Block {
-     std::string id;
+     Avatar_Collision_Block() : id(NO_COLLISION_BLOCK),
+                                is_contacting(false),
+                                offset_from_avatar_centre(0.0f, 0.0f, 0.0f),
+                                size(0.0f, 0.0f) {
+     }
+     Collision_Block_ID id;
      bool is_contacting;
      D3DXVECTOR3 offset_from_avatar_centre;
      D3DXVECTOR2 size;
 
      bool operator==(const Avatar_Collision_Block& rhs) const {
-       if (id.compare(rhs.id) != 0) { return false; }
+       if (id != rhs.id) { return false; }
        if (is_contacting != rhs.is_contacting) { return false; }
        if (offset_from_avatar_centre != rhs.offset_from_avatar_centre) { return false; }
        if (size != rhs.size) { return false; } 
@@ -45,30 +133,47 @@ class Avatar_Component: public Tunnelour::Bitmap_Component {
      }
    };
 
+  //---------------------------------------------------------------------------
+  // Description : The collision blocks of one animation frame facing one way,
+  //               indexed by Collision_Block_ID. A block the frame does not
+  //               have is left as NO_COLLISION_BLOCK.
+  //---------------------------------------------------------------------------
+  struct Frame_Collision_Blocks {
+    Avatar_Collision_Block blocks[COLLISION_BLOCK_COUNT];
+  };
+
   struct Avatar_State {
-    std::string parent_state;
-    std::string state;
+    Avatar_State() : parent_state(NO_STATE),
+                     state(NO_STATE),
+                     state_index(0),
+                     max_state_index(0),
+                     direction(NO_DIRECTION),
+                     avatar_collision_blocks(0) {
+    }
+    unsigned int parent_state;
+    unsigned int state;
     unsigned int state_index;
     int max_state_index;
-    std::string direction;
-    std::vector<Avatar_Collision_Block> avatar_collision_blocks;
+    Direction direction;
+    // Baked by the Animation_Library, 0 before the first state is set
+    Frame_Collision_Blocks const *avatar_collision_blocks;
 
     bool operator==(const Avatar_State& rhs) const {
-      if (parent_state.compare(rhs.parent_state) != 0) { return false; }
-      if (state.compare(rhs.state) != 0) { return false; }
+      if (parent_state != rhs.parent_state) { return false; }
+      if (state != rhs.state) { return false; }
       if (state_index != rhs.state_index) { return false; }
       if (max_state_index != rhs.max_state_index) { return false; }
-      if (direction.compare(rhs.direction) != 0) { return false; }
+      if (direction != rhs.direction) { return false; }
       if (avatar_collision_blocks != rhs.avatar_collision_blocks) { return false; }
       return true;
     }
 
     bool operator!=(const Avatar_State& rhs) const {
-      if (parent_state.compare(rhs.parent_state) != 0) { return true; }
-      if (state.compare(rhs.state) != 0) { return true; }
+      if (parent_state != rhs.parent_state) { return true; }
+      if (state != rhs.state) { return true; }
       if (state_index != rhs.state_index) { return true; }
       if (max_state_index != rhs.max_state_index) { return true; }
-      if (direction.compare(rhs.direction) != 0) { return true; }
+      if (direction != rhs.direction) { return true; }
       if (avatar_collision_blocks != rhs.avatar_collision_blocks) { return true; }
       return false;
     }
@@ -89,17 +194,60 @@ class Avatar_Component: public Tunnelour::Bitmap_Component {
   //---------------------------------------------------------------------------
   virtual void Init();
 
-  Avatar_State GetState();
+  //---------------------------------------------------------------------------
+  // Description : Returns the texture area of the current animation frame,
+  //               mirrored horizontally when the avatar is facing left.
+  //---------------------------------------------------------------------------
+  virtual D3DXVECTOR4 GetUVRect();
+
+  //---------------------------------------------------------------------------
+  // Description : The states are returned by reference, copy one to keep it
+  //               across a SetState. SetState makes the current state the
+  //               last state and only moves the state version if either of
+  //               them changes.
+  //---------------------------------------------------------------------------
+  Avatar_State const & GetState();
   void SetState(Avatar_State state);
 
-  Avatar_State GetLastState();
+  Avatar_State const & GetLastState();
+
+  Avatar_State const & GetLastRenderedState();
+
+  //---------------------------------------------------------------------------
+  // Description : Makes the current state the last rendered state. Nothing
+  //               is copied if the state hasn't changed since the last time.
+  //               The view calls it every frame so it leaves the state
+  //               version alone.
+  //---------------------------------------------------------------------------
+  void SetLastRenderedState();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the state version of the last rendered state, so
+  //               it only moves when a changed state is rendered
+  //---------------------------------------------------------------------------
+  unsigned int GetLastRenderedStateVersion();
 
-  Avatar_State GetLastRenderedState();
-  void SetLastRenderedState(Avatar_Component::Avatar_State last_state);
+  Avatar_State const & GetCommand();
 
-  Avatar_State GetCommand();
+  //---------------------------------------------------------------------------
+  // Description : Mutator for the Command. Input sets it every frame, so the
+  //               command version only moves when it is a different command.
+  //---------------------------------------------------------------------------
   void SetCommand(Avatar_State current_command);
 
+  //---------------------------------------------------------------------------
+  // Description : Returns a number which increases whenever the state
+  //               changes, so anything worked out from it can tell when it
+  //               is stale.
+  //---------------------------------------------------------------------------
+  unsigned int GetStateVersion();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns a number which increases whenever the command
+  //               changes, for the answers which depend on the command
+  //---------------------------------------------------------------------------
+  unsigned int GetCommandVersion();
+
   
 
  protected:
@@ -114,6 +262,10 @@ class Avatar_Component: public Tunnelour::Bitmap_Component {
   Avatar_State m_last_rendered_state;
   Avatar_State m_initial_state;
   Avatar_State m_command;
+  unsigned int m_state_version;
+  unsigned int m_command_version;
+  // The state version when the last rendered state was set
+  unsigned int m_last_rendered_state_version;
 };  // class Avatar_Component
 }  // namespace Tunnelour
 #endif  // TUNNELOUR_AVATAR_COMPONENT_H_
@@ -17,12 +17,16 @@
 #define TUNNELOUR_AVATAR_CONTROLLER_H_
 
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "Animation_Library.h"
 #include "Avatar_Component.h"
+#include "Avatar_Crowd.h"
 #include "Avatar_Helper.h"
 #include "Avatar_Controller_Mutator.h"
 #include "Bitmap_Helper.h"
+#include "Camera_Component.h"
 #include "Component_Composite.h"
 #include "Controller.h"
 #include "Charlie_Standing_Controller.h"
@@ -31,10 +35,14 @@
 #include "Charlie_Jumping_Controller.h"
 #include "Charlie_Climbing_Controller.h"
 #include "Exceptions.h"
+#include "Fixed_Pixel.h"
+#include "Game_Metrics_Component.h"
 #include "Game_Settings_Component.h"
 #include "Level_Component.h"
+#include "Snapshot_Buffer.h"
 #include "String_Helper.h"
 #include "Tile_Bitmap.h"
+#include "Tile_Class_Index_Component.h"
 #include "Tileset_Helper.h"
 
 namespace Tunnelour {
@@ -43,8 +51,7 @@ namespace Tunnelour {
 //  Description : This controller is responsible for the creation and mutation
 //                of the avatar_component.
 //-----------------------------------------------------------------------------
-class Avatar_Controller: public Controller,
-                         public Component_Composite::Component_Composite_Type_Observer {
+class Avatar_Controller: public Controller {
  public:
   //---------------------------------------------------------------------------
   // Description : Constructor
@@ -67,47 +74,144 @@ class Avatar_Controller: public Controller,
   virtual bool Run();
 
   //---------------------------------------------------------------------------
-  // Description : Called when handling an "Add" call in the model
+  // Description : Hides the avatar component so it isn't rendered
   //---------------------------------------------------------------------------
-  virtual void HandleEventAdd(Tunnelour::Component * const component);
+  void HideAvatar();
 
   //---------------------------------------------------------------------------
-  // Description : Called when handling a "Remove" call in the model
+  // Description : Shows the avatar component so it can be rendered
   //---------------------------------------------------------------------------
-  virtual void HandleEventRemove(Tunnelour::Component * const component);
+  void ShowAvatar();
 
   //---------------------------------------------------------------------------
-  // Description : Called when handling a "Update" call in the model
+  // Description : Resets the Avatar_Component tile to defaults
   //---------------------------------------------------------------------------
-  virtual void HandleEventUpdate(Tunnelour::Component * const component);
+  void ResetAvatarToDefaults();
 
   //---------------------------------------------------------------------------
-  // Description : Hides the avatar component so it isn't rendered
+  // Description : Sets how many state transitions are followed in one
+  //               animation tick before the rest wait for the next tick
   //---------------------------------------------------------------------------
-  void HideAvatar();
+  void SetMaxStateTransitionsPerTick(unsigned int max_state_transitions_per_tick);
 
   //---------------------------------------------------------------------------
-  // Description : Shows the avatar component so it can be rendered
+  // Description : Adds a computer controlled avatar to the crowd, running in
+  //               the direction from the position
   //---------------------------------------------------------------------------
-  void ShowAvatar();
+  void AddCrowdAvatar(D3DXVECTOR3 position, Avatar_Component::Direction direction);
 
   //---------------------------------------------------------------------------
-  // Description : Resets the Avatar_Component tile to defaults
+  // Description : While rewinding each animation tick steps the avatar back
+  //               to its snapshot from the tick before instead of running it
   //---------------------------------------------------------------------------
-  void ResetAvatarToDefaults();
+  void SetIsRewinding(bool is_rewinding);
+
+  //---------------------------------------------------------------------------
+  // Description : Puts the avatar, camera and metrics back as they were the
+  //               number of ticks ago, forgetting the ticks after. Returns
+  //               false if there is no snapshot that old.
+  //---------------------------------------------------------------------------
+  bool RewindAvatar(unsigned int ticks);
+
+  //---------------------------------------------------------------------------
+  // Description : Puts the avatar, camera and metrics back as they were
+  //               when the avatar was last reset to its defaults
+  //---------------------------------------------------------------------------
+  void RestartFromCheckpoint();
 
  protected:
  private:
+  //---------------------------------------------------------------------------
+  // Description : The fields of a snapshot, positions and distances are in
+  //               fixed pixels so snapshots restore them exactly
+  //---------------------------------------------------------------------------
+  enum Snapshot_Field {
+    AVATAR_X = 0,
+    AVATAR_Y,
+    AVATAR_Z,
+    VELOCITY_X,
+    VELOCITY_Y,
+    PARENT_STATE,
+    STATE,
+    STATE_INDEX,
+    DIRECTION,
+    CAMERA_X,
+    CAMERA_Y,
+    CAMERA_Z,
+    Y_FALLEN,
+    DISTANCE_TRAVELED,
+    METRICS_DISTANCE,
+    SECONDS_PAST,
+    SNAPSHOT_FIELD_COUNT
+  };
+
   //---------------------------------------------------------------------------
   // Description : Generates the Avatar_Component tile
   //---------------------------------------------------------------------------
   void CreateAvatar();
 
   //---------------------------------------------------------------------------
-  // Description : Changes and maintains the state of the avatar
+  // Description : Initialises the state controllers and indexes them by the
+  //               parent state they run
+  //---------------------------------------------------------------------------
+  void InitStateControllers();
+
+  //---------------------------------------------------------------------------
+  // Description : Initialises a state controller with the avatar and the
+  //               state it shares with the other state controllers
+  //---------------------------------------------------------------------------
+  void InitStateController(Avatar_State_Controller *state_controller);
+
+  //---------------------------------------------------------------------------
+  // Description : Changes and maintains the state of the avatar. Runs the
+  //               state controller of the avatar's parent state until the
+  //               state stops changing, the transition limit is reached or a
+  //               state is entered twice in the tick.
   //---------------------------------------------------------------------------
   void RunAvatarState();
 
+  //---------------------------------------------------------------------------
+  // Description : Records how the last tick's transitions were resolved in
+  //               the Game_Metrics_Component, once there is one
+  //---------------------------------------------------------------------------
+  void UpdateStateResolutionMetrics(unsigned int transitions, INT64 start_time, bool is_cut_short);
+
+  //---------------------------------------------------------------------------
+  // Description : Adds the game settings' number of crowd avatars at the
+  //               level's start, facing alternate ways
+  //---------------------------------------------------------------------------
+  void CreateCrowd();
+
+  //---------------------------------------------------------------------------
+  // Description : Steps the crowd and records how long it took in the
+  //               Game_Metrics_Component, once there is one
+  //---------------------------------------------------------------------------
+  void RunCrowd();
+
+  //---------------------------------------------------------------------------
+  // Description : Copies the crowd's positions and states to the crowd's
+  //               avatar components so they are rendered
+  //---------------------------------------------------------------------------
+  void UpdateCrowdAvatars();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the Game_Metrics_Component, 0 until there is one
+  //---------------------------------------------------------------------------
+  Game_Metrics_Component* GetGameMetrics();
+
+  //---------------------------------------------------------------------------
+  // Description : Adds the avatar, camera and metrics as they are now to the
+  //               snapshots
+  //---------------------------------------------------------------------------
+  void RecordSnapshot();
+
+  //---------------------------------------------------------------------------
+  // Description : Puts the avatar, camera and metrics back as they are in
+  //               the snapshot. The seconds past are left to the
+  //               Game_Metrics_Controller's timer.
+  //---------------------------------------------------------------------------
+  void RestoreSnapshot(std::vector<int> const &fields);
+
   //---------------------------------------------------------------------------
   // Description : Loads all the tile animations into the controller
   //---------------------------------------------------------------------------
@@ -131,10 +235,7 @@ class Avatar_Controller: public Controller,
   Level_Component *m_level;
   World_Settings_Component *m_world_settings;
 
-  std::string m_current_metadata_file_path;
-  Tileset_Helper::Animation_Tileset_Metadata m_current_metadata;
-  Tileset_Helper::Animation_Subset m_current_animation_subset;
-  std::vector<Tileset_Helper::Animation_Tileset_Metadata> m_animation_metadata;
+  Animation_Library m_animation_library;
 
   INT64 m_frequency;
   float m_ticksPerMs;
@@ -144,9 +245,7 @@ class Avatar_Controller: public Controller,
   bool m_animation_tick;
   int m_current_animation_fps;
 
-  std::vector<Tile_Bitmap*> m_floor_tiles;
-  std::vector<Tile_Bitmap*> m_wall_tiles;
-  std::vector<Tile_Bitmap*> m_ledge_tiles;
+  Tile_Class_Index_Component *m_tile_class_index;
 
   float m_y_fallen;
 
@@ -161,9 +260,9 @@ class Avatar_Controller: public Controller,
 
   int m_wall_jump_y_initial_velocity;
 
-  std::string m_avatar_initial_direction;
-  std::string m_avatar_initial_parent_state;
-  std::string m_avatar_initial_state;
+  Avatar_Component::Direction m_avatar_initial_direction;
+  unsigned int m_avatar_initial_parent_state;
+  unsigned int m_avatar_initial_state;
   D3DXVECTOR3 m_avatar_initial_position;
 
   Charlie_Standing_Controller m_charlie_standing_controller;
@@ -171,6 +270,23 @@ class Avatar_Controller: public Controller,
   Charlie_Running_Controller m_charlie_running_controller;
   Charlie_Jumping_Controller m_charlie_jumping_controller;
   Charlie_Climbing_Controller m_charlie_climbing_controller;
+  // The state controller of each parent state, 0 for other states
+  std::vector<Avatar_State_Controller*> m_state_controllers;
+  unsigned int m_max_state_transitions_per_tick;
+  // The parent states and states run in the current tick
+  std::vector<std::pair<unsigned int, unsigned int>> m_resolved_states;
+  Game_Metrics_Component *m_game_metrics;
+
+  // The computer controlled avatars, and the component each is drawn with
+  Avatar_Crowd m_crowd;
+  std::vector<Avatar_Component*> m_crowd_avatars;
+
+  // The last few seconds of the avatar, and where it was last reset to
+  Snapshot_Buffer m_snapshots;
+  std::vector<int> m_snapshot_fields;
+  std::vector<int> m_checkpoint;
+  bool m_is_rewinding;
+  Camera_Component *m_camera;
 
   float m_avatar_z_position;
 
@@ -19,9 +19,10 @@
 #include <list>
 #include <vector>
 
+#include "Camera_Component.h"
 #include "Component.h"
 #include "Game_Settings_Component.h"
-#include "Tile_Bitmap.h"
+#include "Tile_Class_Index_Component.h"
 #include "World_Settings_Component.h"
 #include "Level_Component.h"
 
@@ -54,19 +55,9 @@ class Avatar_Controller_Mutator: public Component::Component_Mutator  {
   Game_Settings_Component* const GetGameSettings();
 
   //-------------------------------------------------------------------------
-  // Description : Accessor for the Floor Tiles
+  // Description : Accessor for the Tile_Class_Index_Component
   //-------------------------------------------------------------------------
-  std::vector<Tile_Bitmap*> GetFloorTiles();
-
-  //-------------------------------------------------------------------------
-  // Description : Accessor for the Wall Tiles
-  //-------------------------------------------------------------------------
-  std::vector<Tile_Bitmap*> GetWallTiles();
-
-  //-------------------------------------------------------------------------
-  // Description : Accessor for the Ledge Tiles
-  //-------------------------------------------------------------------------
-  std::vector<Tile_Bitmap*> GetLedgeTiles();
+  Tile_Class_Index_Component* GetTileClassIndex();
 
   //-------------------------------------------------------------------------
   // Description : Accessor for the World_Settings_Component
@@ -78,6 +69,12 @@ class Avatar_Controller_Mutator: public Component::Component_Mutator  {
   //-------------------------------------------------------------------------
   Level_Component* GetLevel();
 
+  //-------------------------------------------------------------------------
+  // Description : Accessor for the Camera_Component, 0 if there isn't one
+  //               yet. The camera isn't needed for the mutator to succeed.
+  //-------------------------------------------------------------------------
+  Camera_Component* GetCamera();
+
   //-------------------------------------------------------------------------
   // Description : Has this mutator completed successfully?
   //-------------------------------------------------------------------------
@@ -87,13 +84,13 @@ class Avatar_Controller_Mutator: public Component::Component_Mutator  {
   bool m_found_game_settings;
   bool m_found_world_settings;
   bool m_found_level;
+  bool m_found_tile_class_index;
 
   Game_Settings_Component *m_game_settings;
-  std::vector<Tile_Bitmap*> m_floor_tiles;
-  std::vector<Tile_Bitmap*> m_wall_tiles;
-  std::vector<Tile_Bitmap*> m_ledge_tiles;
+  Tile_Class_Index_Component *m_tile_class_index;
   World_Settings_Component *m_world_settings;
   Level_Component *m_level;
+  Camera_Component *m_camera;
 };
 }  // namespace Tunnelour
 #endif  // TUNNELOUR_AVATAR_CONTROLLER_MUTATOR_H_
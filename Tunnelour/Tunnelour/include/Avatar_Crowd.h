@@ -0,0 +1,217 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#ifndef TUNNELOUR_AVATAR_CROWD_H_
+#define TUNNELOUR_AVATAR_CROWD_H_
+
+#include <d3dx10math.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "AABB.h"
+#include "Animation_Library.h"
+#include "Avatar_Component.h"
+#include "Tile_Grid.h"
+#include "World_Settings_Component.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Avatar_Crowd runs many computer controlled avatars at once.
+//                Each avatar only runs along the floor, turns at walls and
+//                falls off ledges, so rather than an Avatar_Component and a
+//                set of state controllers each, the crowd keeps every
+//                avatar's position, velocity and state in separate arrays
+//                and steps them all together. An avatar's step only reads the
+//                shared tiles and animations and only writes its own place in
+//                the arrays, so the crowd is split across threads once it is
+//                big enough. The threads are started the first time they are
+//                needed and wait between ticks rather than being started
+//                every tick.
+//-----------------------------------------------------------------------------
+class Avatar_Crowd {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  Avatar_Crowd();
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor, stops the crowd's threads
+  //---------------------------------------------------------------------------
+  virtual ~Avatar_Crowd();
+
+  //---------------------------------------------------------------------------
+  // Description : Sets the animations, tiles and world the crowd runs in.
+  //               The animation library must have been built.
+  //---------------------------------------------------------------------------
+  void Init(Animation_Library *animation_library, Tile_Grid *tiles, World_Settings_Component *world_settings);
+
+  //---------------------------------------------------------------------------
+  // Description : Adds an avatar running in the direction from the position
+  //               and returns its index, the crowd must have been initialised
+  //---------------------------------------------------------------------------
+  unsigned int Add(D3DXVECTOR3 position, Avatar_Component::Direction direction);
+
+  //---------------------------------------------------------------------------
+  // Description : Removes every avatar
+  //---------------------------------------------------------------------------
+  void Clear();
+
+  //---------------------------------------------------------------------------
+  // Description : Puts every avatar back where and how it was added
+  //---------------------------------------------------------------------------
+  void Reset();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of avatars
+  //---------------------------------------------------------------------------
+  unsigned int GetSize();
+
+  //---------------------------------------------------------------------------
+  // Description : Steps every avatar one animation tick, split into ranges
+  //               of at least the avatars per thread. This thread steps the
+  //               last range while the crowd's threads step the rest, and
+  //               returns once they all have.
+  //---------------------------------------------------------------------------
+  void Update();
+
+  //---------------------------------------------------------------------------
+  // Description : Steps the avatars from first up to but not including last
+  //               one animation tick. Different ranges can be stepped at the
+  //               same time as long as the tiles are not changed.
+  //---------------------------------------------------------------------------
+  void Update(unsigned int first, unsigned int last);
+
+  //---------------------------------------------------------------------------
+  // Description : Sets the fewest avatars worth giving a thread of their own
+  //---------------------------------------------------------------------------
+  void SetAvatarsPerThread(unsigned int avatars_per_thread);
+
+  //---------------------------------------------------------------------------
+  // Description : Sets the most threads Update uses, including the calling
+  //               thread. 0, the default, is as many as the hardware has.
+  //---------------------------------------------------------------------------
+  void SetMaxThreadCount(unsigned int max_thread_count);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of threads the last Update used
+  //---------------------------------------------------------------------------
+  unsigned int GetLastThreadCount();
+
+  //---------------------------------------------------------------------------
+  // Description : Accessors for an avatar's state after the last step
+  //---------------------------------------------------------------------------
+  D3DXVECTOR3 GetPosition(unsigned int index);
+  Fixed_Point GetFixedPosition(unsigned int index);
+  Avatar_Component::Direction GetDirection(unsigned int index);
+  unsigned int GetParentState(unsigned int index);
+  unsigned int GetState(unsigned int index);
+  unsigned int GetStateIndex(unsigned int index);
+  Avatar_Component::Frame_Collision_Blocks const * GetCollisionBlocks(unsigned int index);
+
+ protected:
+
+ private:
+  // What a crowd avatar is doing, each has one animation
+  enum Behaviour {
+    RUNNING = 0,
+    FALLING,
+    BEHAVIOUR_COUNT
+  };
+
+  struct Behaviour_Animation {
+    unsigned int parent_state;
+    unsigned int state;
+    Animation_Library::Subset_Handle handle;
+    unsigned int number_of_frames;
+    bool is_repeatable;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Steps one avatar, only reads and writes its own entries
+  //---------------------------------------------------------------------------
+  void UpdateAvatar(unsigned int index);
+
+  //---------------------------------------------------------------------------
+  // Description : Runs on each of the crowd's threads. Waits for a tick,
+  //               steps the worker's range of it and waits for the next,
+  //               until the crowd is destroyed.
+  //---------------------------------------------------------------------------
+  void RunWorker(unsigned int worker, unsigned int tick);
+
+  //---------------------------------------------------------------------------
+  // Description : Starts threads until the crowd has worker_count of them
+  //---------------------------------------------------------------------------
+  void StartWorkers(unsigned int worker_count);
+
+  //---------------------------------------------------------------------------
+  // Description : Tells the crowd's threads to finish and waits for them
+  //---------------------------------------------------------------------------
+  void StopWorkers();
+
+  //---------------------------------------------------------------------------
+  // Description : Changes what an avatar is doing and starts its animation
+  //---------------------------------------------------------------------------
+  void SetBehaviour(unsigned int index, Behaviour behaviour);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the bounds of an avatar's current avatar block
+  //---------------------------------------------------------------------------
+  AABB GetAvatarBlock(unsigned int index);
+
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  Animation_Library *m_animation_library;
+  Tile_Grid *m_tiles;
+  World_Settings_Component *m_world_settings;
+  Behaviour_Animation m_behaviour_animations[BEHAVIOUR_COUNT];
+  float m_running_x_velocity;
+  unsigned int m_avatars_per_thread;
+  unsigned int m_max_thread_count;
+  unsigned int m_last_thread_count;
+
+  // The crowd's threads, and what they share with Update under the mutex.
+  // Each tick Update moves m_tick on, the first m_tick_worker_count workers
+  // step their range and the last to finish wakes Update.
+  std::vector<std::thread> m_workers;
+  std::mutex m_worker_mutex;
+  std::condition_variable m_tick_started;
+  std::condition_variable m_tick_finished;
+  unsigned int m_tick;
+  unsigned int m_tick_worker_count;
+  unsigned int m_tick_range_size;
+  unsigned int m_tick_size;
+  unsigned int m_busy_worker_count;
+  bool m_is_stopping;
+
+  // One entry per avatar in each, positions and velocities are in fixed
+  // pixels so they move exactly however far across the level they are
+  std::vector<Fixed_Pixel> m_position_x;
+  std::vector<Fixed_Pixel> m_position_y;
+  std::vector<Fixed_Pixel> m_velocity_x;
+  std::vector<Fixed_Pixel> m_velocity_y;
+  std::vector<unsigned char> m_direction;
+  std::vector<unsigned char> m_behaviour;
+  std::vector<unsigned int> m_state_index;
+  std::vector<Avatar_Component::Frame_Collision_Blocks const *> m_collision_blocks;
+  std::vector<D3DXVECTOR3> m_spawn_position;
+  std::vector<unsigned char> m_spawn_direction;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_AVATAR_CROWD_H_
@@ -16,10 +16,14 @@
 #ifndef TUNNELOUR_AVATAR_HELPER_H_
 #define TUNNELOUR_AVATAR_HELPER_H_
 
+#include "AABB.h"
+#include "Animation_Library.h"
 #include "Bitmap_Component.h"
 #include "Avatar_Component.h"
+#include "Avatar_State_Names.h"
 #include "Tile_Bitmap.h"
 #include "Tileset_Helper.h"
+#include "Tile_Grid.h"
 
 namespace Tunnelour {
 //-----------------------------------------------------------------------------
@@ -36,6 +40,10 @@ class Avatar_Helper {
   struct Tile_Collision {
     Bitmap_Component* colliding_tile;
     std::string collision_side;
+    // Fraction of the avatar's last move made before the tile was hit
+    float time_of_impact;
+    // Points out of the side of the tile which was hit
+    D3DXVECTOR2 contact_normal;
   };
 
   //---------------------------------------------------------------------------
@@ -57,18 +65,30 @@ class Avatar_Helper {
   virtual ~Avatar_Helper();
 
   //---------------------------------------------------------------------------
-  // Description : Returns true if the avatar is standing on a floor
+  // Description : Returns true if the avatar is standing on a floor, the
+  //               floor tiles under it replace the adjacent tiles. Answers
+  //               are kept in the Collision_Cache until the avatar moves or
+  //               changes state.
   //---------------------------------------------------------------------------
-  static bool IsAvatarFloorAdjacent(Avatar_Component *m_avatar, std::vector<Tile_Bitmap*> *adjacent_tiles, std::vector<Tile_Bitmap*> *floor_tiles);
+  static bool IsAvatarFloorAdjacent(Avatar_Component *m_avatar, std::vector<Tile_Bitmap*> *adjacent_tiles, Tile_Grid *floor_tiles);
 
-  static Avatar_Component::Avatar_Collision_Block GetNamedCollisionBlock(std::string id, std::vector<Avatar_Component::Avatar_Collision_Block> avatar_collision_blocks);
+  //---------------------------------------------------------------------------
+  // Description : Returns the block of a frame's collision blocks, one with
+  //               id NO_COLLISION_BLOCK if the frame does not have it
+  //---------------------------------------------------------------------------
+  static Avatar_Component::Avatar_Collision_Block const & GetNamedCollisionBlock(Avatar_Component::Collision_Block_ID id, Avatar_Component::Frame_Collision_Blocks const *avatar_collision_blocks);
 
-  static Bitmap_Component* Avatar_Helper::CollisionBlockToBitmapComponent(Avatar_Component::Avatar_Collision_Block avatar_collision_block, D3DXVECTOR3 position);
+  //---------------------------------------------------------------------------
+  // Description : Returns the bounds of the given avatar collision block when
+  //               the avatar is at the given position
+  //---------------------------------------------------------------------------
+  static AABB CollisionBlockToAABB(Avatar_Component::Avatar_Collision_Block const &avatar_collision_block, Fixed_Point position);
   
-  static void Avatar_Helper::SetAvatarState(Avatar_Component *m_avatar, std::wstring tileset_path, std::vector<Tileset_Helper::Animation_Tileset_Metadata> *animation_metadata, std::string new_state_parent_name, std::string new_state_name, std::string direction, std::string *current_metadata_file_path, Tileset_Helper::Animation_Tileset_Metadata *current_metadata, Tileset_Helper::Animation_Subset *current_animation_subset);
+  //---------------------------------------------------------------------------
+  // Description : Puts the avatar in the first frame of the state's animation
+  //---------------------------------------------------------------------------
+  static void SetAvatarState(Avatar_Component *m_avatar, std::wstring tileset_path, Animation_Library *animation_library, unsigned int new_parent_state, unsigned int new_state, Avatar_Component::Direction direction);
 
-  static Avatar_Component::Avatar_Collision_Block TilesetCollisionBlockToAvatarCollisionBlock(Tileset_Helper::Avatar_Collision_Block tileset_avatar_collision_block, float tileset_animation_top_left_y, int state_index, std::string direction);
-  
   static void AlignAvatarOnLastContactingFoot(Avatar_Component *avatar);
 
   static void AlignAvatarOnRightFoot(Avatar_Component *avatar);
@@ -81,15 +101,23 @@ class Avatar_Helper {
 
   static void MoveAvatarTileAdjacent(Avatar_Component *avatar, std::string direction, Bitmap_Component* tile);
 
-  static void SetAvatarStateAnimationFrame(Avatar_Component *avatar, unsigned int new_state_index, Tileset_Helper::Animation_Subset *current_animation_subset);
+  //---------------------------------------------------------------------------
+  // Description : Moves the avatar to a frame of its current animation
+  //---------------------------------------------------------------------------
+  static void SetAvatarStateAnimationFrame(Avatar_Component *avatar, unsigned int new_state_index, Animation_Library *animation_library);
 
-  static bool IsAvatarWallColliding(Avatar_Component *avatar, std::vector<Tile_Collision> *out_collisions, std::vector<Tile_Bitmap*> *wall_tiles);
+  //---------------------------------------------------------------------------
+  // Description : The collision queries below replace the out collisions
+  //               with the avatar's collisions, earliest first. Answers are
+  //               kept in the Collision_Cache like IsAvatarFloorAdjacent's.
+  //---------------------------------------------------------------------------
+  static bool IsAvatarWallColliding(Avatar_Component *avatar, std::vector<Tile_Collision> *out_collisions, Tile_Grid *wall_tiles);
 
   static void AlignAvatarOnLastAvatarCollisionBlock(Avatar_Component *avatar);
 
-  static bool IsAvatarFloorColliding(Avatar_Component *avatar, std::vector<Avatar_Helper::Tile_Collision> *out_collisions, std::vector<Tile_Bitmap*> *floor_tiles);
+  static bool IsAvatarFloorColliding(Avatar_Component *avatar, std::vector<Avatar_Helper::Tile_Collision> *out_collisions, Tile_Grid *floor_tiles);
 
-  static bool CanAvatarGrabALedge(Avatar_Component *avatar, std::vector<Avatar_Helper::Tile_Collision> *out_collisions, std::vector<Tile_Bitmap*> *ledge_tiles);
+  static bool CanAvatarGrabALedge(Avatar_Component *avatar, std::vector<Avatar_Helper::Tile_Collision> *out_collisions, Tile_Grid *ledge_tiles);
 
   static void AlignAvatarOnLastLedgeEdge(Avatar_Component *avatar, Avatar_Helper::Tile_Collision ledge);
 
@@ -99,10 +127,58 @@ class Avatar_Helper {
 
   static void AlignAvatarOnLastAvatarCollisionBlockLeftTop(Avatar_Component *avatar);
 
+  //---------------------------------------------------------------------------
+  // Description : Aligns on the bottom corner of the side the avatar is
+  //               moving towards, or facing if it is not moving sideways.
+  //---------------------------------------------------------------------------
+  static void AlignAvatarOnLastAvatarCollisionBlockLeadingBottom(Avatar_Component *avatar);
+
  protected:
 
  private:
-  
+  typedef bool (*Collision_Finder)(Avatar_Component *avatar, std::vector<Tile_Collision> *out_collisions, Tile_Grid *tiles);
+
+  //---------------------------------------------------------------------------
+  // Description : The uncached collision queries, each adds to the out list
+  //---------------------------------------------------------------------------
+  static bool FindFloorAdjacentTiles(Avatar_Component *m_avatar, std::vector<Tile_Bitmap*> *adjacent_tiles, Tile_Grid *floor_tiles);
+
+  static bool FindWallCollisions(Avatar_Component *avatar, std::vector<Tile_Collision> *out_collisions, Tile_Grid *wall_tiles);
+
+  static bool FindFloorCollisions(Avatar_Component *avatar, std::vector<Tile_Collision> *out_collisions, Tile_Grid *floor_tiles);
+
+  static bool FindLedgeCollisions(Avatar_Component *avatar, std::vector<Tile_Collision> *out_collisions, Tile_Grid *ledge_tiles);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the Collision_Cache's answer to a collision query,
+  //               asking the finder and keeping its answer on a miss. The
+  //               query type is a Collision_Cache::Query_Type.
+  //---------------------------------------------------------------------------
+  static bool GetCachedCollisions(int query_type, Collision_Finder find_collisions, Avatar_Component *avatar, std::vector<Tile_Collision> *out_collisions, Tile_Grid *tiles);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the tiles of the given classes touching the area a
+  //               collision block swept through between its last and current
+  //               position.
+  //---------------------------------------------------------------------------
+  static std::vector<Tile_Bitmap*> const & QuerySweptTiles(Tile_Grid *tiles, unsigned int class_mask, AABB const &block, AABB const &last_block);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns where the avatar collision block starts its sweep
+  //               and how far it moved since the avatar was last rendered.
+  //---------------------------------------------------------------------------
+  static AABB GetSweptCollisionBlock(Avatar_Component *avatar, AABB *out_current_block, D3DXVECTOR2 *out_displacement);
+
+  //---------------------------------------------------------------------------
+  // Description : Adds a swept collision to the list, keeping the earliest
+  //               collision first
+  //---------------------------------------------------------------------------
+  static void AddCollisionInTimeOrder(std::vector<Tile_Collision> *out_collisions, Tile_Bitmap *tile, float time_of_impact, D3DXVECTOR2 contact_normal);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the contact normal for a collision side
+  //---------------------------------------------------------------------------
+  static D3DXVECTOR2 GetContactNormal(std::string const &collision_side);
 };
 }  // namespace Tunnelour
 #endif  // TUNNELOUR_AVATAR_HELPER_H_
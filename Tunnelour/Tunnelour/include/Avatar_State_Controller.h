@@ -20,9 +20,12 @@
 #include <string>
 
 #include "Component_Composite.h"
+#include "Animation_Library.h"
 #include "Avatar_Component.h"
 #include "Tile_Bitmap.h"
+#include "Tile_Grid.h"
 #include "Avatar_Helper.h"
+#include "Avatar_State_Transitions.h"
 #include "Controller.h"
 
 #include "Game_Settings_Component.h"
@@ -35,8 +38,7 @@ namespace Tunnelour {
 //  Description : Avatar_State_Controller is a base type for controllers, they are designed
 //                to read and modify the Composite_Component class (the model)
 //-----------------------------------------------------------------------------
-class Avatar_State_Controller: public Controller,
-                               public Component_Composite::Component_Composite_Type_Observer {
+class Avatar_State_Controller: public Controller {
  public:
   //---------------------------------------------------------------------------
   // Description : Constructor
@@ -73,24 +75,22 @@ class Avatar_State_Controller: public Controller,
   //---------------------------------------------------------------------------
   void SetAvatarComponent(Avatar_Component *avatar_component);
 
-  void SetFloorTiles(std::vector<Tile_Bitmap*> floor_tiles);
-
-  void SetWallTiles(std::vector<Tile_Bitmap*> wall_tiles);
-
-  void SetLedgeTiles(std::vector<Tile_Bitmap*> ledge_tiles);
+  //---------------------------------------------------------------------------
+  // Description : Sets the shared index of floor and wall tiles, queried by
+  //               Tile_Bitmap::Tile_Class
+  //---------------------------------------------------------------------------
+  void SetTiles(Tile_Grid *tiles);
 
   void SetGameSettings(Game_Settings_Component* game_settings);
 
-  void SetAnimationMetadata(std::vector<Tileset_Helper::Animation_Tileset_Metadata> *animation_metadata);
-
-  void SetCurrentAnimationSubset(Tileset_Helper::Animation_Subset *current_animation_subset);
+  //---------------------------------------------------------------------------
+  // Description : Sets the avatar's animations, shared by the state
+  //               controllers
+  //---------------------------------------------------------------------------
+  void SetAnimationLibrary(Animation_Library *animation_library);
 
   void SetCurrentlyAdjacentWallTile(Avatar_Helper::Tile_Collision *currently_adjacent_wall_tile);
 
-  void SetCurrentMetadataFilePath(std::string *current_metadata_file_path);
-
-  void SetCurrentMetadata(Tileset_Helper::Animation_Tileset_Metadata *current_metadata);
-
   void SetWorldSettings(World_Settings_Component *world_settings);
 
   void SetLastFrameTime(int *last_frame_time);
@@ -103,42 +103,54 @@ class Avatar_State_Controller: public Controller,
 
   void SetCurrentlyGrabbedTile(Bitmap_Component *& currently_grabbed_tile);
 
+ protected:
   //---------------------------------------------------------------------------
-  // Description : Called when handling an "Add" call in the model
+  // Description : Returns the animation of the avatar's current state
   //---------------------------------------------------------------------------
-  virtual void HandleEventAdd(Tunnelour::Component * const component);
+  Tileset_Helper::Animation_Subset const & GetCurrentAnimationSubset();
 
   //---------------------------------------------------------------------------
-  // Description : Called when handling a "Remove" call in the model
+  // Description : Moves the avatar to the state the transition table gives
+  //               for its state, the command, its contacts and whether the
+  //               animation has finished. Runs the exit hook of the old
+  //               state, aligns the new state and runs its enter hook.
+  //               Returns false if the table has no transition.
   //---------------------------------------------------------------------------
-  virtual void HandleEventRemove(Tunnelour::Component * const component);
+  bool Run_Avatar_State_Transition(unsigned int command, bool is_frame_complete);
 
-  //---------------------------------------------------------------------------
-  // Description : Called when handling a "Update" call in the model
-  //---------------------------------------------------------------------------
-  virtual void HandleEventUpdate(Tunnelour::Component * const component);
- protected:
   //---------------------------------------------------------------------------
   // Member Variables
   //---------------------------------------------------------------------------
   Game_Settings_Component* m_game_settings;
   Avatar_Helper::Avatar_Stored_State m_initial_state;
   Avatar_Component *m_avatar;
-  std::vector<Tile_Bitmap*> m_floor_tiles;
-  std::vector<Tile_Bitmap*> m_wall_tiles;
-  std::vector<Tile_Bitmap*> m_ledge_tiles;
-  std::vector<Tileset_Helper::Animation_Tileset_Metadata> *m_animation_metadata;
-  Tileset_Helper::Animation_Subset *m_current_animation_subset;
+  Tile_Grid *m_tiles;
+  Animation_Library *m_animation_library;
   Avatar_Helper::Tile_Collision *m_adjacent_wall;
-  std::string *m_current_metadata_file_path;
-  Tileset_Helper::Animation_Tileset_Metadata *m_current_metadata;
   World_Settings_Component *m_world_settings;
   int *m_last_frame_time;
   float *m_y_fallen;
   float *m_distance_traveled;
   bool *m_is_moving_continuously;
   Bitmap_Component ** m_currently_grabbed_tile;
+  // Filled in and compiled by each state controller's Init
+  Avatar_State_Transitions m_transitions;
+
  private:
+  //---------------------------------------------------------------------------
+  // Description : Returns the avatar's Avatar_State_Transitions::Contact flags
+  //---------------------------------------------------------------------------
+  unsigned int Get_Avatar_Contacts();
+
+  //---------------------------------------------------------------------------
+  // Description : Sets the avatar's velocity from a state hook
+  //---------------------------------------------------------------------------
+  void Apply_State_Hook(Avatar_State_Transitions::State_Hook const *hook, Avatar_Component::Direction direction);
+
+  //---------------------------------------------------------------------------
+  // Description : Lines the new state up on the last rendered state
+  //---------------------------------------------------------------------------
+  void Align_Avatar_State(Avatar_State_Transitions::Alignment alignment);
 };
 }  // namespace Tunnelour
 #endif  // TUNNELOUR_AVATAR_STATE_CONTROLLER_H_
@@ -0,0 +1,92 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_AVATAR_STATE_NAMES_H_
+#define TUNNELOUR_AVATAR_STATE_NAMES_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include "Avatar_Component.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Avatar_State_Names interns the state names read from the
+//                animation tilesets into the ids kept in
+//                Avatar_Component::Avatar_State, so state transitions
+//                compare integers. The names are only looked up again for
+//                display and error messages.
+//-----------------------------------------------------------------------------
+class Avatar_State_Names {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Avatar_State_Names();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the current instance of this Avatar_State_Names
+  //---------------------------------------------------------------------------
+  static Avatar_State_Names* GetInstance();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the id of a state name, a name which is not one of
+  //               Avatar_Component::State_ID is given the next free id.
+  //               An empty name is NO_STATE.
+  //---------------------------------------------------------------------------
+  unsigned int GetStateID(std::string const &name);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the name of a state id, empty for unknown ids
+  //---------------------------------------------------------------------------
+  std::string const & GetStateName(unsigned int state_id);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the id of the Charlie parent state a command state
+  //               runs in, e.g. Jumping to Charlie_Jumping.
+  //---------------------------------------------------------------------------
+  unsigned int GetParentStateID(unsigned int state_id);
+
+  //---------------------------------------------------------------------------
+  // Description : Converts between directions and their names, "Right",
+  //               "Left" or empty.
+  //---------------------------------------------------------------------------
+  static Avatar_Component::Direction GetDirection(std::string const &name);
+  static std::string GetDirectionName(Avatar_Component::Direction direction);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the id of a collision block name from a tileset
+  //---------------------------------------------------------------------------
+  static Avatar_Component::Collision_Block_ID GetCollisionBlockID(std::string const &name);
+
+ protected:
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  Avatar_State_Names();
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Current instance of this Singleton
+  //---------------------------------------------------------------------------
+  static Avatar_State_Names* m_instance;
+
+  std::vector<std::string> m_names;
+  std::map<std::string, unsigned int> m_ids;
+  std::vector<unsigned int> m_parent_ids;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_AVATAR_STATE_NAMES_H_
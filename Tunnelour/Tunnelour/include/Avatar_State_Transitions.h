@@ -0,0 +1,190 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_AVATAR_STATE_TRANSITIONS_H_
+#define TUNNELOUR_AVATAR_STATE_TRANSITIONS_H_
+
+#include <d3dx10math.h>
+#include <vector>
+#include "Avatar_Component.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Avatar_State_Transitions is a table of the states an avatar
+//                state controller moves the avatar to, keyed by the current
+//                state, the command, the avatar's contacts and whether the
+//                state's animation has finished. The rules are compiled into
+//                a dense array so finding a transition is a single lookup.
+//-----------------------------------------------------------------------------
+class Avatar_State_Transitions {
+ public:
+  enum Contact {
+    FLOOR_ADJACENT = 1,
+    WALL_COLLIDING = 2,
+    CONTACT_COMBINATIONS = 4
+  };
+
+  enum Frame_Condition {
+    FRAME_INCOMPLETE = 0,
+    FRAME_COMPLETE,
+    ANY_FRAME
+  };
+
+  enum Direction_Source {
+    KEEP_DIRECTION = 0,
+    // The command's direction, or the current one if the command has none
+    COMMAND_DIRECTION
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Which of the last state's collision blocks the new state is
+  //               lined up on
+  //---------------------------------------------------------------------------
+  enum Alignment {
+    NO_ALIGNMENT = 0,
+    ALIGN_ON_LAST_CONTACTING_FOOT,
+    ALIGN_ON_LAST_HAND,
+    ALIGN_ON_LAST_COLLISION_BLOCK,
+    // The bottom corner on the side the avatar faces
+    ALIGN_ON_LAST_FACING_BOTTOM,
+    // The bottom corner on the side the avatar has its back to
+    ALIGN_ON_LAST_BACK_BOTTOM,
+    // The bottom corner on the side the avatar is moving, or facing
+    ALIGN_ON_LAST_LEADING_BOTTOM
+  };
+
+  struct Transition {
+    Transition() : parent_state(Avatar_Component::NO_STATE),
+                   state(Avatar_Component::NO_STATE),
+                   direction_source(KEEP_DIRECTION),
+                   alignment(NO_ALIGNMENT) {
+    }
+    unsigned int parent_state;
+    unsigned int state;
+    Direction_Source direction_source;
+    Alignment alignment;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : What happens to the avatar's velocity when a transition
+  //               leaves or enters a state
+  //---------------------------------------------------------------------------
+  struct State_Hook {
+    State_Hook() : is_setting_velocity(false),
+                   is_keeping_y_velocity(false),
+                   velocity(0, 0) {
+    }
+    State_Hook(float x, float y, bool keep_y_velocity = false) : is_setting_velocity(true),
+                                                                 is_keeping_y_velocity(keep_y_velocity),
+                                                                 velocity(x, y) {
+    }
+    bool is_setting_velocity;
+    bool is_keeping_y_velocity;
+    // x is towards the direction the avatar is facing
+    D3DXVECTOR2 velocity;
+  };
+
+  static const unsigned int ANY_STATE = 0xFFFFFFFF;
+  static const unsigned int ANY_COMMAND = 0xFFFFFFFF;
+  static const int ANY_CONTACTS = -1;
+
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  Avatar_State_Transitions();
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Avatar_State_Transitions();
+
+  //---------------------------------------------------------------------------
+  // Description : Adds a rule, a later rule replaces an earlier one where
+  //               their keys overlap.
+  //---------------------------------------------------------------------------
+  void Add(unsigned int state, unsigned int command, int contacts, Frame_Condition frame, Transition const &transition);
+
+  //---------------------------------------------------------------------------
+  // Description : Adds a rule moving on from a state when its animation
+  //               finishes, whatever the command and contacts, keeping the
+  //               avatar's direction.
+  //---------------------------------------------------------------------------
+  void AddFrameComplete(unsigned int state, unsigned int new_parent_state, unsigned int new_state, Alignment alignment);
+
+  //---------------------------------------------------------------------------
+  // Description : Sets what happens to the velocity when a transition enters
+  //               or leaves the state
+  //---------------------------------------------------------------------------
+  void SetEnterHook(unsigned int state, State_Hook const &hook);
+  void SetExitHook(unsigned int state, State_Hook const &hook);
+
+  //---------------------------------------------------------------------------
+  // Description : Builds the lookup array from the rules
+  //---------------------------------------------------------------------------
+  void Compile();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns whether any rule for the state depends on the
+  //               avatar's contacts, so they are only found when needed.
+  //---------------------------------------------------------------------------
+  bool IsContactSensitive(unsigned int state);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the transition for the key or 0 if there is none
+  //---------------------------------------------------------------------------
+  Transition const * Find(unsigned int state, unsigned int command, unsigned int contacts, bool is_frame_complete);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the hooks of a state, 0 if it has none
+  //---------------------------------------------------------------------------
+  State_Hook const * GetEnterHook(unsigned int state);
+  State_Hook const * GetExitHook(unsigned int state);
+
+ protected:
+
+ private:
+  struct Rule {
+    unsigned int state;
+    unsigned int command;
+    int contacts;
+    Frame_Condition frame;
+    unsigned int transition;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the position of the key in the lookup array
+  //---------------------------------------------------------------------------
+  unsigned int GetTableIndex(unsigned int state, unsigned int command_column, unsigned int contacts, unsigned int frame);
+
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  std::vector<Rule> m_rules;
+  std::vector<Transition> m_transitions;
+  std::vector<State_Hook> m_enter_hooks;
+  std::vector<State_Hook> m_exit_hooks;
+
+  // Commands named by a rule have their own column, every other command
+  // shares column 0.
+  std::vector<unsigned int> m_command_columns;
+  unsigned int m_state_count;
+  unsigned int m_command_count;
+  // Index into m_transitions, or -1
+  std::vector<int> m_table;
+  std::vector<bool> m_is_contact_sensitive;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_AVATAR_STATE_TRANSITIONS_H_
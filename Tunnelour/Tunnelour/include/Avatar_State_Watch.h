@@ -0,0 +1,66 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_AVATAR_STATE_WATCH_H_
+#define TUNNELOUR_AVATAR_STATE_WATCH_H_
+
+#include "Avatar_Component.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Avatar_State_Watch tells whether an avatar's state or last
+//                rendered state has changed since it was last looked at.
+//                Both only move on a real change, not on the command being
+//                set or the state being rendered every frame, so work that
+//                only depends on them, like the level's end conditions, is
+//                skipped while the avatar is idle.
+//-----------------------------------------------------------------------------
+class Avatar_State_Watch {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  Avatar_State_Watch();
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Avatar_State_Watch();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns true the first time it sees the avatar and when
+  //               the avatar's state or last rendered state has changed
+  //               since the last time it returned true
+  //---------------------------------------------------------------------------
+  bool HasChanged(Avatar_Component *avatar);
+
+  //---------------------------------------------------------------------------
+  // Description : Forgets the avatar, so the next HasChanged is true
+  //---------------------------------------------------------------------------
+  void Reset();
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  Avatar_Component *m_avatar;
+  unsigned int m_state_version;
+  unsigned int m_last_rendered_state_version;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_AVATAR_STATE_WATCH_H_
@@ -68,7 +68,18 @@ class Bitmap_Component: public Tunnelour::Frame_Component {
   D3DXVECTOR3 GetVelocity();
 
   //---------------------------------------------------------------------------
-  // Description : Mutator for the Velocity
+  // Description : Accessor for the Velocity in fixed pixels per frame
+  //---------------------------------------------------------------------------
+  Fixed_Point GetFixedVelocity();
+
+  //---------------------------------------------------------------------------
+  // Description : Mutator for the Velocity in fixed pixels per frame
+  //---------------------------------------------------------------------------
+  void SetFixedVelocity(Fixed_Point velocity);
+
+  //---------------------------------------------------------------------------
+  // Description : Mutator for the Velocity, snapped to the nearest fixed
+  //               pixel per frame so moves add up exactly.
   //---------------------------------------------------------------------------
   void SetVelocity(D3DXVECTOR3 velocity);
 
@@ -92,6 +103,35 @@ class Bitmap_Component: public Tunnelour::Frame_Component {
   //---------------------------------------------------------------------------
   void SetTransparency(float transparency);
 
+  //---------------------------------------------------------------------------
+  // Description : Returns the area of the texture this bitmap shows as the
+  //               top left (x, y) and size (z, w) in texture coordinates.
+  //               The frame's own texture coordinates run from 0 to 1 and
+  //               are mapped onto this area by the vertex shader, so moving
+  //               top_left_position never requires the frame to be rebuilt.
+  //               A bitmap without a texture_size shows the whole texture.
+  //---------------------------------------------------------------------------
+  virtual D3DXVECTOR4 GetUVRect();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns true if every texel this bitmap draws is fully
+  //               opaque, so it can be drawn with blending off and may hide
+  //               whatever lies behind it.
+  //---------------------------------------------------------------------------
+  virtual bool IsOpaque();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns true if this bitmap is positioned in screen space,
+  //               i.e. relative to the centre of the screen and not moved by
+  //               the camera.
+  //---------------------------------------------------------------------------
+  bool IsScreenSpace();
+
+  //---------------------------------------------------------------------------
+  // Description : Mutator for Screen Space, must be set before the component
+  //               is added to the model.
+  //---------------------------------------------------------------------------
+  void SetScreenSpace(bool is_screen_space);
 
  protected:
   //---------------------------------------------------------------------------
@@ -99,7 +139,9 @@ class Bitmap_Component: public Tunnelour::Frame_Component {
   //---------------------------------------------------------------------------
   Texture * m_texture;
   D3DXVECTOR3 m_velocity;
+  Fixed_Point m_fixed_velocity;
   float m_angle;
+  bool m_is_screen_space;
 
  private:
 };  // class Bitmap_Component
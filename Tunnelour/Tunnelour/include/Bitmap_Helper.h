@@ -16,6 +16,7 @@
 #ifndef TUNNELOUR_BITMAP_HELPER_H_
 #define TUNNELOUR_BITMAP_HELPER_H_
 
+#include "AABB.h"
 #include "Bitmap_Component.h"
 #include "Avatar_Component.h"
 #include "Tileset_Helper.h"
@@ -39,47 +40,61 @@ class Bitmap_Helper {
   //---------------------------------------------------------------------------
   virtual ~Bitmap_Helper();
 
+  //---------------------------------------------------------------------------
+  // Description : Returns the bounds of a tile
+  //---------------------------------------------------------------------------
+  static AABB GetAABB(Tunnelour::Bitmap_Component* Tile);
+
   static bool DoTheseTilesIntersect(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB);
+  static bool DoTheseTilesIntersect(AABB const &TileA, AABB const &TileB);
 
   static std::string DoesTileACollideOnTheTopOrBottom(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB);
+  static std::string DoesTileACollideOnTheTopOrBottom(AABB const &TileA, AABB const &TileB);
 
   static std::string DoesTileACollideOnTheRightOrLeft(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB);
+  static std::string DoesTileACollideOnTheRightOrLeft(AABB const &TileA, AABB const &TileB);
 
   //---------------------------------------------------------------------------
   // Description : Returns whether the bounds of one tile intersects or is
   //             : tangent with the other in the Y dimension
   //---------------------------------------------------------------------------
   static bool DoTheseTilesYCollide(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB);
+  static bool DoTheseTilesYCollide(AABB const &TileA, AABB const &TileB);
   
   //---------------------------------------------------------------------------
   // Description : Returns whether the bounds of one tile intersects or is
   //             : tangent with the other in the Y dimension
   //---------------------------------------------------------------------------
   static bool AreTheseTilesYAdjacent(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB);
+  static bool AreTheseTilesYAdjacent(AABB const &TileA, AABB const &TileB);
 
   //---------------------------------------------------------------------------
   // Description : Returns whether the bounds of one tile intersects or is
   //             : tangent with the other in the X dimension
   //---------------------------------------------------------------------------
   static bool DoTheseTilesXCollide(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB);
+  static bool DoTheseTilesXCollide(AABB const &TileA, AABB const &TileB);
 
   //---------------------------------------------------------------------------
   // Description : Returns whether the bounds of one tile intersects or is
   //             : tangent with the other in the Y dimension
   //---------------------------------------------------------------------------
   static bool AreTheseTilesXAdjacent(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB);
+  static bool AreTheseTilesXAdjacent(AABB const &TileA, AABB const &TileB);
 
   //---------------------------------------------------------------------------
   // Description : Returns whether the bounds of one tile is tangent with
   //             : the other in the X dimension but only on the Left side
   //---------------------------------------------------------------------------
   static bool AreTheseTilesLeftXAdjacent(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB);
+  static bool AreTheseTilesLeftXAdjacent(AABB const &TileA, AABB const &TileB);
 
   //---------------------------------------------------------------------------
   // Description : Returns whether the bounds of one tile is tangent with
   //             : the other in the X dimension but only on the Right side
   //---------------------------------------------------------------------------
   static bool AreTheseTilesRightXAdjacent(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB);
+  static bool AreTheseTilesRightXAdjacent(AABB const &TileA, AABB const &TileB);
 
   //---------------------------------------------------------------------------
   // Description : Creates a bitmap component of the given avatar collision
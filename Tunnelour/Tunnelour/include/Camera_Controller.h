@@ -23,6 +23,7 @@
 #include "Avatar_Component.h"
 #include "Controller.h"
 #include "Camera_Component.h"
+#include "Tile_Class_Index_Component.h"
 
 namespace Tunnelour {
 //-----------------------------------------------------------------------------
@@ -31,8 +32,7 @@ namespace Tunnelour {
 //              : and movement of the camera_component.
 //-----------------------------------------------------------------------------
 class Camera_Controller: public Controller,
-                         public Component::Component_Observer,
-                         public Component_Composite::Component_Composite_Type_Observer {
+                         public Component::Component_Observer {
  public:
   //---------------------------------------------------------------------------
   // Description : Constructor
@@ -59,21 +59,6 @@ class Camera_Controller: public Controller,
   //---------------------------------------------------------------------------
   virtual void HandleEvent(Tunnelour::Component * const component);
 
-  //---------------------------------------------------------------------------
-  // Description : Called when handling an "Add" call in the model
-  //---------------------------------------------------------------------------
-  virtual void HandleEventAdd(Tunnelour::Component * const component);
-
-  //---------------------------------------------------------------------------
-  // Description : Called when handling a "Remove" call in the model
-  //---------------------------------------------------------------------------
-  virtual void HandleEventRemove(Tunnelour::Component * const component);
-
-  //---------------------------------------------------------------------------
-  // Description : Called when handling an "Add" call in the model
-  //---------------------------------------------------------------------------
-  virtual void HandleEventUpdate(Tunnelour::Component * const component);
-
   //---------------------------------------------------------------------------
   // Description : Returns how far the avatar has traveled in x from
   //               the stationary position.
@@ -109,7 +94,7 @@ class Camera_Controller: public Controller,
   bool m_is_shaking;
   float m_radius;
   float m_randomAngle;
-  std::vector<Tile_Bitmap*> m_floor_tiles;
+  Tile_Class_Index_Component *m_tile_class_index;
   Bitmap_Component *m_adjacent_floor_tile;
   int m_distance_travelled;
   int m_leash_length;
@@ -21,7 +21,7 @@
 #include "Component.h"
 #include "Game_Settings_Component.h"
 #include "Avatar_Component.h"
-#include "Tile_Bitmap.h"
+#include "Tile_Class_Index_Component.h"
 #include "Input_Component.h"
 
 namespace Tunnelour {
@@ -63,9 +63,9 @@ class Camera_Controller_Mutator: public Component::Component_Mutator  {
   Input_Component* const GetInputComponent();
 
   //-------------------------------------------------------------------------
-  // Description : Accessor for the Floor Tiles
+  // Description : Accessor for the Tile_Class_Index_Component
   //-------------------------------------------------------------------------
-  std::vector<Tile_Bitmap*> GetFloorTiles();
+  Tile_Class_Index_Component* const GetTileClassIndex();
 
   //-------------------------------------------------------------------------
   // Description : Returns whether this mutator was successful
@@ -76,10 +76,11 @@ class Camera_Controller_Mutator: public Component::Component_Mutator  {
   bool m_found_game_settings;
   bool m_found_avatar_component;
   bool m_found_input_component;
+  bool m_found_tile_class_index;
   Game_Settings_Component * m_game_settings;
   Avatar_Component * m_avatar;
   Input_Component *m_input;
-  std::vector<Tile_Bitmap*> m_floor_tiles;
+  Tile_Class_Index_Component *m_tile_class_index;
 };
 }  // namespace Tunnelour
 #endif  // TUNNELOUR_CAMERA_CONTROLLER_MUTATOR_H_
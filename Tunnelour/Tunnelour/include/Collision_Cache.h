@@ -0,0 +1,155 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_COLLISION_CACHE_H_
+#define TUNNELOUR_COLLISION_CACHE_H_
+
+#include <d3dx10math.h>
+#include <vector>
+#include "Avatar_Component.h"
+#include "Avatar_Helper.h"
+#include "Tile_Bitmap.h"
+#include "Tile_Grid.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Collision_Cache remembers the answers to the avatar
+//                collision queries in Avatar_Helper. An answer is reused
+//                until the avatar moves, changes state or the tiles change,
+//                so the camera and every avatar state controller asking the
+//                same question in one tick only pay for it once.
+//-----------------------------------------------------------------------------
+class Collision_Cache {
+ public:
+  enum Query_Type {
+    FLOOR_ADJACENT = 0,
+    WALL_COLLIDING,
+    FLOOR_COLLIDING,
+    LEDGE_GRAB,
+    QUERY_TYPE_COUNT
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Everything a collision query's answer depends on
+  //---------------------------------------------------------------------------
+  struct Query_Key {
+    Avatar_Component *avatar;
+    unsigned int avatar_state_version;
+    unsigned int avatar_last_rendered_state_version;
+    // 0 unless the answer depends on the command
+    unsigned int avatar_command_version;
+    Fixed_Point position;
+    Fixed_Point last_rendered_position;
+    D3DXVECTOR2 size;
+    Tile_Grid *tiles;
+    unsigned int tiles_version;
+
+    bool operator==(const Query_Key& rhs) const {
+      return (avatar == rhs.avatar &&
+              avatar_state_version == rhs.avatar_state_version &&
+              avatar_last_rendered_state_version == rhs.avatar_last_rendered_state_version &&
+              avatar_command_version == rhs.avatar_command_version &&
+              position == rhs.position &&
+              last_rendered_position == rhs.last_rendered_position &&
+              size == rhs.size &&
+              tiles == rhs.tiles &&
+              tiles_version == rhs.tiles_version);
+    }
+  };
+
+  struct Query_Result {
+    bool is_colliding;
+    std::vector<Tile_Bitmap*> tiles;
+    std::vector<Avatar_Helper::Tile_Collision> collisions;
+  };
+
+  struct Statistics {
+    unsigned int hits;
+    unsigned int misses;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Collision_Cache();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the current instance of this Collision_Cache
+  //---------------------------------------------------------------------------
+  static Collision_Cache* GetInstance();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the key for a query of the type about the avatar
+  //               and tiles. Only ledge grabs depend on the command, so only
+  //               their keys change with it.
+  //---------------------------------------------------------------------------
+  static Query_Key GetKey(Query_Type type, Avatar_Component *avatar, Tile_Grid *tiles);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the remembered answer to the query or 0 if there
+  //               is none, counting a hit or a miss.
+  //---------------------------------------------------------------------------
+  Query_Result const * Find(Query_Type type, Query_Key const &key);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns an empty result to store the answer to the query
+  //               in, replacing the oldest answer of that type.
+  //---------------------------------------------------------------------------
+  Query_Result * Store(Query_Type type, Query_Key const &key);
+
+  //---------------------------------------------------------------------------
+  // Description : Forgets every answer
+  //---------------------------------------------------------------------------
+  void Clear();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of hits and misses since the last reset
+  //---------------------------------------------------------------------------
+  Statistics GetStatistics();
+
+  void ResetStatistics();
+
+ protected:
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  Collision_Cache();
+
+ private:
+  struct Entry {
+    bool is_valid;
+    Query_Key key;
+    Query_Result result;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : A state controller may ask the same question before and
+  //               after nudging the avatar in one tick, so a few answers of
+  //               each type are kept.
+  //---------------------------------------------------------------------------
+  static const unsigned int ENTRIES_PER_QUERY_TYPE = 4;
+
+  //---------------------------------------------------------------------------
+  // Description : Current instance of this Singleton
+  //---------------------------------------------------------------------------
+  static Collision_Cache* m_instance;
+
+  Entry m_entries[QUERY_TYPE_COUNT][ENTRIES_PER_QUERY_TYPE];
+  unsigned int m_next_entry[QUERY_TYPE_COUNT];
+  Statistics m_statistics;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_COLLISION_CACHE_H_
@@ -150,6 +150,52 @@ class Debug_Data_Display_Controller: public Controller {
   //---------------------------------------------------------------------------
   void UpdateAvatarSecondsPastDisplay();
 
+  //---------------------------------------------------------------------------
+  // Description : Creates the collision cache hits display
+  //---------------------------------------------------------------------------
+  void CreateCollisionCacheDisplay();
+
+  //---------------------------------------------------------------------------
+  // Description : Updates the collision cache hits display
+  //---------------------------------------------------------------------------
+  void UpdateCollisionCacheDisplay();
+
+  //---------------------------------------------------------------------------
+  // Description : Creates the avatar state resolution display
+  //---------------------------------------------------------------------------
+  void CreateStateResolutionDisplay();
+
+  //---------------------------------------------------------------------------
+  // Description : Updates the avatar state resolution display
+  //---------------------------------------------------------------------------
+  void UpdateStateResolutionDisplay();
+
+  //---------------------------------------------------------------------------
+  // Description : Creates the crowd update display
+  //---------------------------------------------------------------------------
+  void CreateCrowdDisplay();
+
+  //---------------------------------------------------------------------------
+  // Description : Updates the crowd update display
+  //---------------------------------------------------------------------------
+  void UpdateCrowdDisplay();
+
+  //---------------------------------------------------------------------------
+  // Description : Creates the level load time display
+  //---------------------------------------------------------------------------
+  void CreateLevelLoadDisplay();
+
+  //---------------------------------------------------------------------------
+  // Description : Updates the level load time display
+  //---------------------------------------------------------------------------
+  void UpdateLevelLoadDisplay();
+
+  //---------------------------------------------------------------------------
+  // Description : Moves the screen space text to the given position if it is
+  //               not already there.
+  //---------------------------------------------------------------------------
+  void SetScreenPosition(Text_Component *text, D3DXVECTOR3 position);
+
   //---------------------------------------------------------------------------
   // Member Variables
   //---------------------------------------------------------------------------
@@ -164,6 +210,10 @@ class Debug_Data_Display_Controller: public Controller {
   Text_Component *m_avatar_jumping_height_display;
   Text_Component *m_avatar_distance_traveled_display;
   Text_Component *m_avatar_seconds_past_display;
+  Text_Component *m_collision_cache_display;
+  Text_Component *m_state_resolution_display;
+  Text_Component *m_crowd_display;
+  Text_Component *m_level_load_display;
   long double m_fps;
   bool m_is_debug_mode;
   Avatar_Component *m_avatar;
@@ -26,6 +26,7 @@
 #include <d3dcommon.h>
 #include <d3d11.h>
 #include <d3dx10math.h>
+#include <d3dx11core.h>
 
 #include <windows.h>
 #include <mmsystem.h>
@@ -78,7 +79,6 @@ class Direct3D11_View : public Tunnelour::View,
     D3DXVECTOR3 *frame_centre;
     D3DXVECTOR3 *scale;
     D3DXVECTOR3 *position;
-    Text_Component::Font *font;
   };
 
   struct Renderables {
@@ -89,6 +89,18 @@ class Direct3D11_View : public Tunnelour::View,
     std::vector<Text_Renderable*> Layer_03;   // Foreground Text (-3)
     std::vector<Bitmap_Renderable*> Layer_04; // Splash, Loading, Menu (-4)
     std::vector<Text_Renderable*> Layer_05;   // Splash, Loading, Menu Text (-5)
+    // Screen space layers, drawn with the HUD view matrix after the world
+    // layer of the same depth.
+    std::vector<Text_Renderable*> HUD_Layer_03;   // Debug Text (-3)
+    std::vector<Bitmap_Renderable*> HUD_Layer_04; // Overlays (-4)
+    std::vector<Text_Renderable*> HUD_Layer_05;   // Overlay Text (-5)
+  };
+
+  // Which bitmaps of a layer Render_Bitmaps draws.
+  enum Bitmap_Pass {
+    ALL_BITMAPS,
+    OPAQUE_BITMAPS,
+    BLENDED_BITMAPS
   };
 
   //---------------------------------------------------------------------------
@@ -131,8 +143,9 @@ class Direct3D11_View : public Tunnelour::View,
   //---------------------------------------------------------------------------
   // Description : Render the components
   //---------------------------------------------------------------------------
-  void Render_Bitmaps(std::vector<Bitmap_Renderable*> renderables,
-                      D3DXMATRIX *viewmatrix);
+  void Render_Bitmaps(std::vector<Bitmap_Renderable*> const &renderables,
+                      D3DXMATRIX *viewmatrix,
+                      Bitmap_Pass pass = ALL_BITMAPS);
 
   //---------------------------------------------------------------------------
   // Description : Render the components
@@ -158,6 +171,36 @@ class Direct3D11_View : public Tunnelour::View,
   void Render_Text(Text_Renderable *text,
                    D3DXMATRIX *viewmatrix);
 
+  //---------------------------------------------------------------------------
+  // Description : Returns how many vertices the buffers of a frame are
+  //               created to hold.
+  //---------------------------------------------------------------------------
+  int Get_Vertex_Capacity(Frame_Component::Frame *frame);
+
+  //---------------------------------------------------------------------------
+  // Description : Rewrites the vertex buffer of a frame from its vertices
+  //---------------------------------------------------------------------------
+  void Update_Vertex_Buffer(Frame_Component::Frame *frame);
+
+  //---------------------------------------------------------------------------
+  // Description : Finds the texture at the path. A texture not yet loaded is
+  //               queued on the texture pump to be decoded on its threads,
+  //               false is returned until it has been uploaded.
+  //---------------------------------------------------------------------------
+  bool Find_Texture(std::wstring const &texture_path, ID3D11ShaderResourceView **out_texture);
+
+  //---------------------------------------------------------------------------
+  // Description : Uploads the textures the pump has decoded until this
+  //               frame's upload budget is spent, and starts the frame's
+  //               upload time from there.
+  //---------------------------------------------------------------------------
+  void Process_Texture_Uploads();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the milliseconds since a performance counter time
+  //---------------------------------------------------------------------------
+  float Get_Milliseconds_Since(INT64 start_time);
+
   //---------------------------------------------------------------------------
   // Description : Turn on Alpha Blending
   //---------------------------------------------------------------------------
@@ -174,6 +217,12 @@ class Direct3D11_View : public Tunnelour::View,
 
   bool IsThisBitmapComponentVisable(Bitmap_Renderable *bitmap);
 
+  //---------------------------------------------------------------------------
+  // Description : Returns true if the bitmap can be drawn with blending off,
+  //               i.e. it is opaque and not being faded.
+  //---------------------------------------------------------------------------
+  bool IsThisBitmapComponentOpaque(Bitmap_Renderable *bitmap);
+
   //---------------------------------------------------------------------------
   // Description : Class Variables
   //---------------------------------------------------------------------------
@@ -195,6 +244,9 @@ class Direct3D11_View : public Tunnelour::View,
   ID3D11BlendState* m_alphaDisableBlendingState;
   D3DXMATRIX m_world;
   D3DXMATRIX m_ortho;
+  // Identity view, screen space components are positioned relative to the
+  // centre of the screen regardless of where the camera is.
+  D3DXMATRIX m_hud_view;
 
   //---------------------------------------------------------------------------
   // Description : Shaders
@@ -208,6 +260,23 @@ class Direct3D11_View : public Tunnelour::View,
   //---------------------------------------------------------------------------
   std::map<std::wstring, ID3D11ShaderResourceView*> m_texture_map;
 
+  //---------------------------------------------------------------------------
+  // Description : A texture being decoded by the texture pump, which fills
+  //               these in when it is done
+  //---------------------------------------------------------------------------
+  struct Pending_Texture {
+    ID3D11ShaderResourceView *texture;
+    HRESULT result;
+  };
+
+  ID3DX11ThreadPump *m_texture_pump;
+  std::map<std::wstring, Pending_Texture> m_pending_textures;
+  // The time spent uploading textures and buffers this frame, once the
+  // budget is spent the rest wait for the next frame
+  float m_upload_time_ms;
+  float m_upload_time_budget_ms;
+  INT64 m_frequency;
+
   Renderables m_renderables;
   Tunnelour::Camera_Component * m_camera;
   Tunnelour::Game_Settings_Component * m_game_settings;
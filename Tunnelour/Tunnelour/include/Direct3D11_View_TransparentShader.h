@@ -37,6 +37,7 @@ class Direct3D11_View_TransparentShader {
     D3DXMATRIX world;
     D3DXMATRIX view;
     D3DXMATRIX projection;
+    D3DXVECTOR4 uv_rect;
   };
 
   struct TransparentBufferType  {
@@ -68,7 +69,8 @@ class Direct3D11_View_TransparentShader {
               D3DXMATRIX view,
               D3DXMATRIX projection,
               ID3D11ShaderResourceView* texture,
-              float blend);
+              float blend,
+              D3DXVECTOR4 uv_rect);
 
   //---------------------------------------------------------------------------
   // Description : Returns whether this class has been initalised
@@ -0,0 +1,117 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_FIXED_PIXEL_H_
+#define TUNNELOUR_FIXED_PIXEL_H_
+
+#include <d3dx10math.h>
+#include <math.h>
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+// Description : A distance in 1/256ths of a pixel. Collision bounds are kept
+//               in these so edges line up exactly and the same moves give
+//               the same contacts on every machine.
+//-----------------------------------------------------------------------------
+typedef int Fixed_Pixel;
+
+//-----------------------------------------------------------------------------
+// Description : A position or velocity in fixed pixels
+//-----------------------------------------------------------------------------
+struct Fixed_Point {
+  Fixed_Pixel x;
+  Fixed_Pixel y;
+
+  Fixed_Point() : x(0), y(0) {}
+  Fixed_Point(Fixed_Pixel fixed_x, Fixed_Pixel fixed_y) : x(fixed_x), y(fixed_y) {}
+
+  bool operator==(Fixed_Point const &other) const {
+    return x == other.x && y == other.y;
+  }
+
+  bool operator!=(Fixed_Point const &other) const {
+    return !(*this == other);
+  }
+
+  Fixed_Point operator+(Fixed_Point const &other) const {
+    return Fixed_Point(x + other.x, y + other.y);
+  }
+
+  Fixed_Point operator-(Fixed_Point const &other) const {
+    return Fixed_Point(x - other.x, y - other.y);
+  }
+};
+
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Fixed_Pixel_Helper converts between pixels and fixed
+//                pixels. Positions and velocities are kept in fixed pixels
+//                and moved by adding fixed pixels, so they never round or
+//                drift however far across a level they go. A float only
+//                holds a fixed pixel exactly under 65536 pixels, so the
+//                float copies kept for rendering are not read back.
+//-----------------------------------------------------------------------------
+class Fixed_Pixel_Helper {
+ public:
+  static const int FRACTION_BITS = 8;
+  static const Fixed_Pixel ONE_PIXEL = 1 << FRACTION_BITS;
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the nearest fixed pixel to a position in pixels
+  //---------------------------------------------------------------------------
+  static Fixed_Pixel FromPixels(float pixels) {
+    return static_cast<Fixed_Pixel>(floor((static_cast<double>(pixels) * ONE_PIXEL) + 0.5));
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns a fixed pixel position in pixels, for rendering
+  //               and the float maths still done in pixels
+  //---------------------------------------------------------------------------
+  static float ToPixels(Fixed_Pixel fixed_pixels) {
+    return static_cast<float>(fixed_pixels) / ONE_PIXEL;
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the position rounded to the nearest fixed pixel
+  //---------------------------------------------------------------------------
+  static float Snap(float pixels) {
+    return ToPixels(FromPixels(pixels));
+  }
+
+  static D3DXVECTOR3 Snap(D3DXVECTOR3 const &position) {
+    return D3DXVECTOR3(Snap(position.x), Snap(position.y), Snap(position.z));
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the nearest fixed point to the x and y of a
+  //               position in pixels
+  //---------------------------------------------------------------------------
+  static Fixed_Point FromPixels(D3DXVECTOR3 const &position) {
+    return Fixed_Point(FromPixels(position.x), FromPixels(position.y));
+  }
+
+  static Fixed_Point FromPixels(D3DXVECTOR2 const &position) {
+    return Fixed_Point(FromPixels(position.x), FromPixels(position.y));
+  }
+
+  //---------------------------------------------------------------------------
+  // Description : Returns a fixed point in pixels, with the given z
+  //---------------------------------------------------------------------------
+  static D3DXVECTOR3 ToPixels(Fixed_Point const &position, float z) {
+    return D3DXVECTOR3(ToPixels(position.x), ToPixels(position.y), z);
+  }
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_FIXED_PIXEL_H_
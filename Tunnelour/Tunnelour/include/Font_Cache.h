@@ -0,0 +1,107 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_FONT_CACHE_H_
+#define TUNNELOUR_FONT_CACHE_H_
+
+#include <map>
+#include <string>
+#include "Frame_Component.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Font_Cache parses each BMFont (.fnt) file once and shares
+//                the resulting glyph tables between every Text_Component
+//                which uses that font.
+//-----------------------------------------------------------------------------
+class Font_Cache {
+ public:
+  struct Raw_Character_Frame {
+    Raw_Character_Frame() : id(-1),
+                            x(-1),
+                            y(-1),
+                            width(-1),
+                            height(-1),
+                            xoffset(-1),
+                            yoffset(-1),
+                            xadvance(-1) {
+    }
+    double id;
+    double x;
+    double y;
+    double width;
+    double height;
+    double xoffset;
+    double yoffset;
+    double xadvance;
+  };
+
+  struct Font {
+    double image_width;
+    double image_height;
+    // This is the distance in pixels between each line of text.
+    double line_height;
+    std::string font_name;
+    std::wstring font_texture_name;
+    Raw_Character_Frame raw_char_frames[256];
+    Frame_Component::Vertex_Type character_frames[256][6];
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Font_Cache();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the current instance of this Font_Cache
+  //---------------------------------------------------------------------------
+  static Font_Cache* GetInstance();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the font loaded from the given .fnt file, the file
+  //               is only parsed the first time it is asked for.
+  //---------------------------------------------------------------------------
+  Font const * GetFont(std::string const &font_file);
+
+ protected:
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  Font_Cache();
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Parses the .fnt file into the font struct
+  //---------------------------------------------------------------------------
+  void Load_Font_Struct(std::string const &font_file, Font *out_font);
+
+  //---------------------------------------------------------------------------
+  // Description : Builds the quad of every character in the font
+  //---------------------------------------------------------------------------
+  void Load_Character_Frames(Font *font);
+
+  //---------------------------------------------------------------------------
+  // Description : Current instance of this Singleton
+  //---------------------------------------------------------------------------
+  static Font_Cache* m_instance;
+
+  //---------------------------------------------------------------------------
+  // Description : Every font loaded so far, keyed by .fnt file path
+  //---------------------------------------------------------------------------
+  std::map<std::string, Font*> m_fonts;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_FONT_CACHE_H_
@@ -20,6 +20,7 @@
 #include <d3dx10math.h>
 #include <d3dx11tex.h>
 #include "Component.h"
+#include "Fixed_Pixel.h"
 
 namespace Tunnelour {
 //-----------------------------------------------------------------------------
@@ -41,6 +42,12 @@ class Frame_Component: public Tunnelour::Component {
     Vertex_Type* vertices;
     ID3D11Buffer * vertex_buffer;
     int vertex_count;
+    // Number of vertices the vertices array (and the vertex buffer) can hold,
+    // 0 means the buffers are sized to vertex_count.
+    int vertex_capacity;
+    // Set when vertices has changed since it was last written to the
+    // vertex buffer.
+    bool is_dirty;
     unsigned int* indices;
     ID3D11Buffer * index_buffer;
     int index_count;
@@ -72,10 +79,26 @@ class Frame_Component: public Tunnelour::Component {
   void SetFrame(Frame * frame);
 
   //---------------------------------------------------------------------------
-  // Description : Accessor for the Position
+  // Description : Accessor for the Position in pixels, for rendering. Moves
+  //               are worked out from GetFixedPosition.
   //---------------------------------------------------------------------------
   D3DXVECTOR3 * const GetPosition();
 
+  //---------------------------------------------------------------------------
+  // Description : Accessor for the Position in fixed pixels
+  //---------------------------------------------------------------------------
+  Fixed_Point GetFixedPosition();
+
+  //---------------------------------------------------------------------------
+  // Description : Mutator for the Position in fixed pixels, z is kept
+  //---------------------------------------------------------------------------
+  void SetFixedPosition(Fixed_Point position);
+
+  //---------------------------------------------------------------------------
+  // Description : Moves the Position by the offset in fixed pixels
+  //---------------------------------------------------------------------------
+  void MoveFixedPosition(Fixed_Point offset);
+
   //---------------------------------------------------------------------------
   // Description : Accessor for the Position
   //---------------------------------------------------------------------------
@@ -87,12 +110,23 @@ class Frame_Component: public Tunnelour::Component {
   D3DXVECTOR3 const GetLastRenderedPosition();
 
   //---------------------------------------------------------------------------
-  // Description : Mutator for the Position
+  // Description : Records the current Position as the last rendered one
+  //---------------------------------------------------------------------------
+  void SetPositionRendered();
+
+  //---------------------------------------------------------------------------
+  // Description : Accessor for the last rendered Position in fixed pixels
+  //---------------------------------------------------------------------------
+  Fixed_Point GetLastRenderedFixedPosition();
+
+  //---------------------------------------------------------------------------
+  // Description : Mutator for the Position, the position is snapped to the
+  //               nearest fixed pixel (see Fixed_Pixel_Helper).
   //---------------------------------------------------------------------------
   void SetPosition(D3DXVECTOR3 position);
 
   //---------------------------------------------------------------------------
-  // Description : Mutator for the Position
+  // Description : Mutator for the Position, snapped as above
   //---------------------------------------------------------------------------
   void SetPosition(float x, float y, float z);
 
@@ -153,6 +187,8 @@ class Frame_Component: public Tunnelour::Component {
   //---------------------------------------------------------------------------
   D3DXVECTOR3 m_position;
   D3DXVECTOR3 m_last_position;
+  Fixed_Point m_fixed_position;
+  Fixed_Point m_fixed_last_position;
   D3DXVECTOR3 m_scale;
   D3DXVECTOR2 m_size;
 
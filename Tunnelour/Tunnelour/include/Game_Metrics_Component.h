@@ -41,6 +41,42 @@ class Game_Metrics_Component: public Tunnelour::Component {
 	    unsigned long startTime;
    };
 
+  //---------------------------------------------------------------------------
+  // Description : How the avatar's state transitions were resolved in the
+  //               last animation tick
+  //---------------------------------------------------------------------------
+  struct State_Resolution_Data {
+    unsigned int transitions;
+    float resolve_time_ms;
+    // The most transitions in one tick and the ticks stopped early by the
+    // transition limit or a state being revisited
+    unsigned int max_transitions;
+    unsigned int cut_short_ticks;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : How long the last animation tick took to step the crowd of
+  //               computer controlled avatars
+  //---------------------------------------------------------------------------
+  struct Crowd_Data {
+    unsigned int avatars;
+    unsigned int threads;
+    float update_time_ms;
+    float avatars_per_ms;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : How long the last full load of a level and the last reset
+  //               of a restarted level took, not counting the frames waited
+  //               between loading steps
+  //---------------------------------------------------------------------------
+  struct Level_Load_Data {
+    float full_load_time_ms;
+    float reset_time_ms;
+    unsigned int full_loads;
+    unsigned int resets;
+  };
+
   //---------------------------------------------------------------------------
   // Description : Constructor
   //---------------------------------------------------------------------------
@@ -86,6 +122,36 @@ class Game_Metrics_Component: public Tunnelour::Component {
   //---------------------------------------------------------------------------
   void SetSecondsPast(long double seconds_past);
 
+  //---------------------------------------------------------------------------
+  // Description : Accessor for the avatar state resolution data
+  //---------------------------------------------------------------------------
+  State_Resolution_Data GetStateResolutionData();
+
+  //---------------------------------------------------------------------------
+  // Description : Mutator for the avatar state resolution data
+  //---------------------------------------------------------------------------
+  void SetStateResolutionData(State_Resolution_Data state_resolution_data);
+
+  //---------------------------------------------------------------------------
+  // Description : Accessor for the crowd data
+  //---------------------------------------------------------------------------
+  Crowd_Data GetCrowdData();
+
+  //---------------------------------------------------------------------------
+  // Description : Mutator for the crowd data
+  //---------------------------------------------------------------------------
+  void SetCrowdData(Crowd_Data crowd_data);
+
+  //---------------------------------------------------------------------------
+  // Description : Accessor for the level load data
+  //---------------------------------------------------------------------------
+  Level_Load_Data GetLevelLoadData();
+
+  //---------------------------------------------------------------------------
+  // Description : Mutator for the level load data
+  //---------------------------------------------------------------------------
+  void SetLevelLoadData(Level_Load_Data level_load_data);
+
  protected:
 
  private:
@@ -95,6 +161,9 @@ class Game_Metrics_Component: public Tunnelour::Component {
   Tunnelour::Game_Metrics_Component::FPS_Data m_fps_data;
   long double m_distance_traveled;
   long double m_seconds_past;
+  State_Resolution_Data m_state_resolution_data;
+  Crowd_Data m_crowd_data;
+  Level_Load_Data m_level_load_data;
 };
 }  // namespace Tunnelour
 #endif  // TUNNELOUR_GAME_METRICS_COMPONENT_H_
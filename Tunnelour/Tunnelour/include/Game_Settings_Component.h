@@ -171,6 +171,17 @@ class Game_Settings_Component: public Tunnelour::Component {
   //---------------------------------------------------------------------------
   bool IsUsingLevelFile();
 
+  //---------------------------------------------------------------------------
+  // Description : Accessor for the number of computer controlled avatars
+  //               started with each level
+  //---------------------------------------------------------------------------
+  unsigned int GetCrowdSize();
+
+  //---------------------------------------------------------------------------
+  // Description : Mutator for the number of computer controlled avatars
+  //---------------------------------------------------------------------------
+  void SetCrowdSize(unsigned int crowd_size);
+
  protected:
 
  private:
@@ -190,6 +201,7 @@ class Game_Settings_Component: public Tunnelour::Component {
   bool m_is_debug_mode;
   bool m_is_camera_following;
   bool m_is_using_level_file;
+  unsigned int m_crowd_size;
 };
 }  // namespace Tunnelour
 #endif  // TUNNELOUR_BACKGROUND_COLOR_COMPONENT_H_
@@ -17,6 +17,7 @@
 #define TUNNELOUR_GEOMETRY_HELPER_H_
 
 #include "D3dx9math.h"
+#include "AABB.h"
 
 namespace Tunnelour {
 //-----------------------------------------------------------------------------
@@ -39,6 +40,18 @@ class Geometry_Helper {
 
   static double WhatsTheDistanceBetweenThesePoints(D3DXVECTOR2 point_1, D3DXVECTOR2 point_2);
 
+  //---------------------------------------------------------------------------
+  // Description : Returns true if the moving box runs into the target while
+  //               moving by displacement. out_time_of_impact is the fraction
+  //               (0 to 1) of the displacement moved before contact and
+  //               out_contact_normal points out of the target face which was
+  //               hit. Boxes which only slide along each other do not
+  //               count. Boxes which already overlap when the move begins
+  //               hit at time 0, the normal pointing out of the side of the
+  //               target the moving box is least far into.
+  //---------------------------------------------------------------------------
+  static bool DoesThisAABBSweepIntoThatAABB(AABB const &moving, D3DXVECTOR2 displacement, AABB const &target, float *out_time_of_impact, D3DXVECTOR2 *out_contact_normal);
+
  protected:
 
  private:
@@ -34,6 +34,7 @@ class Input_Component: public Tunnelour::Component {
      bool IsLeft;
      bool IsDown;
      bool IsUp;
+     bool IsBackspace;
 
      Key_Input() {
        IsSpace = false;
@@ -42,6 +43,7 @@ class Input_Component: public Tunnelour::Component {
        IsLeft = false;
        IsDown = false;
        IsUp = false;
+       IsBackspace = false;
      }
    };
   //---------------------------------------------------------------------------
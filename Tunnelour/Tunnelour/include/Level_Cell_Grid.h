@@ -0,0 +1,118 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_LEVEL_CELL_GRID_H_
+#define TUNNELOUR_LEVEL_CELL_GRID_H_
+
+#include <d3dx10math.h>
+#include <vector>
+#include "Level_Component.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Level_Cell_Grid lays a level's metadata out as a dense grid
+//                of cells, one cell per smallest tile in the level, so a
+//                tile's neighbours are found by index. Each tile's
+//                Tile_Bitmap::Tile_Class mask is worked out from the cells
+//                around it alone, so every tile can be classified in one
+//                pass in any order.
+//-----------------------------------------------------------------------------
+class Level_Cell_Grid {
+ public:
+  enum Cell_Kind {
+    EMPTY = 0,
+    ROCK,
+    TUNNEL
+  };
+
+  struct Tile_Placement {
+    float size;
+    // Centre of the tile
+    D3DXVECTOR2 position;
+    bool is_middleground;
+    bool is_exit;
+    // Top left cell of the tile and how many cells wide it is
+    int row;
+    int column;
+    int span;
+    // Which edges of the level metadata the tile is on
+    unsigned int edge_mask;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  Level_Cell_Grid();
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Level_Cell_Grid();
+
+  //---------------------------------------------------------------------------
+  // Description : Places every tile in the level metadata and fills the
+  //               cells they cover. Tiles smaller than 128 fill a 128 block
+  //               left to right then top to bottom before the line moves on.
+  //---------------------------------------------------------------------------
+  void Build(Level_Component::Level_Metadata const &level_metadata);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of tiles, in the metadata's order
+  //---------------------------------------------------------------------------
+  unsigned int GetTileCount();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns where a tile goes
+  //---------------------------------------------------------------------------
+  Tile_Placement const & GetTilePlacement(unsigned int index);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the edge, wall, floor, roof, end and exit classes
+  //               of a tile. Only reads the grid so tiles can be classified
+  //               at the same time from different threads.
+  //---------------------------------------------------------------------------
+  unsigned int GetTileClassMask(unsigned int index);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the kind of a cell, EMPTY outside the grid
+  //---------------------------------------------------------------------------
+  Cell_Kind GetCellKind(int row, int column);
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Returns the kind of the neighbour of a tile, the offsets
+  //               are in tiles of the same size, up is -1.
+  //---------------------------------------------------------------------------
+  Cell_Kind GetNeighbourKind(Tile_Placement const &tile, int row_offset, int column_offset);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the smallest tile size in the level
+  //---------------------------------------------------------------------------
+  static float GetSmallestTileSize(Level_Component::Level_Metadata const &level_metadata);
+
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  float m_cell_size;
+  int m_rows;
+  int m_columns;
+  std::vector<unsigned char> m_cells;
+  std::vector<Tile_Placement> m_tiles;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_LEVEL_CELL_GRID_H_
@@ -16,6 +16,7 @@
 #ifndef TUNNELOUR_LEVEL_COMPONENT_H_
 #define TUNNELOUR_LEVEL_COMPONENT_H_
 
+#include "Avatar_Component.h"
 #include "Component.h"
 #include <vector>
 
@@ -48,9 +49,9 @@ class Level_Component: public Tunnelour::Component {
   };
 
   struct End_Condition_Avatar_State: public Condition {
-    std::string avatar_state;
+    unsigned int avatar_state;
     bool when_state_complete;
-    std::string avatar_direction;
+    Avatar_Component::Direction avatar_direction;
   };
 
   struct End_Condition {
@@ -32,6 +32,8 @@
 #include "Game_Metrics_Controller.h"
 #include "Score_Display_Controller.h"
 #include "Input_Component.h"
+#include "Trigger_Volumes.h"
+#include "Avatar_State_Watch.h"
 
 namespace Tunnelour {
 //-----------------------------------------------------------------------------
@@ -68,9 +70,26 @@ class Level_Controller: public Controller {
   void LoadLevelMetadata();
   Level_Component::Level_Metadata LoadLevelMetadataIntoStruct(std::string metadata_path);
   void LoadLevelCSVIntoStruct(std::string metadata_path, Level_Component::Level_Metadata *out_struct);
-  Avatar_Component::Avatar_Collision_Block GetNamedCollisionBlock(std::string id, std::list<Avatar_Component::Avatar_Collision_Block> avatar_collision_blocks);
   Level_Component::Level_Metadata GetNamedLevel(std::string level_name);
 
+  //---------------------------------------------------------------------------
+  // Description : Registers the bounds of the level's exit tiles as trigger
+  //               volumes, entering one ends the level.
+  //---------------------------------------------------------------------------
+  void CreateExitVolumes();
+
+  //---------------------------------------------------------------------------
+  // Description : Resets the metrics then the avatar, camera and crowd. A
+  //               restarted level puts the avatar back to its checkpoint.
+  //---------------------------------------------------------------------------
+  void ResetDynamicState();
+
+  //---------------------------------------------------------------------------
+  // Description : Records how long the level took to load, or to reset when
+  //               it was restarted, in the Game_Metrics_Component
+  //---------------------------------------------------------------------------
+  void RecordLevelLoadTime(float load_time_ms);
+
   const int m_z_position;
 
   Avatar_Component *m_avatar;
@@ -108,8 +127,18 @@ class Level_Controller: public Controller {
   bool m_has_splash_screen_faded;
 
   bool m_has_avatar_been_reset;
-
-  std::vector<Tile_Bitmap*> m_exit_tiles;
+  // Restarting the level being played keeps its tiles and GPU resources
+  bool m_is_resetting_level;
+  // The time spent loading so far, summed over the frames it is spread over
+  float m_load_time_ms;
+  // The most time a frame spends adding the loaded level to the model
+  float m_load_time_budget_ms;
+
+  Trigger_Volumes m_exit_volumes;
+
+  // The end conditions only read the avatar's state and last rendered
+  // state, so they are only checked again once one of them has changed
+  Avatar_State_Watch m_end_conditions_watch;
 };
 }  // namespace Tunnelour
 #endif  // TUNNELOUR_LEVEL_CONTROLLER_H_
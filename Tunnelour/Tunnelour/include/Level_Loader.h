@@ -0,0 +1,116 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#ifndef TUNNELOUR_LEVEL_LOADER_H_
+#define TUNNELOUR_LEVEL_LOADER_H_
+
+#include <atomic>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Level_Cell_Grid.h"
+#include "Level_Component.h"
+#include "Tileset_Helper.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Level_Loader does the slow part of loading a level on a
+//                thread of its own. It parses the tileset metadata files,
+//                lays the level out in a Level_Cell_Grid and classifies
+//                every tile, while the main thread keeps drawing the level
+//                transition. None of this touches the model or the device.
+//                Once it has finished the Level_Tile_Controller makes the
+//                tiles from the layout on the main thread.
+//-----------------------------------------------------------------------------
+class Level_Loader {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Everything worked out for a level, the class mask of each
+  //               tile is in the grid's tile order
+  //---------------------------------------------------------------------------
+  struct Level_Layout {
+    std::vector<Tileset_Helper::Tileset_Metadata> tilesets;
+    Level_Cell_Grid grid;
+    std::vector<unsigned int> class_masks;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  Level_Loader();
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor, waits for a load still running
+  //---------------------------------------------------------------------------
+  virtual ~Level_Loader();
+
+  //---------------------------------------------------------------------------
+  // Description : Starts loading the level and the tilesets at the paths on
+  //               the loader's thread, forgetting any earlier load
+  //---------------------------------------------------------------------------
+  void Start(Level_Component::Level_Metadata const &level_metadata, std::vector<std::string> const &tileset_paths);
+
+  //---------------------------------------------------------------------------
+  // Description : Has a load been started since the loader was last cleared
+  //---------------------------------------------------------------------------
+  bool IsStarted();
+
+  //---------------------------------------------------------------------------
+  // Description : Has the loader's thread finished, true if nothing was
+  //               started. Does not wait.
+  //---------------------------------------------------------------------------
+  bool IsFinished();
+
+  //---------------------------------------------------------------------------
+  // Description : Waits for the load to finish and returns the layout.
+  //               Throws what the loader's thread threw.
+  //---------------------------------------------------------------------------
+  Level_Layout & Wait();
+
+  //---------------------------------------------------------------------------
+  // Description : Waits for a load still running and forgets the layout
+  //---------------------------------------------------------------------------
+  void Clear();
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Runs on the loader's thread
+  //---------------------------------------------------------------------------
+  void Load();
+
+  //---------------------------------------------------------------------------
+  // Description : Waits for the loader's thread if it is running
+  //---------------------------------------------------------------------------
+  void Join();
+
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  std::thread m_thread;
+  std::atomic<bool> m_is_finished;
+  bool m_is_started;
+  // Copies owned by the loader's thread until it finishes
+  Level_Component::Level_Metadata m_level_metadata;
+  std::vector<std::string> m_tileset_paths;
+  Level_Layout m_layout;
+  std::exception_ptr m_error;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_LEVEL_LOADER_H_
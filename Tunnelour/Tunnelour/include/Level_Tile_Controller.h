@@ -27,6 +27,7 @@
 #include "Camera_Component.h"
 #include "Tileset_Helper.h"
 #include "Level_Component.h"
+#include "Level_Loader.h"
 
 namespace Tunnelour {
 //-----------------------------------------------------------------------------
@@ -120,11 +121,27 @@ class Level_Tile_Controller: public Controller,
   //---------------------------------------------------------------------------
   virtual bool Run();
 
+  //---------------------------------------------------------------------------
+  // Description : Starts parsing the tilesets and laying out the current
+  //               level on the level loader's thread
+  //---------------------------------------------------------------------------
+  virtual void StartLoadingLevel();
+
+  //---------------------------------------------------------------------------
+  // Description : Has the level loader finished, so CreateLevel won't wait
+  //---------------------------------------------------------------------------
+  virtual bool IsLevelLoaded();
+
   //---------------------------------------------------------------------------
   // Description : Create the tiles for the current level
   //---------------------------------------------------------------------------
   virtual void CreateLevel();
-  virtual void AddLevelToModel();
+
+  //---------------------------------------------------------------------------
+  // Description : Adds the created tiles to the model until the time budget
+  //               is spent, returns true once every tile has been added
+  //---------------------------------------------------------------------------
+  virtual bool AddLevelToModel(float time_budget_ms);
   virtual void ShowLevel();
   virtual void HideLevel();
   virtual void DestroyLevel();
@@ -141,14 +158,26 @@ class Level_Tile_Controller: public Controller,
   Tileset_Helper::Subset m_current_middleground_subset;
   Tileset_Helper::Subset m_current_background_subset;
   void LoadTilesetMetadata();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the paths of the tileset metadata files to load
+  //---------------------------------------------------------------------------
+  std::vector<std::string> GetTilesetPaths();
   Tileset_Helper::Tileset_Metadata GetNamedTileset(std::string name);
-  Tileset_Helper::Subset GetCurrentMiddlegroundSubset();
-  Tileset_Helper::Subset GetCurrentMiddlegroundSubsetType(Level_Tile_Controller::Middleground_Tile_Type types);
+
+  //---------------------------------------------------------------------------
+  // Description : How the subsets of a tileset are picked and named, these
+  //               and ResetMiddlegroundTileTexture and SwitchTileset are
+  //               overridden for tilesets whose subset types aren't written
+  //               between bars
+  //---------------------------------------------------------------------------
+  virtual Tileset_Helper::Subset GetCurrentMiddlegroundSubset();
+  virtual Tileset_Helper::Subset GetCurrentMiddlegroundSubsetType(Level_Tile_Controller::Middleground_Tile_Type types);
   Tileset_Helper::Subset GetCurrentBackgroundSubsetType(Level_Tile_Controller::Background_Tile_Type types);
-  Middleground_Tile_Type ParseSubsetTypesFromString(std::string type);
-  Background_Tile_Type ParseSubsetBackgroundTypesFromString(std::string type);
+  virtual Middleground_Tile_Type ParseSubsetTypesFromString(std::string type);
+  virtual Background_Tile_Type ParseSubsetBackgroundTypesFromString(std::string type);
   Tileset_Helper::Subset GetCurrentNamedSubset(std::string name);
-  Tileset_Helper::Subset GetCurrentBackgroundSubset();
+  virtual Tileset_Helper::Subset GetCurrentBackgroundSubset();
   Tile_Bitmap* CreateMiddlegroundTile(float base_tile_size);
   Tile_Bitmap* CreateBackgroundTile(float base_tile_size);
   Tileset_Helper::Line GetCurrentSizedMiddlegroundLine(float size);
@@ -158,7 +187,7 @@ class Level_Tile_Controller: public Controller,
   //---------------------------------------------------------------------------
   // Description : Resets a tiles texture to 0 for switching tilesets.
   //---------------------------------------------------------------------------
-  void ResetMiddlegroundTileTexture(Tile_Bitmap *out_tile);
+  virtual void ResetMiddlegroundTileTexture(Tile_Bitmap *out_tile);
   void ResetBackgroundTileTexture(Tile_Bitmap *out_tile);
   std::vector<Tile_Bitmap*> m_left_edge_tiles;
   std::vector<Tile_Bitmap*> m_right_edge_tiles;
@@ -171,7 +200,7 @@ class Level_Tile_Controller: public Controller,
   //---------------------------------------------------------------------------
   // Description : Switches the tileset from Debug to Dirt and vise versa
   //---------------------------------------------------------------------------
-  void SwitchTileset();
+  virtual void SwitchTileset();
 
   std::vector<Tile_Bitmap*> m_middleground_tiles;
   std::vector<Tile_Bitmap*> m_background_tiles;
@@ -191,11 +220,10 @@ class Level_Tile_Controller: public Controller,
   std::string m_current_level_name;
   std::vector<Tile_Bitmap*> m_level_tiles;
 
-  float m_blocksize_x;
-  float m_blocksize_y;
-  std::vector<std::vector<Tile_Bitmap*>> m_block_tile_lines;
-  std::vector<Tile_Bitmap*> m_block_tile_line;
-  Tile_Bitmap* m_back_block;
+  Level_Loader m_level_loader;
+  // How many of the level's tiles have been added to the model so far
+  unsigned int m_tiles_added_to_model;
+
  private:
 };
 }  // namespace Tunnelour
@@ -37,8 +37,7 @@ namespace Tunnelour {
 //  Description : This controller is responsible for the generation of the
 //                introduction to Tunnelor
 //-----------------------------------------------------------------------------
-class Level_Transition_Controller: public Controller,
-                                   public Component::Component_Observer {
+class Level_Transition_Controller: public Controller {
  public:
   //---------------------------------------------------------------------------
   // Description : Constructor
@@ -77,8 +76,6 @@ class Level_Transition_Controller: public Controller,
 
   void SetNextLevelBlurbText(std::string next_level_blurb);
 
-  virtual void HandleEvent(Tunnelour::Component * const component);
-
  protected:
 
  private:
@@ -95,7 +92,6 @@ class Level_Transition_Controller: public Controller,
   // Description : Switches the tileset from Debug to Dirt and vise versa
   //---------------------------------------------------------------------------
   Game_Settings_Component* m_game_settings;
-  Camera_Component *m_camera;
   Level_Component *m_level;
   std::string m_tileset_filename;
   bool m_is_debug_mode;
@@ -46,6 +46,17 @@ class Procedural_Level_Tile_Controller: public Tunnelour::Level_Tile_Controller
   //---------------------------------------------------------------------------
   virtual bool Run();
 
+  //---------------------------------------------------------------------------
+  // Description : The level is generated in CreateLevel, so there is nothing
+  //               for the level loader to start
+  //---------------------------------------------------------------------------
+  virtual void StartLoadingLevel();
+
+  //---------------------------------------------------------------------------
+  // Description : Always true, nothing is loaded ahead of CreateLevel
+  //---------------------------------------------------------------------------
+  virtual bool IsLevelLoaded();
+
   virtual void CreateLevel();
 
   virtual void HandleEvent(Tunnelour::Component * const component);
@@ -53,7 +64,11 @@ class Procedural_Level_Tile_Controller: public Tunnelour::Level_Tile_Controller
   virtual void AddTilesToModel(std::vector<Tile_Bitmap*> tiles);
   virtual void RemoveTilesFromModel(std::vector<Tile_Bitmap*> tiles);
 
-  virtual void AddLevelToModel();
+  //---------------------------------------------------------------------------
+  // Description : The generated tiles are added as they are made, so there
+  //               is nothing left to add
+  //---------------------------------------------------------------------------
+  virtual bool AddLevelToModel(float time_budget_ms);
   virtual void DestroyLevel();
 
  protected:
@@ -37,8 +37,7 @@ namespace Tunnelour {
 //  Description : This controller is responsible for the generation of the
 //                screen which displays the score to the user
 //-----------------------------------------------------------------------------
-class Score_Display_Controller: public Controller,
-                                public Component::Component_Observer {
+class Score_Display_Controller: public Controller {
  public:
   //---------------------------------------------------------------------------
   // Description : Constructor
@@ -65,11 +64,6 @@ class Score_Display_Controller: public Controller,
   //---------------------------------------------------------------------------
   bool IsFading();
 
-  //---------------------------------------------------------------------------
-  // Description : Handles whether the camera has moved since run
-  //---------------------------------------------------------------------------
-  virtual void HandleEvent(Tunnelour::Component * const component);
-
  protected:
 
  private:
@@ -107,7 +101,6 @@ class Score_Display_Controller: public Controller,
   // Private Variables
   //---------------------------------------------------------------------------
   Game_Settings_Component* m_game_settings;
-  Camera_Component *m_camera;
   Level_Component *m_level;
   Input_Component *m_input;
   Game_Metrics_Component *m_game_metrics;
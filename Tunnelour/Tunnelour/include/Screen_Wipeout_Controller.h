@@ -37,8 +37,7 @@ namespace Tunnelour {
 //  Description : This controller is responsible for the generation of the
 //                tunnelour introduction.
 //-----------------------------------------------------------------------------
-class Screen_Wipeout_Controller: public Controller,
-                                 public Component::Component_Observer {
+class Screen_Wipeout_Controller: public Controller {
  public:
   //---------------------------------------------------------------------------
   // Description : Constructor
@@ -60,8 +59,6 @@ class Screen_Wipeout_Controller: public Controller,
   //---------------------------------------------------------------------------
   virtual bool Run();
 
-  virtual void HandleEvent(Tunnelour::Component * const component);
-
  protected:
 
  private:
@@ -87,7 +84,6 @@ class Screen_Wipeout_Controller: public Controller,
   Tileset_Helper::Subset m_current_tileset_subset;
 
   Game_Settings_Component* m_game_settings;
-  Camera_Component *m_camera;
 
   std::string m_tileset_filename;
   std::string m_black_metadata_file_path;
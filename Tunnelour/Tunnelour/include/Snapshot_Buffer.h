@@ -0,0 +1,143 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#ifndef TUNNELOUR_SNAPSHOT_BUFFER_H_
+#define TUNNELOUR_SNAPSHOT_BUFFER_H_
+
+#include <vector>
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Snapshot_Buffer keeps the most recent snapshots of the game
+//                in a fixed number of bytes, each snapshot being the same
+//                number of integer fields. A snapshot is stored as the
+//                fields which changed since the one before and by how much,
+//                in as few bytes as the changes need, so a tick where little
+//                moves costs a few bytes. Every so often a snapshot is stored
+//                whole as a keyframe, decoding starts from the nearest one.
+//                Once the bytes are full the oldest keyframe and the
+//                snapshots after it are dropped to make room.
+//-----------------------------------------------------------------------------
+class Snapshot_Buffer {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Constructor, throws if the bytes cannot hold two
+  //               keyframes' worth of snapshots changing every field.
+  //---------------------------------------------------------------------------
+  Snapshot_Buffer(unsigned int field_count, unsigned int byte_capacity, unsigned int keyframe_interval);
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Snapshot_Buffer();
+
+  //---------------------------------------------------------------------------
+  // Description : Adds a snapshot of field_count fields as the newest
+  //---------------------------------------------------------------------------
+  void Push(int const *fields);
+
+  //---------------------------------------------------------------------------
+  // Description : Copies the snapshot pushed ticks_ago pushes before the
+  //               newest into out_fields, returns false if it has been
+  //               dropped or was never pushed.
+  //---------------------------------------------------------------------------
+  bool Get(unsigned int ticks_ago, int *out_fields);
+
+  //---------------------------------------------------------------------------
+  // Description : As Get but also drops every snapshot newer than the one
+  //               returned, so it becomes the newest.
+  //---------------------------------------------------------------------------
+  bool Rewind(unsigned int ticks_ago, int *out_fields);
+
+  //---------------------------------------------------------------------------
+  // Description : Drops every snapshot
+  //---------------------------------------------------------------------------
+  void Clear();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of snapshots which can be got
+  //---------------------------------------------------------------------------
+  unsigned int GetSize();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of bytes the snapshots take up
+  //---------------------------------------------------------------------------
+  unsigned int GetBytesUsed();
+
+ protected:
+
+ private:
+  struct Keyframe {
+    // The number of snapshots pushed before it since the buffer was cleared
+    unsigned int sequence;
+    unsigned int offset;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the most bytes one snapshot can take
+  //---------------------------------------------------------------------------
+  unsigned int GetMaxRecordSize();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the keyframe at the index, 0 being the oldest
+  //---------------------------------------------------------------------------
+  Keyframe & GetKeyframe(unsigned int index);
+
+  //---------------------------------------------------------------------------
+  // Description : Drops the oldest keyframe and the snapshots up to the next
+  //---------------------------------------------------------------------------
+  void DropOldestKeyframe();
+
+  //---------------------------------------------------------------------------
+  // Description : Decodes the snapshot at the sequence into out_fields and
+  //               returns the offset just after it
+  //---------------------------------------------------------------------------
+  unsigned int Decode(unsigned int sequence, int *out_fields);
+
+  //---------------------------------------------------------------------------
+  // Description : Writes a number as 7 bits a byte, low bits first, with the
+  //               top bit of each byte set if another byte follows
+  //---------------------------------------------------------------------------
+  static unsigned int WriteVarint(unsigned int value, unsigned char *out_bytes);
+
+  //---------------------------------------------------------------------------
+  // Description : Reads a number written by WriteVarint from the ring of
+  //               bytes and returns the offset just after it
+  //---------------------------------------------------------------------------
+  unsigned int ReadVarint(unsigned int offset, unsigned int *out_value);
+
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  unsigned int m_field_count;
+  unsigned int m_keyframe_interval;
+  std::vector<unsigned char> m_bytes;
+  // Where the next snapshot is written, and the bytes from the oldest
+  // keyframe up to it
+  unsigned int m_write_offset;
+  unsigned int m_bytes_used;
+  // A ring of the keyframes still in the bytes
+  std::vector<Keyframe> m_keyframes;
+  unsigned int m_first_keyframe;
+  unsigned int m_keyframe_count;
+  unsigned int m_next_sequence;
+  // The newest snapshot, the next one is stored as the changes from it
+  std::vector<int> m_last_fields;
+  std::vector<unsigned char> m_record;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_SNAPSHOT_BUFFER_H_
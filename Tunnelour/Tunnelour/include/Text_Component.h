@@ -21,6 +21,7 @@
 #include <d3dx11tex.h>
 #include <string>
 #include "Bitmap_Component.h"
+#include "Font_Cache.h"
 
 
 namespace Tunnelour {
@@ -35,38 +36,8 @@ class Text_Component: public Tunnelour::Bitmap_Component {
     std::string font_csv_file;
   };
 
-  struct Raw_Character_Frame {
-    Raw_Character_Frame() : id(-1),
-                            x(-1),
-                            y(-1),
-                            width(-1),
-                            height(-1),
-                            xoffset(-1),
-                            yoffset(-1),
-                            xadvance(-1) {
-    }
-    double id;
-    double x;
-    double y;
-    double width;
-    double height;
-    double xoffset;
-    double yoffset;
-    double xadvance;
-  };
-
-  struct Font {
-    double image_width;
-    double image_height;
-    // This is the distance in pixels between each line of text.
-    double line_height;
-    std::string font_name;
-    std::wstring font_texture_name;
-    double character_widths[256];
-    Raw_Character_Frame raw_char_frames[256];
-    Vertex_Type character_frames[256][6];
-    D3DXCOLOR font_color;
-  };
+  typedef Font_Cache::Raw_Character_Frame Raw_Character_Frame;
+  typedef Font_Cache::Font Font;
 
   //---------------------------------------------------------------------------
   // Description : Constructor
@@ -84,29 +55,65 @@ class Text_Component: public Tunnelour::Bitmap_Component {
   virtual void Init();
 
   //---------------------------------------------------------------------------
-  // Description : Retrives a pointer to the font struct for this compoent
+  // Description : Retrives a pointer to the shared font struct for this
+  //               component, this is 0 until the component is initialised.
+  //---------------------------------------------------------------------------
+  Font const * GetFont();
+
+  //---------------------------------------------------------------------------
+  // Description : Accessor for the Font Colour
   //---------------------------------------------------------------------------
-  Font* GetFont();
+  D3DXCOLOR GetFontColor();
+
+  //---------------------------------------------------------------------------
+  // Description : Mutator for the Font Colour
+  //---------------------------------------------------------------------------
+  void SetFontColor(D3DXCOLOR font_color);
 
   //---------------------------------------------------------------------------
   // Description : Returns a pointer to the text structure.
   //---------------------------------------------------------------------------
   Text* GetText();
 
+  //---------------------------------------------------------------------------
+  // Description : Changes the displayed text, only the glyphs which changed
+  //               are rewritten into the existing vertex array.
+  //---------------------------------------------------------------------------
+  void SetText(std::string const &text);
+
  protected:
   //---------------------------------------------------------------------------
   // Description : Class variables
   //---------------------------------------------------------------------------
   Text m_text;
-  Font m_font;
+  Font const * m_font;
+  D3DXCOLOR m_font_color;
+
  private:
-  void Load_Font_Struct();
-  void Load_Character_Frames();
   //---------------------------------------------------------------------------
   // Description : Inits this components frame stucture
   //---------------------------------------------------------------------------
   void Create_String_Frame();
-  bool m_has_font_been_loaded;
+
+  //---------------------------------------------------------------------------
+  // Description : Makes sure the frame can hold the given number of glyphs,
+  //               growing the vertex and index arrays if it can't.
+  //---------------------------------------------------------------------------
+  void Reserve_Glyphs(int glyph_count);
+
+  //---------------------------------------------------------------------------
+  // Description : Writes the glyphs from first_glyph to the end of the text
+  //               into the vertex array and recalculates the size and centre.
+  //---------------------------------------------------------------------------
+  void Write_Glyphs(std::string::size_type first_glyph);
+
+  int m_glyph_capacity;
+
+  //---------------------------------------------------------------------------
+  // Description : The smallest number of glyphs a frame is created with,
+  //               so labels which change length rarely need to grow.
+  //---------------------------------------------------------------------------
+  const int m_minimum_glyph_capacity;
 };  // class Text_Component
 }  // namespace Tunnelour
 #endif  // TUNNELOUR_TEXT_COMPONENT_H_
@@ -28,6 +28,39 @@ namespace Tunnelour {
 //-----------------------------------------------------------------------------
 class Tile_Bitmap: public Tunnelour::Bitmap_Component {
  public:
+  //---------------------------------------------------------------------------
+  // Description : The classes a tile can belong to, a tile's classes are
+  //               stored as one mask of these bits.
+  //---------------------------------------------------------------------------
+  enum Tile_Class {
+    FLOOR = 0x00000001,
+    ROOF = 0x00000002,
+    RIGHT_WALL = 0x00000004,
+    LEFT_WALL = 0x00000008,
+    TOP_EDGE = 0x00000010,
+    BOTTOM_EDGE = 0x00000020,
+    RIGHT_EDGE = 0x00000040,
+    LEFT_EDGE = 0x00000080,
+    COLLIDABLE = 0x00000100,
+    RIGHT_FLOOR_END = 0x00000200,
+    LEFT_FLOOR_END = 0x00000400,
+    RIGHT_ROOF_END = 0x00000800,
+    LEFT_ROOF_END = 0x00001000,
+    TOP_RIGHT_WALL_END = 0x00002000,
+    BOT_RIGHT_WALL_END = 0x00004000,
+    TOP_LEFT_WALL_END = 0x00008000,
+    BOT_LEFT_WALL_END = 0x00010000,
+    LEFT_EXIT = 0x00020000,
+    RIGHT_EXIT = 0x00040000,
+    MIDDLEGROUND = 0x00080000,
+    BACKGROUND = 0x00100000,
+    WALL = RIGHT_WALL | LEFT_WALL,
+    FLOOR_END = RIGHT_FLOOR_END | LEFT_FLOOR_END,
+    ROOF_END = RIGHT_ROOF_END | LEFT_ROOF_END,
+    WALL_END = TOP_RIGHT_WALL_END | BOT_RIGHT_WALL_END | TOP_LEFT_WALL_END | BOT_LEFT_WALL_END,
+    EXIT = LEFT_EXIT | RIGHT_EXIT
+  };
+
   //---------------------------------------------------------------------------
   // Description : Constructor
   //---------------------------------------------------------------------------
@@ -43,6 +76,29 @@ class Tile_Bitmap: public Tunnelour::Bitmap_Component {
   //---------------------------------------------------------------------------
   virtual void Init();
 
+  //---------------------------------------------------------------------------
+  // Description : Returns the mask of every Tile_Class this tile belongs to
+  //---------------------------------------------------------------------------
+  unsigned int GetClassMask();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns true if the tile belongs to any of the classes in
+  //               the mask, e.g. IsAnyOf(FLOOR | LEFT_FLOOR_END)
+  //---------------------------------------------------------------------------
+  bool IsAnyOf(unsigned int class_mask);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns true if the tile belongs to all of the classes in
+  //               the mask
+  //---------------------------------------------------------------------------
+  bool IsAllOf(unsigned int class_mask);
+
+  //---------------------------------------------------------------------------
+  // Description : Adds the tile to, or removes it from, the classes in the
+  //               mask
+  //---------------------------------------------------------------------------
+  void SetClass(unsigned int class_mask, bool is_in_class);
+
   bool IsFloor();
 
   void SetIsFloor(bool is_floor);
@@ -131,6 +187,12 @@ class Tile_Bitmap: public Tunnelour::Bitmap_Component {
 
   void SetIsBackground(bool is_background);
 
+  //---------------------------------------------------------------------------
+  // Description : Background tiles and the solid rock of the middleground
+  //               are opaque, tunnel edges and exits are not.
+  //---------------------------------------------------------------------------
+  virtual bool IsOpaque();
+
  protected:
 
  private:
@@ -138,30 +200,8 @@ class Tile_Bitmap: public Tunnelour::Bitmap_Component {
   // Description : Inits this components frame stucture
   //---------------------------------------------------------------------------
   void Init_Frame();
-  bool m_is_floor;
-  bool m_is_roof;
-  bool m_is_right_wall;
-  bool m_is_left_wall;
-  bool m_is_top_edge;
-  bool m_is_bottom_edge;
-  bool m_is_right_edge;
-  bool m_is_left_edge;
-  bool m_is_collidable;
-
-  bool m_is_right_floor_end;
-  bool m_is_left_floor_end;
-  bool m_is_right_roof_end;
-  bool m_is_left_roof_end;
-  bool m_is_top_right_wall_end;
-  bool m_is_bot_right_wall_end;
-  bool m_is_top_left_wall_end;
-  bool m_is_bot_left_wall_end;
-
-  bool m_is_left_exit;
-  bool m_is_right_exit;
-
-  bool m_is_middleground;
-  bool m_is_background;
+
+  unsigned int m_class_mask;
 };  // class Tile_Bitmap
 }  // namespace Tunnelour
 #endif  // TUNNELOUR_TILE_BITMAP_H_
@@ -0,0 +1,98 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_TILE_CLASS_INDEX_COMPONENT_H_
+#define TUNNELOUR_TILE_CLASS_INDEX_COMPONENT_H_
+
+#include "Component.h"
+#include "Component_Composite.h"
+#include "Tile_Bitmap.h"
+#include "Tile_Grid.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Tile_Class_Index_Component keeps one Tile_Grid of every
+//                floor and wall tile in the model, updated as tiles are
+//                added, updated and removed. The avatar and camera
+//                controllers share it and ask for the classes they want
+//                rather than each keeping their own copies of the tiles.
+//-----------------------------------------------------------------------------
+class Tile_Class_Index_Component: public Component,
+                                  public Component_Composite::Component_Composite_Type_Observer {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  Tile_Class_Index_Component();
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Tile_Class_Index_Component();
+
+  //---------------------------------------------------------------------------
+  // Description : Initialise this Component
+  //---------------------------------------------------------------------------
+  virtual void Init();
+
+  //---------------------------------------------------------------------------
+  // Description : Starts indexing the tiles added to the model, should be
+  //               called before any level tiles are added.
+  //---------------------------------------------------------------------------
+  void ObserveModel(Component_Composite *model);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the indexed tiles, query them with the
+  //               Tile_Bitmap::Tile_Class bits wanted.
+  //---------------------------------------------------------------------------
+  Tile_Grid* GetTiles();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns a number which changes whenever the index does
+  //---------------------------------------------------------------------------
+  unsigned int GetVersion();
+
+  //---------------------------------------------------------------------------
+  // Description : Indexes a tile added to the model
+  //---------------------------------------------------------------------------
+  void HandleEventAdd(Tunnelour::Component * const component);
+
+  //---------------------------------------------------------------------------
+  // Description : Removes a tile removed from the model
+  //---------------------------------------------------------------------------
+  void HandleEventRemove(Tunnelour::Component * const component);
+
+  //---------------------------------------------------------------------------
+  // Description : Reindexes a tile whose position or classes have changed
+  //---------------------------------------------------------------------------
+  void HandleEventUpdate(Tunnelour::Component * const component);
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : The classes a tile needs one of to be indexed
+  //---------------------------------------------------------------------------
+  static const unsigned int INDEXED_CLASSES = Tile_Bitmap::FLOOR | Tile_Bitmap::WALL;
+
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  Component_Composite *m_model;
+  Tile_Grid m_tiles;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_TILE_CLASS_INDEX_COMPONENT_H_
@@ -0,0 +1,190 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_TILE_GRID_H_
+#define TUNNELOUR_TILE_GRID_H_
+
+#include <d3dx10math.h>
+#include <unordered_map>
+#include <vector>
+#include "AABB.h"
+#include "AABB_Batch.h"
+#include "Tile_Bitmap.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Tile_Grid is a uniform grid of tiles used to find the tiles
+//                near an area without looking at every tile in the level.
+//                Each tile is stored in every cell its bounds touch, so any
+//                tile touching a queried area shares a cell with it. Each
+//                cell keeps its tiles' bounds in an AABB_Batch so a query
+//                tests a whole cell at once, and the OR of its tiles' class
+//                masks so a query for some classes of tile can skip cells
+//                with none of them. The grid does not own the tiles.
+//-----------------------------------------------------------------------------
+class Tile_Grid {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : The cells an area touches, inclusive on every side
+  //---------------------------------------------------------------------------
+  struct Cell_Range {
+    int left;
+    int right;
+    int bottom;
+    int top;
+
+    bool operator==(const Cell_Range& rhs) const {
+      return (left == rhs.left && right == rhs.right &&
+              bottom == rhs.bottom && top == rhs.top);
+    }
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Constructor, the default cell size matches the 128 pixel
+  //               blocks levels are built from.
+  //---------------------------------------------------------------------------
+  Tile_Grid();
+
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  explicit Tile_Grid(float cell_size);
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Tile_Grid();
+
+  //---------------------------------------------------------------------------
+  // Description : Adds a tile at its current position, a tile already in the
+  //               grid is moved to its current position.
+  //---------------------------------------------------------------------------
+  void Add(Tile_Bitmap *tile);
+
+  //---------------------------------------------------------------------------
+  // Description : Adds every tile in the list, in order
+  //---------------------------------------------------------------------------
+  void Add(std::vector<Tile_Bitmap*> const &tiles);
+
+  //---------------------------------------------------------------------------
+  // Description : Removes a tile, does nothing if the tile is not in the grid
+  //---------------------------------------------------------------------------
+  void Remove(Tile_Bitmap *tile);
+
+  //---------------------------------------------------------------------------
+  // Description : Removes every tile
+  //---------------------------------------------------------------------------
+  void Clear();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns true if the tile is in the grid
+  //---------------------------------------------------------------------------
+  bool Contains(Tile_Bitmap *tile);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns true if there are no tiles in the grid
+  //---------------------------------------------------------------------------
+  bool IsEmpty();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of tiles in the grid
+  //---------------------------------------------------------------------------
+  unsigned int GetSize();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns a number which changes whenever a tile is added or
+  //               removed, so query results can be reused until it changes.
+  //---------------------------------------------------------------------------
+  unsigned int GetVersion();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns every tile whose bounds touch the area, in the
+  //               order they were added. The list is reused by the next query
+  //               so querying does not allocate once warm.
+  //---------------------------------------------------------------------------
+  std::vector<Tile_Bitmap*> const & Query(AABB const &area);
+
+  //---------------------------------------------------------------------------
+  // Description : As Query but only returns tiles belonging to any of the
+  //               Tile_Bitmap::Tile_Class bits in class_mask. A tile's
+  //               classes are read when it is added.
+  //---------------------------------------------------------------------------
+  std::vector<Tile_Bitmap*> const & Query(AABB const &area, unsigned int class_mask);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns true if any tile belonging to the classes touches
+  //               the area and sets out_bounds to the union of their bounds.
+  //               Unlike Query it only reads the grid, so it can be called
+  //               from different threads at once while no tiles are changed.
+  //---------------------------------------------------------------------------
+  bool FindTouchingBounds(AABB const &area, unsigned int class_mask, AABB *out_bounds);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the cells of cell_size pixels an area touches. The
+  //               bounds are inclusive so areas which only touch a cell are
+  //               in it. Other grids of areas bucket them the same way.
+  //---------------------------------------------------------------------------
+  static Cell_Range GetCellRange(AABB const &area, float cell_size);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the key of a cell in a map of cells
+  //---------------------------------------------------------------------------
+  static long long GetCellKey(int x, int y);
+
+ protected:
+
+ private:
+  struct Cell_Entry {
+    Tile_Bitmap *tile;
+    unsigned int order;
+    unsigned int class_mask;
+  };
+
+  struct Cell {
+    Cell() : class_mask(0) {
+    }
+    std::vector<Cell_Entry> entries;
+    // Bounds of each entry, in the same order as the entries
+    AABB_Batch bounds;
+    // Every class any entry belongs to
+    unsigned int class_mask;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Collects the tiles touching the area, only tiles in the
+  //               classes of class_mask if is_class_filtered is set.
+  //---------------------------------------------------------------------------
+  std::vector<Tile_Bitmap*> const & QueryCells(AABB const &area, unsigned int class_mask, bool is_class_filtered);
+
+  //---------------------------------------------------------------------------
+  // Description : Orders cell entries by when their tile was added
+  //---------------------------------------------------------------------------
+  static bool IsEntryOlder(Cell_Entry const &a, Cell_Entry const &b);
+
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  float m_cell_size;
+  unsigned int m_next_order;
+  unsigned int m_version;
+  std::unordered_map<long long, Cell> m_cells;
+  std::unordered_map<Tile_Bitmap*, Cell_Range> m_tile_cells;
+  std::vector<Cell_Entry> m_query_entries;
+  std::vector<unsigned int> m_query_hit_mask;
+  std::vector<Tile_Bitmap*> m_query_tiles;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_TILE_GRID_H_
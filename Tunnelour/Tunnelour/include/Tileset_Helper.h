@@ -64,10 +64,13 @@ class Tileset_Helper {
     unsigned int frames_per_second;
     bool is_repeatable;
     std::vector<Frame_Metadata> frames;
+    // The interned id of the name, set by whoever loads the tileset
+    unsigned int state_id;
 
     Animation_Subset() {
       name = "";
       type = "";
+      state_id = 0;
       top_left_x = 0;
       top_left_y = 0;
       size_x = 0;
@@ -90,9 +93,12 @@ class Tileset_Helper {
     float size_y;
     int number_of_subsets;
     std::vector<Animation_Subset> subsets;
+    // The interned id of the name, set by whoever loads the tileset
+    unsigned int state_id;
 
     Animation_Tileset_Metadata() {
       name = "";
+      state_id = 0;
       type + "";
       filename + "";
       top_left_x = 0;
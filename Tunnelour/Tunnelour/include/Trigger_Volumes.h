@@ -0,0 +1,112 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_TRIGGER_VOLUMES_H_
+#define TUNNELOUR_TRIGGER_VOLUMES_H_
+
+#include <unordered_map>
+#include <vector>
+#include "AABB.h"
+#include "Tile_Grid.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Trigger_Volumes is a uniform grid of areas, like exits,
+//                which fire an event when a moving area enters or leaves
+//                them. Areas are bucketed into cells as Tile_Grid does. The volumes in the cells the moving area touches are
+//                only looked up again when it crosses into other cells, so
+//                away from any volume an update tests nothing.
+//-----------------------------------------------------------------------------
+class Trigger_Volumes {
+ public:
+  struct Trigger_Event {
+    unsigned int volume;
+    bool is_entering;
+  };
+
+  //---------------------------------------------------------------------------
+  // Description : Constructor, the default cell size matches the 128 pixel
+  //               blocks levels are built from.
+  //---------------------------------------------------------------------------
+  Trigger_Volumes();
+
+  //---------------------------------------------------------------------------
+  // Description : Constructor
+  //---------------------------------------------------------------------------
+  explicit Trigger_Volumes(float cell_size);
+
+  //---------------------------------------------------------------------------
+  // Description : Deconstructor
+  //---------------------------------------------------------------------------
+  virtual ~Trigger_Volumes();
+
+  //---------------------------------------------------------------------------
+  // Description : Adds a volume and returns its index, volumes are numbered
+  //               from 0 in the order they are added.
+  //---------------------------------------------------------------------------
+  unsigned int Add(AABB const &bounds);
+
+  //---------------------------------------------------------------------------
+  // Description : Removes every volume, nothing is inside any volume after
+  //---------------------------------------------------------------------------
+  void Clear();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of volumes
+  //---------------------------------------------------------------------------
+  unsigned int GetSize();
+
+  //---------------------------------------------------------------------------
+  // Description : Moves the tracked area to its current bounds and returns
+  //               the volumes it entered or left since the last update. The
+  //               list is reused by the next update.
+  //---------------------------------------------------------------------------
+  std::vector<Trigger_Event> const & Update(AABB const &bounds);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns true if the tracked area was inside the volume at
+  //               the last update
+  //---------------------------------------------------------------------------
+  bool IsInside(unsigned int volume);
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Finds the volumes in the cells of the range, each once
+  //---------------------------------------------------------------------------
+  void FindNearbyVolumes(Tile_Grid::Cell_Range const &range);
+
+  //---------------------------------------------------------------------------
+  // Description : Records a volume being entered or left
+  //---------------------------------------------------------------------------
+  void SetIsInside(unsigned int volume, bool is_inside);
+
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  float m_cell_size;
+  std::vector<AABB> m_volumes;
+  std::vector<bool> m_is_inside;
+  std::unordered_map<long long, std::vector<unsigned int>> m_cells;
+  bool m_has_range;
+  Tile_Grid::Cell_Range m_range;
+  std::vector<unsigned int> m_nearby_volumes;
+  std::vector<unsigned int> m_inside_volumes;
+  std::vector<Trigger_Event> m_events;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_TRIGGER_VOLUMES_H_
@@ -11,6 +11,9 @@ cbuffer MatrixBuffer
   matrix worldMatrix;
   matrix viewMatrix;
   matrix projectionMatrix;
+  // Top left (xy) and size (zw) of the sprite on its texture, the quad's
+  // own texture coordinates run from 0 to 1.
+  float4 uvRect;
 };
 
 
@@ -46,7 +49,7 @@ PixelInputType DebugVertexShader(VertexInputType input)
   output.position = mul(output.position, projectionMatrix);
     
   // Store the texture coordinates for the pixel shader.
-  output.tex = input.tex;
+  output.tex = uvRect.xy + (input.tex * uvRect.zw);
 
   return output;
 }
\ No newline at end of file
@@ -11,6 +11,9 @@ cbuffer MatrixBuffer
   matrix worldMatrix;
   matrix viewMatrix;
   matrix projectionMatrix;
+  // Top left (xy) and size (zw) of the sprite on its texture, the quad's
+  // own texture coordinates run from 0 to 1.
+  float4 uvRect;
 };
 
 
@@ -47,7 +50,7 @@ PixelInputType TransparentVertexShader(VertexInputType input)
     output.position = mul(output.position, projectionMatrix);
     
   // Store the texture coordinates for the pixel shader.
-  output.tex = input.tex;
+  output.tex = uvRect.xy + (input.tex * uvRect.zw);
 
     return output;
 }
\ No newline at end of file
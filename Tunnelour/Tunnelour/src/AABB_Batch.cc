@@ -0,0 +1,140 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "AABB_Batch.h"
+
+// SSE2 is always there on x64, and on x86 when built with /arch:SSE2.
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define TUNNELOUR_AABB_BATCH_SSE
+#include <emmintrin.h>
+#endif
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+AABB_Batch::AABB_Batch() {
+}
+
+//------------------------------------------------------------------------------
+AABB_Batch::~AABB_Batch() {
+}
+
+//------------------------------------------------------------------------------
+void AABB_Batch::Add(AABB const &bounds) {
+  m_min_x.push_back(bounds.left);
+  m_min_y.push_back(bounds.bottom);
+  m_max_x.push_back(bounds.right);
+  m_max_y.push_back(bounds.top);
+}
+
+//------------------------------------------------------------------------------
+void AABB_Batch::Remove(unsigned int index) {
+  m_min_x.erase(m_min_x.begin() + index);
+  m_min_y.erase(m_min_y.begin() + index);
+  m_max_x.erase(m_max_x.begin() + index);
+  m_max_y.erase(m_max_y.begin() + index);
+}
+
+//------------------------------------------------------------------------------
+void AABB_Batch::Clear() {
+  m_min_x.clear();
+  m_min_y.clear();
+  m_max_x.clear();
+  m_max_y.clear();
+}
+
+//------------------------------------------------------------------------------
+AABB AABB_Batch::GetAABB(unsigned int index) {
+  return AABB::FromFixedPixels(m_min_x[index], m_max_x[index], m_min_y[index], m_max_y[index]);
+}
+
+//------------------------------------------------------------------------------
+unsigned int AABB_Batch::GetSize() {
+  return static_cast<unsigned int>(m_min_x.size());
+}
+
+//------------------------------------------------------------------------------
+void AABB_Batch::GetTouchingMask(AABB const &box, std::vector<unsigned int> *out_hit_mask) {
+#ifdef TUNNELOUR_AABB_BATCH_SSE
+  ResetMask(out_hit_mask);
+
+  __m128i box_left = _mm_set1_epi32(box.left);
+  __m128i box_right = _mm_set1_epi32(box.right);
+  __m128i box_bottom = _mm_set1_epi32(box.bottom);
+  __m128i box_top = _mm_set1_epi32(box.top);
+
+  // Four bounds at a time, a group of four never straddles a mask word.
+  unsigned int size = GetSize();
+  unsigned int index = 0;
+  for (; index + 4 <= size; index += 4) {
+    __m128i min_x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&m_min_x[index]));
+    __m128i min_y = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&m_min_y[index]));
+    __m128i max_x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&m_max_x[index]));
+    __m128i max_y = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&m_max_y[index]));
+
+    // SSE2 only has greater than, so find the bounds which miss the box
+    // on any side and keep the rest.
+    __m128i is_x_missing = _mm_or_si128(_mm_cmpgt_epi32(min_x, box_right),
+                                        _mm_cmpgt_epi32(box_left, max_x));
+    __m128i is_y_missing = _mm_or_si128(_mm_cmpgt_epi32(min_y, box_top),
+                                        _mm_cmpgt_epi32(box_bottom, max_y));
+    unsigned int misses = static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(is_x_missing, is_y_missing))));
+    unsigned int hits = ~misses & 0xF;
+
+    (*out_hit_mask)[index / 32] |= hits << (index % 32);
+  }
+
+  SetTouchingBitsScalar(box, index, out_hit_mask);
+#else
+  GetTouchingMaskScalar(box, out_hit_mask);
+#endif
+}
+
+//------------------------------------------------------------------------------
+void AABB_Batch::GetTouchingMaskScalar(AABB const &box, std::vector<unsigned int> *out_hit_mask) {
+  ResetMask(out_hit_mask);
+  SetTouchingBitsScalar(box, 0, out_hit_mask);
+}
+
+//------------------------------------------------------------------------------
+bool AABB_Batch::IsHit(std::vector<unsigned int> const &hit_mask, unsigned int index) {
+  return (hit_mask[index / 32] & (1u << (index % 32))) != 0;
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void AABB_Batch::ResetMask(std::vector<unsigned int> *out_hit_mask) {
+  out_hit_mask->assign((GetSize() + 31) / 32, 0);
+}
+
+//------------------------------------------------------------------------------
+void AABB_Batch::SetTouchingBitsScalar(AABB const &box, unsigned int first_index, std::vector<unsigned int> *out_hit_mask) {
+  unsigned int size = GetSize();
+  for (unsigned int index = first_index; index < size; index++) {
+    if (m_min_x[index] <= box.right && m_max_x[index] >= box.left &&
+        m_min_y[index] <= box.top && m_max_y[index] >= box.bottom) {
+      (*out_hit_mask)[index / 32] |= 1u << (index % 32);
+    }
+  }
+}
+
+}  // namespace Tunnelour
@@ -0,0 +1,182 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Animation_Library.h"
+#include "Avatar_State_Names.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Animation_Library::Animation_Library() {
+}
+
+//------------------------------------------------------------------------------
+Animation_Library::~Animation_Library() {
+  Clear();
+}
+
+//------------------------------------------------------------------------------
+void Animation_Library::Add(Tileset_Helper::Animation_Tileset_Metadata const &metadata) {
+  Avatar_State_Names *state_names = Avatar_State_Names::GetInstance();
+
+  m_metadata.push_back(metadata);
+  Tileset_Helper::Animation_Tileset_Metadata &added_metadata = m_metadata.back();
+  added_metadata.state_id = state_names->GetStateID(added_metadata.name);
+  std::vector<Tileset_Helper::Animation_Subset>::iterator subset;
+  for (subset = added_metadata.subsets.begin(); subset != added_metadata.subsets.end(); subset++) {
+    subset->state_id = state_names->GetStateID(subset->name);
+  }
+}
+
+//------------------------------------------------------------------------------
+void Animation_Library::Build() {
+  m_subsets.clear();
+  m_handles.clear();
+  m_collision_blocks.clear();
+
+  for (unsigned int metadata_index = 0; metadata_index < m_metadata.size(); metadata_index++) {
+    Tileset_Helper::Animation_Tileset_Metadata &metadata = m_metadata[metadata_index];
+    for (unsigned int subset_index = 0; subset_index < metadata.subsets.size(); subset_index++) {
+      Tileset_Helper::Animation_Subset &subset = metadata.subsets[subset_index];
+
+      // Frame numbers start at 1, a skipped number is left as a frame with
+      // no collision blocks.
+      unsigned int frame_count = subset.number_of_frames;
+      std::vector<Tileset_Helper::Frame_Metadata>::iterator frame;
+      for (frame = subset.frames.begin(); frame != subset.frames.end(); frame++) {
+        if (frame->id > frame_count) {
+          frame_count = frame->id;
+        }
+      }
+      std::vector<Tileset_Helper::Frame_Metadata> ordered_frames(frame_count);
+      for (unsigned int frame_index = 0; frame_index < frame_count; frame_index++) {
+        ordered_frames[frame_index].id = frame_index + 1;
+      }
+      for (frame = subset.frames.begin(); frame != subset.frames.end(); frame++) {
+        if (frame->id != 0) {
+          ordered_frames[frame->id - 1] = (*frame);
+        }
+      }
+      subset.frames.swap(ordered_frames);
+
+      Subset_Entry entry;
+      entry.metadata_index = metadata_index;
+      entry.subset_index = subset_index;
+      entry.first_collision_blocks = static_cast<unsigned int>(m_collision_blocks.size());
+      for (unsigned int frame_index = 0; frame_index < frame_count; frame_index++) {
+        m_collision_blocks.push_back(BakeCollisionBlocks(subset.frames[frame_index], subset.top_left_y, frame_index, Avatar_Component::RIGHT));
+        m_collision_blocks.push_back(BakeCollisionBlocks(subset.frames[frame_index], subset.top_left_y, frame_index, Avatar_Component::LEFT));
+      }
+      m_handles[GetKey(metadata.state_id, subset.state_id)] = static_cast<Subset_Handle>(m_subsets.size());
+      m_subsets.push_back(entry);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void Animation_Library::Clear() {
+  m_metadata.clear();
+  m_subsets.clear();
+  m_handles.clear();
+  m_collision_blocks.clear();
+}
+
+//------------------------------------------------------------------------------
+Animation_Library::Subset_Handle Animation_Library::Find(unsigned int parent_state, unsigned int state) {
+  std::unordered_map<long long, Subset_Handle>::iterator found = m_handles.find(GetKey(parent_state, state));
+  if (found == m_handles.end()) {
+    return NO_SUBSET;
+  }
+  return found->second;
+}
+
+//------------------------------------------------------------------------------
+Tileset_Helper::Animation_Tileset_Metadata const & Animation_Library::GetMetadata(Subset_Handle handle) {
+  return m_metadata[m_subsets[handle].metadata_index];
+}
+
+//------------------------------------------------------------------------------
+Tileset_Helper::Animation_Subset const & Animation_Library::GetSubset(Subset_Handle handle) {
+  Subset_Entry const &entry = m_subsets[handle];
+  return m_metadata[entry.metadata_index].subsets[entry.subset_index];
+}
+
+//------------------------------------------------------------------------------
+Tileset_Helper::Frame_Metadata const & Animation_Library::GetFrame(Subset_Handle handle, unsigned int frame_index) {
+  Tileset_Helper::Animation_Subset const &subset = GetSubset(handle);
+  if (frame_index >= subset.frames.size()) {
+    return m_missing_frame;
+  }
+  return subset.frames[frame_index];
+}
+
+//------------------------------------------------------------------------------
+Avatar_Component::Frame_Collision_Blocks const * Animation_Library::GetCollisionBlocks(Subset_Handle handle, unsigned int frame_index, Avatar_Component::Direction direction) {
+  if (frame_index >= GetSubset(handle).frames.size()) {
+    return &m_missing_collision_blocks;
+  }
+  unsigned int direction_index = (direction == Avatar_Component::LEFT) ? 1 : 0;
+  return &m_collision_blocks[m_subsets[handle].first_collision_blocks + (frame_index * DIRECTION_COUNT) + direction_index];
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+long long Animation_Library::GetKey(unsigned int parent_state, unsigned int state) {
+  return (static_cast<long long>(parent_state) << 32) | state;
+}
+
+//------------------------------------------------------------------------------
+Avatar_Component::Frame_Collision_Blocks Animation_Library::BakeCollisionBlocks(Tileset_Helper::Frame_Metadata const &frame, float tileset_animation_top_left_y, unsigned int frame_index, Avatar_Component::Direction direction) {
+  Avatar_Component::Frame_Collision_Blocks baked_blocks;
+
+  // The frame is 128x128 so the centre of frame # in the tileset is
+  // # * 128 + 128/2 along x and 128/2 below the top of the subset.
+  D3DXVECTOR2 animation_frame_centre;
+  animation_frame_centre.x = static_cast<float>(((frame_index + 1) * 128) - (128 / 2));
+  animation_frame_centre.y = static_cast<float>(((tileset_animation_top_left_y) - (128 / 2)));
+
+  std::vector<Tileset_Helper::Avatar_Collision_Block>::const_iterator tileset_block;
+  for (tileset_block = frame.avatar_collision_blocks.begin(); tileset_block != frame.avatar_collision_blocks.end(); tileset_block++) {
+    Avatar_Component::Collision_Block_ID id = Avatar_State_Names::GetCollisionBlockID(tileset_block->id);
+    Avatar_Component::Avatar_Collision_Block &baked_block = baked_blocks.blocks[id];
+    baked_block.id = id;
+    baked_block.is_contacting = tileset_block->is_contacting;
+    baked_block.size.x = static_cast<float>(tileset_block->size_x);
+    baked_block.size.y = static_cast<float>(tileset_block->size_y);
+
+    // Store the distance from the centre of the block to the centre of the
+    // animation frame, reversing x when facing left.
+    D3DXVECTOR2 tileset_block_centre;
+    tileset_block_centre.x = static_cast<float>(tileset_block->top_left_x + (tileset_block->size_x / 2));
+    tileset_block_centre.y = static_cast<float>(tileset_block->top_left_y - (tileset_block->size_y / 2));
+    baked_block.offset_from_avatar_centre.x = tileset_block_centre.x - animation_frame_centre.x;
+    baked_block.offset_from_avatar_centre.y = tileset_block_centre.y - animation_frame_centre.y;
+    baked_block.offset_from_avatar_centre.z = 0;
+    if (direction == Avatar_Component::LEFT) {
+      baked_block.offset_from_avatar_centre.x = (baked_block.offset_from_avatar_centre.x * -1);
+    }
+  }
+
+  return baked_blocks;
+}
+
+}  // namespace Tunnelour
@@ -14,6 +14,7 @@
 //
 
 #include "Avatar_Component.h"
+#include "Avatar_State_Names.h"
 #include "Exceptions.h"
 
 namespace Tunnelour {
@@ -26,41 +27,45 @@ Avatar_Component::Avatar_Component(): Bitmap_Component() {
   m_size = D3DXVECTOR2(0, 0);
   m_texture->texture_path = L"";
 
-  m_state.state = "";
-  m_state.direction = "";
+  m_state.state = NO_STATE;
+  m_state.direction = NO_DIRECTION;
   m_state.state_index = 0;
 
-  m_initial_state.state = "";
-  m_initial_state.direction = "";
+  m_initial_state.state = NO_STATE;
+  m_initial_state.direction = NO_DIRECTION;
   m_initial_state.state_index = 0;
 
-  m_last_rendered_state.state = "";
-  m_last_rendered_state.direction = "";
+  m_last_rendered_state.state = NO_STATE;
+  m_last_rendered_state.direction = NO_DIRECTION;
   m_last_rendered_state.state_index = 0;
   
   m_type = "Avatar_Component";
 
-  m_command.state = "";
-  m_command.direction = "";
+  m_command.state = NO_STATE;
+  m_command.direction = NO_DIRECTION;
   m_command.state_index = 0;
+
+  m_state_version = 0;
+  m_command_version = 0;
+  m_last_rendered_state_version = 0;
 }
 
 //------------------------------------------------------------------------------
 Avatar_Component::~Avatar_Component() {
-  m_state.state = "";
-  m_state.direction = "";
+  m_state.state = NO_STATE;
+  m_state.direction = NO_DIRECTION;
   m_state.state_index = 0;
 
-  m_initial_state.state = "";
-  m_initial_state.direction = "";
+  m_initial_state.state = NO_STATE;
+  m_initial_state.direction = NO_DIRECTION;
   m_initial_state.state_index = 0;
 
-  m_last_rendered_state.state = "";
-  m_last_rendered_state.direction = "";
+  m_last_rendered_state.state = NO_STATE;
+  m_last_rendered_state.direction = NO_DIRECTION;
   m_last_rendered_state.state_index = 0;
 
-  m_command.state = "";
-  m_command.direction = "";
+  m_command.state = NO_STATE;
+  m_command.direction = NO_DIRECTION;
   m_command.state_index = 0;
 }
 
@@ -72,39 +77,78 @@ void Avatar_Component::Init() {
 }
 
 //---------------------------------------------------------------------------
-Avatar_Component::Avatar_State Avatar_Component::GetState() {
+D3DXVECTOR4 Avatar_Component::GetUVRect() {
+  D3DXVECTOR4 uv_rect = Bitmap_Component::GetUVRect();
+  if (m_state.direction == LEFT) {
+    // Start at the right hand side of the frame and step backwards.
+    uv_rect.x += uv_rect.z;
+    uv_rect.z = -uv_rect.z;
+  }
+  return uv_rect;
+}
+
+//---------------------------------------------------------------------------
+Avatar_Component::Avatar_State const & Avatar_Component::GetState() {
   return m_state;
 }
 
 //---------------------------------------------------------------------------
-Avatar_Component::Avatar_State Avatar_Component::GetLastState() {
+Avatar_Component::Avatar_State const & Avatar_Component::GetLastState() {
   return m_initial_state;
 }
 
 //---------------------------------------------------------------------------
-Avatar_Component::Avatar_State Avatar_Component::GetLastRenderedState() {
+Avatar_Component::Avatar_State const & Avatar_Component::GetLastRenderedState() {
   return m_last_rendered_state;
 }
 
 //---------------------------------------------------------------------------
-void Avatar_Component::SetLastRenderedState(Avatar_Component::Avatar_State last_state) {
-  m_last_rendered_state = last_state;
+void Avatar_Component::SetLastRenderedState() {
+  if (m_last_rendered_state_version == m_state_version) {
+    return;
+  }
+  m_last_rendered_state = m_state;
+  m_last_rendered_state_version = m_state_version;
+}
+
+//---------------------------------------------------------------------------
+unsigned int Avatar_Component::GetLastRenderedStateVersion() {
+  return m_last_rendered_state_version;
 }
 
 //---------------------------------------------------------------------------
 void Avatar_Component::SetState(Avatar_Component::Avatar_State state) {
+  // Setting the state it already has, twice running, changes nothing
+  if (state == m_state && m_initial_state == m_state) {
+    return;
+  }
   m_initial_state = m_state;
   m_state = state;
+  m_state_version++;
 }
 
 //---------------------------------------------------------------------------
-Avatar_Component::Avatar_State Avatar_Component::GetCommand() {
+Avatar_Component::Avatar_State const & Avatar_Component::GetCommand() {
   return m_command;
 }
 
 //---------------------------------------------------------------------------
 void Avatar_Component::SetCommand(Avatar_Component::Avatar_State command) {
+  if (command == m_command) {
+    return;
+  }
   m_command = command;
+  m_command_version++;
+}
+
+//---------------------------------------------------------------------------
+unsigned int Avatar_Component::GetStateVersion() {
+  return m_state_version;
+}
+
+//---------------------------------------------------------------------------
+unsigned int Avatar_Component::GetCommandVersion() {
+  return m_command_version;
 }
 
 //------------------------------------------------------------------------------
@@ -158,42 +202,23 @@ void Avatar_Component::Init_Frame() {
   // Load the vertex array with data
   // First triangle
 
-  if (m_state.direction != "Right" && m_state.direction != "Left") {
-    throw Tunnelour::Exceptions::init_error("No Direction State! " + GetState().state);
+  if (m_state.direction != RIGHT && m_state.direction != LEFT) {
+    throw Tunnelour::Exceptions::init_error("No Direction State! " + Avatar_State_Names::GetInstance()->GetStateName(GetState().state));
   }
 
+  // The texture coordinates cover the whole quad, GetUVRect() selects the
+  // animation frame and facing direction at draw time.
   // Top left
   m_frame->vertices[0].position = D3DXVECTOR3(left, top, 0.0f);
-  if (m_state.direction.compare("Right") == 0) {
-    m_frame->vertices[0].texture =  D3DXVECTOR2(m_texture->top_left_position.x / m_texture->texture_size.x ,
-                                                m_texture->top_left_position.y / m_texture->texture_size.y);
-  } else {
-    // TOP Left NOW TOP Right
-    m_frame->vertices[0].texture = D3DXVECTOR2((m_texture->tile_size.x + m_texture->top_left_position.x) / m_texture->texture_size.x,
-                                                m_texture->top_left_position.y / m_texture->texture_size.y);
-  }
+  m_frame->vertices[0].texture = D3DXVECTOR2(0.0f, 0.0f);
 
   // Bottom right
   m_frame->vertices[1].position = D3DXVECTOR3(right, bottom, 0.0f);
-  if (m_state.direction.compare("Right") == 0) {
-    m_frame->vertices[1].texture = D3DXVECTOR2((m_texture->tile_size.x + m_texture->top_left_position.x) / m_texture->texture_size.x,
-                                               (m_texture->tile_size.y + m_texture->top_left_position.y) / m_texture->texture_size.y);
-  } else {
-    // BOTTOM Right NOW BOTTOM Left
-    m_frame->vertices[1].texture = D3DXVECTOR2(m_texture->top_left_position.x / m_texture->texture_size.x,
-                                              (m_texture->tile_size.y + m_texture->top_left_position.y) / m_texture->texture_size.y);
-  }
+  m_frame->vertices[1].texture = D3DXVECTOR2(1.0f, 1.0f);
 
   // Bottom left
   m_frame->vertices[2].position = D3DXVECTOR3(left, bottom, 0.0f);
-  if (m_state.direction.compare("Right") == 0) {
-    m_frame->vertices[2].texture = D3DXVECTOR2(m_texture->top_left_position.x / m_texture->texture_size.x,
-                                              (m_texture->tile_size.y + m_texture->top_left_position.y) / m_texture->texture_size.y);
-  } else {
-    // BOTTOM Left NOW BOTTOM Right
-    m_frame->vertices[2].texture = D3DXVECTOR2((m_texture->tile_size.x + m_texture->top_left_position.x) / m_texture->texture_size.x,
-                                               (m_texture->tile_size.y + m_texture->top_left_position.y) / m_texture->texture_size.y);
-  }
+  m_frame->vertices[2].texture = D3DXVECTOR2(0.0f, 1.0f);
 
   // Second triangle.
   // Top left
@@ -201,14 +226,7 @@ void Avatar_Component::Init_Frame() {
   m_frame->vertices[3].texture = m_frame->vertices[0].texture;
   // Top right
   m_frame->vertices[4].position = D3DXVECTOR3(right, top, 0.0f);
-  if (m_state.direction.compare("Right") == 0) {
-    m_frame->vertices[4].texture = D3DXVECTOR2((m_texture->tile_size.x + m_texture->top_left_position.x) / m_texture->texture_size.x,
-                                                m_texture->top_left_position.y / m_texture->texture_size.y);
-  } else {
-    // TOP Right NOW TOP Left
-    m_frame->vertices[4].texture =  D3DXVECTOR2(m_texture->top_left_position.x / m_texture->texture_size.x,
-                                                m_texture->top_left_position.y / m_texture->texture_size.y);
-  }
+  m_frame->vertices[4].texture = D3DXVECTOR2(1.0f, 0.0f);
   // Bottom right
   m_frame->vertices[5].position = D3DXVECTOR3(right, bottom, 0.0f);
   m_frame->vertices[5].texture = m_frame->vertices[1].texture;
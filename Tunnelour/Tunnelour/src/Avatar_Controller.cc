@@ -19,21 +19,29 @@
 #include <stdio.h>
 #include <windows.h>
 
+#include <algorithm>
 #include <ctime>
 
+#include "Get_Game_Metrics_Component_Mutator.h"
+
 namespace Tunnelour {
 
 //------------------------------------------------------------------------------
 // public:
 //------------------------------------------------------------------------------
-Avatar_Controller::Avatar_Controller() : Controller() {
+Avatar_Controller::Avatar_Controller() : Controller(), m_snapshots(SNAPSHOT_FIELD_COUNT, 64 * 1024, 32) {
   m_model = 0;
   m_avatar = 0;
   m_game_settings = 0;
   m_level = 0;
   m_world_settings = 0;
+  m_tile_class_index = 0;
+  m_game_metrics = 0;
+  m_camera = 0;
 
-  m_current_metadata_file_path = "";
+  m_snapshot_fields.assign(SNAPSHOT_FIELD_COUNT, 0);
+  m_checkpoint.assign(SNAPSHOT_FIELD_COUNT, 0);
+  m_is_rewinding = false;
 
   m_frequency = 0;
   m_ticksPerMs = 0;
@@ -55,13 +63,15 @@ Avatar_Controller::Avatar_Controller() : Controller() {
   m_vertical_jump_x_initial_velocity = 4;
   m_wall_jump_y_initial_velocity = 16;
 
-  m_avatar_initial_direction = "Right";
-  m_avatar_initial_parent_state = "Charlie_Standing";
-  m_avatar_initial_state = "Initial";
+  m_avatar_initial_direction = Avatar_Component::RIGHT;
+  m_avatar_initial_parent_state = Avatar_Component::CHARLIE_STANDING;
+  m_avatar_initial_state = Avatar_Component::INITIAL;
   m_avatar_initial_position = D3DXVECTOR3(0, 0, 0);
 
   m_avatar_z_position = -2;  // Middleground Z Space is -1
 
+  m_max_state_transitions_per_tick = 8;
+
   m_running_file_name = L"Charlie_Running_Animation_Tileset.txt";
   m_standing_file_name = L"Charlie_Standing_Animation_Tileset.txt";
   m_falling_file_name = L"Charlie_Falling_Animation_Tileset.txt";
@@ -71,18 +81,13 @@ Avatar_Controller::Avatar_Controller() : Controller() {
 
 //------------------------------------------------------------------------------
 Avatar_Controller::~Avatar_Controller() {
-  if (m_model != 0) {
-    m_model->IgnoreType(this, "Bitmap_Component");
-    m_model = 0;
-  }
+  m_model = 0;
   m_avatar = 0;
   m_game_settings = 0;
   m_level = 0;
   m_world_settings = 0;
 
-  m_current_metadata_file_path = "";
-
-  m_animation_metadata.clear();
+  m_animation_library.Clear();
 
   m_frequency = 0;
   m_ticksPerMs = 0;
@@ -92,9 +97,15 @@ Avatar_Controller::~Avatar_Controller() {
   m_animation_tick = false;
   m_current_animation_fps = 0;
 
-  m_floor_tiles.clear();
-  m_wall_tiles.clear();
-  m_ledge_tiles.clear();
+  m_tile_class_index = 0;
+  m_game_metrics = 0;
+
+  m_crowd.Clear();
+  m_crowd_avatars.clear();
+
+  m_snapshots.Clear();
+  m_camera = 0;
+  m_is_rewinding = false;
 
   m_y_fallen = 0;
 
@@ -108,9 +119,9 @@ Avatar_Controller::~Avatar_Controller() {
   m_vertical_jump_x_initial_velocity = 4;
   m_wall_jump_y_initial_velocity = 16;
 
-  m_avatar_initial_direction = "Right";
-  m_avatar_initial_parent_state = "Charlie_Standing";
-  m_avatar_initial_state = "Initial";
+  m_avatar_initial_direction = Avatar_Component::RIGHT;
+  m_avatar_initial_parent_state = Avatar_Component::CHARLIE_STANDING;
+  m_avatar_initial_state = Avatar_Component::INITIAL;
   m_avatar_initial_position = D3DXVECTOR3(0, 0, 0);
 }
 
@@ -127,13 +138,14 @@ bool Avatar_Controller::Init(Component_Composite * const model) {
       m_game_settings = mutator.GetGameSettings();
       m_world_settings = mutator.GetWorldSettings();
       m_level = mutator.GetLevel();
+      m_tile_class_index = mutator.GetTileClassIndex();
+      m_camera = mutator.GetCamera();
       LoadTilesets(m_game_settings->GetTilesetPath());
       CreateAvatar();
+      InitStateControllers();
       m_model->Add(m_avatar);
-      m_floor_tiles = mutator.GetFloorTiles();
-      m_wall_tiles = mutator.GetWallTiles();
-      m_ledge_tiles = mutator.GetLedgeTiles();
-      m_model->ObserveType(this, "Bitmap_Component");
+      m_crowd.Init(&m_animation_library, m_tile_class_index->GetTiles(), m_world_settings);
+      CreateCrowd();
       m_has_been_initialised = true;
     } else {
       m_model = 0;
@@ -149,8 +161,13 @@ bool Avatar_Controller::Run() {
   bool result = false;
   if (m_has_been_initialised) {
     IsItTimeToAnimateAFrame();
-    if (m_animation_tick) {
+    if (m_animation_tick && m_is_rewinding) {
+      RewindAvatar(1);
+      m_animation_tick = false;
+    } else if (m_animation_tick) {
       RunAvatarState();
+      RunCrowd();
+      RecordSnapshot();
     }
 
     result = true;
@@ -159,81 +176,20 @@ bool Avatar_Controller::Run() {
   return result;
 }
 
-//------------------------------------------------------------------------------
-void Avatar_Controller::HandleEventAdd(Tunnelour::Component * const component) {
-  Tile_Bitmap *tile = 0;
-  tile = static_cast<Tile_Bitmap*>(component);
-  if (tile->IsFloor()) {
-    m_floor_tiles.push_back(tile);
-  }
-  if (tile->IsWall()) {
-    m_wall_tiles.push_back(tile);
-  }
-  if (tile->IsWall() && tile->IsFloor()) {
-    m_ledge_tiles.push_back(tile);
-  }
-}
-
-//------------------------------------------------------------------------------
-void Avatar_Controller::HandleEventRemove(Tunnelour::Component * const component) {
-  Tunnelour::Tile_Bitmap *target_bitmap = 0;
-  target_bitmap = static_cast<Tunnelour::Tile_Bitmap*>(component);
-  std::vector<Tile_Bitmap*>::iterator found_bitmap;
-  bool found = false;
-  if (target_bitmap->IsWall()) {
-    std::vector<Tile_Bitmap*>::iterator bitmap;
-    for (bitmap = m_wall_tiles.begin(); bitmap != m_wall_tiles.end(); bitmap++) {
-      if ((*bitmap)->GetID() == target_bitmap->GetID()) {
-        found_bitmap = bitmap;
-        found = true;
-      }
-    }
-    if (found) {
-      m_wall_tiles.erase(found_bitmap);
-    }
-  }
-  found = false;
-  if (target_bitmap->IsFloor()) {
-    std::vector<Tile_Bitmap*>::iterator bitmap;
-    for (bitmap = m_floor_tiles.begin(); bitmap != m_floor_tiles.end(); bitmap++) {
-      if ((*bitmap)->GetID() == target_bitmap->GetID()) {
-        found_bitmap = bitmap;
-        found = true;
-      }
-    }
-    if (found) {
-      m_floor_tiles.erase(found_bitmap);
-    }
-  }
-  found = false;
-  if (target_bitmap->IsFloor() && target_bitmap->IsWall()) {
-    std::vector<Tile_Bitmap*>::iterator bitmap;
-    for (bitmap = m_ledge_tiles.begin(); bitmap != m_ledge_tiles.end(); bitmap++) {
-      if ((*bitmap)->GetID() == target_bitmap->GetID()) {
-        found_bitmap = bitmap;
-        found = true;
-      }
-    }
-    if (found) {
-      m_ledge_tiles.erase(found_bitmap);
-    }
-  }
-}
-
-//------------------------------------------------------------------------------
-void Avatar_Controller::HandleEventUpdate(Tunnelour::Component * const component) {
-  HandleEventRemove(component);
-  HandleEventAdd(component);
-}
-
 //------------------------------------------------------------------------------
 void Avatar_Controller::HideAvatar() {
   m_avatar->GetTexture()->transparency = 0.0f;
+  for (unsigned int index = 0; index < m_crowd_avatars.size(); index++) {
+    m_crowd_avatars[index]->GetTexture()->transparency = 0.0f;
+  }
 }
 
 //------------------------------------------------------------------------------
 void Avatar_Controller::ShowAvatar() {
   m_avatar->GetTexture()->transparency = 1.0f;
+  for (unsigned int index = 0; index < m_crowd_avatars.size(); index++) {
+    m_crowd_avatars[index]->GetTexture()->transparency = 1.0f;
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -250,13 +206,66 @@ void Avatar_Controller::ResetAvatarToDefaults() {
   m_avatar->SetVelocity(m_avatar_initial_position);
   Avatar_Helper::SetAvatarState(m_avatar,
                                 m_game_settings->GetTilesetPath(),
-                               &m_animation_metadata,
+                               &m_animation_library,
                                 m_avatar_initial_parent_state,
                                 m_avatar_initial_state,
-                                initial_state.direction,
-                                &m_current_metadata_file_path,
-                                &m_current_metadata,
-                                &m_current_animation_subset);
+                                initial_state.direction);
+
+  m_crowd.Reset();
+  UpdateCrowdAvatars();
+
+  m_snapshots.Clear();
+  RecordSnapshot();
+  m_checkpoint = m_snapshot_fields;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Controller::SetMaxStateTransitionsPerTick(unsigned int max_state_transitions_per_tick) {
+  m_max_state_transitions_per_tick = max_state_transitions_per_tick;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Controller::AddCrowdAvatar(D3DXVECTOR3 position, Avatar_Component::Direction direction) {
+  unsigned int index = m_crowd.Add(position, direction);
+
+  // The crowd's avatars have a type of their own so the view draws them but
+  // nothing looking for the player's Avatar_Component finds them.
+  Avatar_Component *avatar = new Avatar_Component();
+  avatar->SetType("Crowd_Avatar_Component");
+  avatar->SetPosition(m_crowd.GetPosition(index));
+  avatar->SetFixedPosition(m_crowd.GetFixedPosition(index));
+  Avatar_Helper::SetAvatarState(avatar,
+                                m_game_settings->GetTilesetPath(),
+                               &m_animation_library,
+                                m_crowd.GetParentState(index),
+                                m_crowd.GetState(index),
+                                m_crowd.GetDirection(index));
+  m_crowd_avatars.push_back(avatar);
+  m_model->Add(avatar);
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Controller::SetIsRewinding(bool is_rewinding) {
+  m_is_rewinding = is_rewinding;
+}
+
+//------------------------------------------------------------------------------
+bool Avatar_Controller::RewindAvatar(unsigned int ticks) {
+  if (!m_snapshots.Rewind(ticks, &m_snapshot_fields[0])) {
+    return false;
+  }
+  RestoreSnapshot(m_snapshot_fields);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Controller::RestartFromCheckpoint() {
+  m_snapshots.Clear();
+  m_snapshots.Push(&m_checkpoint[0]);
+  m_snapshot_fields = m_checkpoint;
+  RestoreSnapshot(m_checkpoint);
+  m_crowd.Reset();
+  UpdateCrowdAvatars();
 }
 
 //------------------------------------------------------------------------------
@@ -272,156 +281,245 @@ void Avatar_Controller::CreateAvatar() {
 }
 
 //------------------------------------------------------------------------------
-void Avatar_Controller::RunAvatarState() {
-  std::string current_state = m_avatar->GetState().parent_state;
+void Avatar_Controller::InitStateControllers() {
+  m_state_controllers.assign(Avatar_Component::KNOWN_STATE_COUNT, 0);
+  m_state_controllers[Avatar_Component::CHARLIE_STANDING] = &m_charlie_standing_controller;
+  m_state_controllers[Avatar_Component::CHARLIE_FALLING] = &m_charlie_falling_controller;
+  m_state_controllers[Avatar_Component::CHARLIE_RUNNING] = &m_charlie_running_controller;
+  m_state_controllers[Avatar_Component::CHARLIE_JUMPING] = &m_charlie_jumping_controller;
+  m_state_controllers[Avatar_Component::CHARLIE_CLIMBING] = &m_charlie_climbing_controller;
+
+  std::vector<Avatar_State_Controller*>::iterator state_controller;
+  for (state_controller = m_state_controllers.begin(); state_controller != m_state_controllers.end(); state_controller++) {
+    if ((*state_controller) != 0) {
+      InitStateController(*state_controller);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Controller::InitStateController(Avatar_State_Controller *state_controller) {
+  if (!state_controller->HasBeenInitalised()) {
+    state_controller->Init(m_model);
+    state_controller->SetAvatarComponent(m_avatar);
+    state_controller->SetTiles(m_tile_class_index->GetTiles());
+    state_controller->SetGameSettings(m_game_settings);
+    state_controller->SetAnimationLibrary(&m_animation_library);
+    state_controller->SetCurrentlyAdjacentWallTile(&m_adjacent_wall);
+    state_controller->SetWorldSettings(m_world_settings);
+    state_controller->SetLastFrameTime(&m_last_frame_time);
+    state_controller->SetYFallen(&m_y_fallen);
+    state_controller->SetDistanceTraveled(&m_distance_traveled);
+    state_controller->SetIsMovingContinuously(&m_is_moving_continuously);
+    state_controller->SetCurrentlyGrabbedTile(m_currently_grabbed_tile);
+  }
+}
 
+//------------------------------------------------------------------------------
+void Avatar_Controller::RunAvatarState() {
   if (m_avatar->GetTexture()->transparency != 0.0f) {
-    if (current_state.compare("Charlie_Standing") == 0) {
-      if (!m_charlie_standing_controller.HasBeenInitalised()) {
-        m_charlie_standing_controller.Init(m_model);
-        m_charlie_standing_controller.SetAvatarComponent(m_avatar);
-        m_charlie_standing_controller.SetGameSettings(m_game_settings);
-        m_charlie_standing_controller.SetAnimationMetadata(&m_animation_metadata);
-        m_charlie_standing_controller.SetCurrentAnimationSubset(&m_current_animation_subset);
-        m_charlie_standing_controller.SetCurrentlyAdjacentWallTile(&m_adjacent_wall);
-        m_charlie_standing_controller.SetCurrentMetadataFilePath(&m_current_metadata_file_path);
-        m_charlie_standing_controller.SetCurrentMetadata(&m_current_metadata);
-        m_charlie_standing_controller.SetWorldSettings(m_world_settings);
-        m_charlie_standing_controller.SetLastFrameTime(&m_last_frame_time);
-        m_charlie_standing_controller.SetYFallen(&m_y_fallen);
-        m_charlie_standing_controller.SetDistanceTraveled(&m_distance_traveled);
-        m_charlie_standing_controller.SetIsMovingContinuously(&m_is_moving_continuously);
-        m_charlie_standing_controller.SetCurrentlyGrabbedTile(m_currently_grabbed_tile);
+    INT64 start_time = 0;
+    QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&start_time));
+
+    unsigned int transitions = 0;
+    bool is_cut_short = false;
+    m_resolved_states.clear();
+    while (true) {
+      Avatar_Component::Avatar_State const &current_state = m_avatar->GetState();
+      Avatar_State_Controller *state_controller = 0;
+      if (current_state.parent_state < m_state_controllers.size()) {
+        state_controller = m_state_controllers[current_state.parent_state];
       }
-
-      if (m_charlie_standing_controller.HasBeenInitalised()) {
-        m_charlie_standing_controller.SetFloorTiles(m_floor_tiles);
-        m_charlie_standing_controller.SetWallTiles(m_wall_tiles);
-        m_charlie_standing_controller.SetLedgeTiles(m_ledge_tiles);
-        m_charlie_standing_controller.Run();
+      if (state_controller == 0 || !state_controller->HasBeenInitalised()) {
+        break;
       }
 
-      if (m_charlie_standing_controller.HasAvatarStateChanged()) {
-        RunAvatarState();
-      }
-    } else if (current_state.compare("Charlie_Falling") == 0) {
-      if (!m_charlie_falling_controller.HasBeenInitalised()) {
-        m_charlie_falling_controller.Init(m_model);
-        m_charlie_falling_controller.SetAvatarComponent(m_avatar);
-        m_charlie_falling_controller.SetGameSettings(m_game_settings);
-        m_charlie_falling_controller.SetAnimationMetadata(&m_animation_metadata);
-        m_charlie_falling_controller.SetCurrentAnimationSubset(&m_current_animation_subset);
-        m_charlie_falling_controller.SetCurrentlyAdjacentWallTile(&m_adjacent_wall);
-        m_charlie_falling_controller.SetCurrentMetadataFilePath(&m_current_metadata_file_path);
-        m_charlie_falling_controller.SetCurrentMetadata(&m_current_metadata);
-        m_charlie_falling_controller.SetWorldSettings(m_world_settings);
-        m_charlie_falling_controller.SetLastFrameTime(&m_last_frame_time);
-        m_charlie_falling_controller.SetYFallen(&m_y_fallen);
-        m_charlie_falling_controller.SetDistanceTraveled(&m_distance_traveled);
-        m_charlie_falling_controller.SetIsMovingContinuously(&m_is_moving_continuously);
-        m_charlie_falling_controller.SetCurrentlyGrabbedTile(m_currently_grabbed_tile);
+      m_resolved_states.push_back(std::make_pair(current_state.parent_state, current_state.state));
+      state_controller->Run();
+      if (!state_controller->HasAvatarStateChanged()) {
+        break;
       }
 
-      if (m_charlie_falling_controller.HasBeenInitalised()) {
-        m_charlie_falling_controller.SetFloorTiles(m_floor_tiles);
-        m_charlie_falling_controller.SetWallTiles(m_wall_tiles);
-        m_charlie_falling_controller.SetLedgeTiles(m_ledge_tiles);
-        m_charlie_falling_controller.Run();
+      // The new state is run next tick if this tick has had enough
+      // transitions or the states are going round in a cycle.
+      transitions++;
+      std::pair<unsigned int, unsigned int> new_state(m_avatar->GetState().parent_state, m_avatar->GetState().state);
+      if (transitions >= m_max_state_transitions_per_tick ||
+          std::find(m_resolved_states.begin(), m_resolved_states.end(), new_state) != m_resolved_states.end()) {
+        is_cut_short = true;
+        break;
       }
+    }
 
-      if (m_charlie_falling_controller.HasAvatarStateChanged()) {
-        RunAvatarState();
-      }
-    } else if (current_state.compare("Charlie_Running") == 0) {
-      if (!m_charlie_running_controller.HasBeenInitalised()) {
-        m_charlie_running_controller.Init(m_model);
-        m_charlie_running_controller.SetAvatarComponent(m_avatar);
-        m_charlie_running_controller.SetGameSettings(m_game_settings);
-        m_charlie_running_controller.SetAnimationMetadata(&m_animation_metadata);
-        m_charlie_running_controller.SetCurrentAnimationSubset(&m_current_animation_subset);
-        m_charlie_running_controller.SetCurrentlyAdjacentWallTile(&m_adjacent_wall);
-        m_charlie_running_controller.SetCurrentMetadataFilePath(&m_current_metadata_file_path);
-        m_charlie_running_controller.SetCurrentMetadata(&m_current_metadata);
-        m_charlie_running_controller.SetWorldSettings(m_world_settings);
-        m_charlie_running_controller.SetLastFrameTime(&m_last_frame_time);
-        m_charlie_running_controller.SetYFallen(&m_y_fallen);
-        m_charlie_running_controller.SetDistanceTraveled(&m_distance_traveled);
-        m_charlie_running_controller.SetIsMovingContinuously(&m_is_moving_continuously);
-        m_charlie_running_controller.SetCurrentlyGrabbedTile(m_currently_grabbed_tile);
-      }
+    UpdateStateResolutionMetrics(transitions, start_time, is_cut_short);
+  } else {
+    m_avatar->SetPosition(0, 0, 0);
+  }
 
-      if (m_charlie_running_controller.HasBeenInitalised()) {
-        m_charlie_running_controller.SetFloorTiles(m_floor_tiles);
-        m_charlie_running_controller.SetWallTiles(m_wall_tiles);
-        m_charlie_running_controller.SetLedgeTiles(m_ledge_tiles);
-        m_charlie_running_controller.Run();
-      }
+  m_animation_tick = false;
+}
 
-      if (m_charlie_running_controller.HasAvatarStateChanged()) {
-        RunAvatarState();
-      }
-    } else if (current_state.compare("Charlie_Jumping") == 0) {
-      if (!m_charlie_jumping_controller.HasBeenInitalised()) {
-        m_charlie_jumping_controller.Init(m_model);
-        m_charlie_jumping_controller.SetAvatarComponent(m_avatar);
-        m_charlie_jumping_controller.SetGameSettings(m_game_settings);
-        m_charlie_jumping_controller.SetAnimationMetadata(&m_animation_metadata);
-        m_charlie_jumping_controller.SetCurrentAnimationSubset(&m_current_animation_subset);
-        m_charlie_jumping_controller.SetCurrentlyAdjacentWallTile(&m_adjacent_wall);
-        m_charlie_jumping_controller.SetCurrentMetadataFilePath(&m_current_metadata_file_path);
-        m_charlie_jumping_controller.SetCurrentMetadata(&m_current_metadata);
-        m_charlie_jumping_controller.SetWorldSettings(m_world_settings);
-        m_charlie_jumping_controller.SetLastFrameTime(&m_last_frame_time);
-        m_charlie_jumping_controller.SetYFallen(&m_y_fallen);
-        m_charlie_jumping_controller.SetDistanceTraveled(&m_distance_traveled);
-        m_charlie_jumping_controller.SetIsMovingContinuously(&m_is_moving_continuously);
-        m_charlie_jumping_controller.SetCurrentlyGrabbedTile(m_currently_grabbed_tile);
-      }
+//------------------------------------------------------------------------------
+void Avatar_Controller::UpdateStateResolutionMetrics(unsigned int transitions, INT64 start_time, bool is_cut_short) {
+  if (GetGameMetrics() == 0) {
+    return;
+  }
 
-      if (m_charlie_jumping_controller.HasBeenInitalised()) {
-        m_charlie_jumping_controller.SetFloorTiles(m_floor_tiles);
-        m_charlie_jumping_controller.SetWallTiles(m_wall_tiles);
-        m_charlie_jumping_controller.SetLedgeTiles(m_ledge_tiles);
-        m_charlie_jumping_controller.Run();
-      }
+  INT64 end_time = 0;
+  QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&end_time));
 
-      if (m_charlie_jumping_controller.HasAvatarStateChanged()) {
-        RunAvatarState();
-      }
-    } else if (current_state.compare("Charlie_Climbing") == 0) {
-      if (!m_charlie_climbing_controller.HasBeenInitalised()) {
-        m_charlie_climbing_controller.Init(m_model);
-        m_charlie_climbing_controller.SetAvatarComponent(m_avatar);
-        m_charlie_climbing_controller.SetGameSettings(m_game_settings);
-        m_charlie_climbing_controller.SetAnimationMetadata(&m_animation_metadata);
-        m_charlie_climbing_controller.SetCurrentAnimationSubset(&m_current_animation_subset);
-        m_charlie_climbing_controller.SetCurrentlyAdjacentWallTile(&m_adjacent_wall);
-        m_charlie_climbing_controller.SetCurrentMetadataFilePath(&m_current_metadata_file_path);
-        m_charlie_climbing_controller.SetCurrentMetadata(&m_current_metadata);
-        m_charlie_climbing_controller.SetWorldSettings(m_world_settings);
-        m_charlie_climbing_controller.SetLastFrameTime(&m_last_frame_time);
-        m_charlie_climbing_controller.SetYFallen(&m_y_fallen);
-        m_charlie_climbing_controller.SetDistanceTraveled(&m_distance_traveled);
-        m_charlie_climbing_controller.SetIsMovingContinuously(&m_is_moving_continuously);
-        m_charlie_climbing_controller.SetCurrentlyGrabbedTile(m_currently_grabbed_tile);
-      }
+  Game_Metrics_Component::State_Resolution_Data state_resolution_data = m_game_metrics->GetStateResolutionData();
+  state_resolution_data.transitions = transitions;
+  state_resolution_data.resolve_time_ms = static_cast<float>(end_time - start_time) / m_ticksPerMs;
+  if (transitions > state_resolution_data.max_transitions) {
+    state_resolution_data.max_transitions = transitions;
+  }
+  if (is_cut_short) {
+    state_resolution_data.cut_short_ticks++;
+  }
+  m_game_metrics->SetStateResolutionData(state_resolution_data);
+}
 
-      if (m_charlie_climbing_controller.HasBeenInitalised()) {
-        m_charlie_climbing_controller.SetFloorTiles(m_floor_tiles);
-        m_charlie_climbing_controller.SetWallTiles(m_wall_tiles);
-        m_charlie_climbing_controller.SetLedgeTiles(m_ledge_tiles);
-        m_charlie_climbing_controller.Run();
-      }
+//------------------------------------------------------------------------------
+void Avatar_Controller::CreateCrowd() {
+  D3DXVECTOR3 start_position = D3DXVECTOR3(m_level->GetCurrentLevel().start_avatar_top_left_x,
+                                           m_level->GetCurrentLevel().start_avatar_top_left_y,
+                                           m_avatar_z_position);
+  for (unsigned int index = 0; index < m_game_settings->GetCrowdSize(); index++) {
+    if (index % 2) {
+      AddCrowdAvatar(start_position, Avatar_Component::LEFT);
+    } else {
+      AddCrowdAvatar(start_position, Avatar_Component::RIGHT);
+    }
+  }
+}
 
-      if (m_charlie_climbing_controller.HasAvatarStateChanged()) {
-        RunAvatarState();
-      }
+//------------------------------------------------------------------------------
+void Avatar_Controller::RunCrowd() {
+  if (m_crowd.GetSize() == 0 || m_avatar->GetTexture()->transparency == 0.0f) {
+    return;
+  }
+
+  INT64 start_time = 0;
+  QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&start_time));
+  m_crowd.Update();
+  INT64 end_time = 0;
+  QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&end_time));
+
+  UpdateCrowdAvatars();
+
+  if (GetGameMetrics() == 0) {
+    return;
+  }
+  Game_Metrics_Component::Crowd_Data crowd_data;
+  crowd_data.avatars = m_crowd.GetSize();
+  crowd_data.threads = m_crowd.GetLastThreadCount();
+  crowd_data.update_time_ms = static_cast<float>(end_time - start_time) / m_ticksPerMs;
+  crowd_data.avatars_per_ms = 0;
+  if (crowd_data.update_time_ms > 0) {
+    crowd_data.avatars_per_ms = crowd_data.avatars / crowd_data.update_time_ms;
+  }
+  m_game_metrics->SetCrowdData(crowd_data);
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Controller::UpdateCrowdAvatars() {
+  for (unsigned int index = 0; index < m_crowd_avatars.size(); index++) {
+    Avatar_Component *avatar = m_crowd_avatars[index];
+    Avatar_Component::Avatar_State const &state = avatar->GetState();
+    if (state.parent_state != m_crowd.GetParentState(index) ||
+        state.state != m_crowd.GetState(index) ||
+        state.direction != m_crowd.GetDirection(index)) {
+      Avatar_Helper::SetAvatarState(avatar,
+                                    m_game_settings->GetTilesetPath(),
+                                   &m_animation_library,
+                                    m_crowd.GetParentState(index),
+                                    m_crowd.GetState(index),
+                                    m_crowd.GetDirection(index));
     }
-  } else {
-    m_avatar->SetPosition(0, 0, 0);
+    if (avatar->GetState().state_index != m_crowd.GetStateIndex(index)) {
+      Avatar_Helper::SetAvatarStateAnimationFrame(avatar, m_crowd.GetStateIndex(index), &m_animation_library);
+    }
+    avatar->SetFixedPosition(m_crowd.GetFixedPosition(index));
   }
+}
 
-  m_animation_tick = false;
+//------------------------------------------------------------------------------
+Game_Metrics_Component* Avatar_Controller::GetGameMetrics() {
+  if (m_game_metrics == 0) {
+    Get_Game_Metrics_Component_Mutator mutator;
+    m_model->Apply(&mutator);
+    if (mutator.WasSuccessful()) {
+      m_game_metrics = mutator.GetGameMetrics();
+    }
+  }
+  return m_game_metrics;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Controller::RecordSnapshot() {
+  Fixed_Point position = m_avatar->GetFixedPosition();
+  Fixed_Point velocity = m_avatar->GetFixedVelocity();
+  Avatar_Component::Avatar_State const &state = m_avatar->GetState();
+  m_snapshot_fields[AVATAR_X] = position.x;
+  m_snapshot_fields[AVATAR_Y] = position.y;
+  m_snapshot_fields[AVATAR_Z] = Fixed_Pixel_Helper::FromPixels(m_avatar->GetPosition()->z);
+  m_snapshot_fields[VELOCITY_X] = velocity.x;
+  m_snapshot_fields[VELOCITY_Y] = velocity.y;
+  m_snapshot_fields[PARENT_STATE] = static_cast<int>(state.parent_state);
+  m_snapshot_fields[STATE] = static_cast<int>(state.state);
+  m_snapshot_fields[STATE_INDEX] = static_cast<int>(state.state_index);
+  m_snapshot_fields[DIRECTION] = static_cast<int>(state.direction);
+
+  if (m_camera != 0) {
+    D3DXVECTOR3 camera_position = m_camera->GetPosition();
+    m_snapshot_fields[CAMERA_X] = Fixed_Pixel_Helper::FromPixels(camera_position.x);
+    m_snapshot_fields[CAMERA_Y] = Fixed_Pixel_Helper::FromPixels(camera_position.y);
+    m_snapshot_fields[CAMERA_Z] = Fixed_Pixel_Helper::FromPixels(camera_position.z);
+  }
+
+  m_snapshot_fields[Y_FALLEN] = Fixed_Pixel_Helper::FromPixels(m_y_fallen);
+  m_snapshot_fields[DISTANCE_TRAVELED] = Fixed_Pixel_Helper::FromPixels(m_distance_traveled);
+  if (GetGameMetrics() != 0) {
+    m_snapshot_fields[METRICS_DISTANCE] = Fixed_Pixel_Helper::FromPixels(static_cast<float>(m_game_metrics->GetDistanceTraveled()));
+    m_snapshot_fields[SECONDS_PAST] = static_cast<int>(m_game_metrics->GetSecondsPast() * 1000);
+  }
+
+  m_snapshots.Push(&m_snapshot_fields[0]);
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Controller::RestoreSnapshot(std::vector<int> const &fields) {
+  // z is set first, the fixed position then replaces the rounded x and y
+  m_avatar->SetPosition(0, 0, Fixed_Pixel_Helper::ToPixels(fields[AVATAR_Z]));
+  m_avatar->SetFixedPosition(Fixed_Point(fields[AVATAR_X], fields[AVATAR_Y]));
+  m_avatar->SetFixedVelocity(Fixed_Point(fields[VELOCITY_X], fields[VELOCITY_Y]));
+  Avatar_Component::Avatar_State const &state = m_avatar->GetState();
+  if (state.parent_state != static_cast<unsigned int>(fields[PARENT_STATE]) ||
+      state.state != static_cast<unsigned int>(fields[STATE]) ||
+      state.direction != static_cast<Avatar_Component::Direction>(fields[DIRECTION])) {
+    Avatar_Helper::SetAvatarState(m_avatar,
+                                  m_game_settings->GetTilesetPath(),
+                                 &m_animation_library,
+                                  static_cast<unsigned int>(fields[PARENT_STATE]),
+                                  static_cast<unsigned int>(fields[STATE]),
+                                  static_cast<Avatar_Component::Direction>(fields[DIRECTION]));
+  }
+  if (m_avatar->GetState().state_index != static_cast<unsigned int>(fields[STATE_INDEX])) {
+    Avatar_Helper::SetAvatarStateAnimationFrame(m_avatar, static_cast<unsigned int>(fields[STATE_INDEX]), &m_animation_library);
+  }
+
+  if (m_camera != 0) {
+    m_camera->SetPosition(Fixed_Pixel_Helper::ToPixels(fields[CAMERA_X]),
+                          Fixed_Pixel_Helper::ToPixels(fields[CAMERA_Y]),
+                          Fixed_Pixel_Helper::ToPixels(fields[CAMERA_Z]));
+  }
+
+  m_y_fallen = Fixed_Pixel_Helper::ToPixels(fields[Y_FALLEN]);
+  m_distance_traveled = Fixed_Pixel_Helper::ToPixels(fields[DISTANCE_TRAVELED]);
+  if (GetGameMetrics() != 0) {
+    m_game_metrics->SetDistanceTraveled(Fixed_Pixel_Helper::ToPixels(fields[METRICS_DISTANCE]));
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -430,31 +528,33 @@ void Avatar_Controller::LoadTilesets(std::wstring wtileset_path) {
   std::string running_metadata_file_path = String_Helper::WStringToString(wtileset_path + m_running_file_name);
   Tileset_Helper::Animation_Tileset_Metadata running_metadata;
   Tileset_Helper::LoadAnimationTilesetMetadataIntoStruct(running_metadata_file_path, &running_metadata);
-  m_animation_metadata.push_back(running_metadata);
+  m_animation_library.Add(running_metadata);
 
   // Standing
   std::string standing_metadata_file_path = String_Helper::WStringToString(wtileset_path + m_standing_file_name);
   Tileset_Helper::Animation_Tileset_Metadata standing_metadata;
   Tileset_Helper::LoadAnimationTilesetMetadataIntoStruct(standing_metadata_file_path, &standing_metadata);
-  m_animation_metadata.push_back(standing_metadata);
+  m_animation_library.Add(standing_metadata);
 
   // Falling
   std::string falling_metadata_file_path = String_Helper::WStringToString(wtileset_path + m_falling_file_name);
   Tileset_Helper::Animation_Tileset_Metadata falling_metadata;
   Tileset_Helper::LoadAnimationTilesetMetadataIntoStruct(falling_metadata_file_path, &falling_metadata);
-  m_animation_metadata.push_back(falling_metadata);
+  m_animation_library.Add(falling_metadata);
 
   // Jumping
   std::string jumping_metadata_file_path = String_Helper::WStringToString(wtileset_path + m_jumping_file_name);
   Tileset_Helper::Animation_Tileset_Metadata jumping_metadata;
   Tileset_Helper::LoadAnimationTilesetMetadataIntoStruct(jumping_metadata_file_path, &jumping_metadata);
-  m_animation_metadata.push_back(jumping_metadata);
+  m_animation_library.Add(jumping_metadata);
 
   // Climbing
   std::string climbing_metadata_file_path = String_Helper::WStringToString(wtileset_path + m_climbing_file_name);
   Tileset_Helper::Animation_Tileset_Metadata climbing_metadata;
   Tileset_Helper::LoadAnimationTilesetMetadataIntoStruct(climbing_metadata_file_path, &climbing_metadata);
-  m_animation_metadata.push_back(climbing_metadata);
+  m_animation_library.Add(climbing_metadata);
+
+  m_animation_library.Build();
 }
 
 //------------------------------------------------------------------------------
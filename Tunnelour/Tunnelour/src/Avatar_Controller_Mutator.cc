@@ -23,26 +23,26 @@ namespace Tunnelour {
 Avatar_Controller_Mutator::Avatar_Controller_Mutator() {
   m_found_game_settings = false;
   m_game_settings = 0;
-  m_floor_tiles.clear();
   m_found_world_settings = false;
   m_world_settings = 0;
-  m_wall_tiles.clear();
-  m_ledge_tiles.clear();
+  m_found_tile_class_index = false;
+  m_tile_class_index = 0;
   m_found_level = false;
   m_level = 0;
+  m_camera = 0;
 }
 
 //------------------------------------------------------------------------------
 Avatar_Controller_Mutator::~Avatar_Controller_Mutator() {
   m_found_game_settings = false;
   m_game_settings = 0;
-  m_floor_tiles.clear();
   m_found_world_settings = false;
   m_world_settings = 0;
-  m_wall_tiles.clear();
-  m_ledge_tiles.clear();
+  m_found_tile_class_index = false;
+  m_tile_class_index = 0;
   m_found_level = false;
   m_level = 0;
+  m_camera = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -52,24 +52,17 @@ void Avatar_Controller_Mutator::Mutate(Component * const component) {
     game_settings = static_cast<Game_Settings_Component*>(component);
     m_game_settings = game_settings;
     m_found_game_settings = true;
-  } else if (component->GetType().compare("Bitmap_Component") == 0) {
-    Tile_Bitmap *tile = 0;
-    tile = static_cast<Tile_Bitmap*>(component);
-    if (tile->IsFloor()) {
-      m_floor_tiles.push_back(tile);
-    }
-    if (tile->IsWall()) {
-      m_wall_tiles.push_back(tile);
-    }
-    if (tile->IsWall() && tile->IsFloor()) {
-      m_ledge_tiles.push_back(tile);
-    }
+  } else if (component->GetType().compare("Tile_Class_Index_Component") == 0) {
+    m_tile_class_index = static_cast<Tile_Class_Index_Component*>(component);
+    m_found_tile_class_index = true;
   } else if (component->GetType().compare("World_Settings_Component") == 0) {
     m_world_settings = static_cast<World_Settings_Component*>(component);
     m_found_world_settings = true;
   } else if (component->GetType().compare("Level_Component") == 0) {
     m_level = static_cast<Level_Component*>(component);
     m_found_level = true;
+  } else if (component->GetType().compare("Camera_Component") == 0) {
+    m_camera = static_cast<Camera_Component*>(component);
   }
 }
 
@@ -79,18 +72,8 @@ Game_Settings_Component* const Avatar_Controller_Mutator::GetGameSettings() {
 }
 
 //------------------------------------------------------------------------------
-std::vector<Tile_Bitmap*> Avatar_Controller_Mutator::GetFloorTiles() {
-  return m_floor_tiles;
-}
-
-//------------------------------------------------------------------------------
-std::vector<Tile_Bitmap*> Avatar_Controller_Mutator::GetWallTiles() {
-  return m_wall_tiles;
-}
-
-//------------------------------------------------------------------------------
-std::vector<Tile_Bitmap*> Avatar_Controller_Mutator::GetLedgeTiles() {
-  return m_ledge_tiles;
+Tile_Class_Index_Component* Avatar_Controller_Mutator::GetTileClassIndex() {
+  return m_tile_class_index;
 }
 
 //------------------------------------------------------------------------------
@@ -103,9 +86,14 @@ Level_Component* Avatar_Controller_Mutator::GetLevel() {
   return m_level;
 }
 
+//------------------------------------------------------------------------------
+Camera_Component* Avatar_Controller_Mutator::GetCamera() {
+  return m_camera;
+}
+
 //------------------------------------------------------------------------------
 bool Avatar_Controller_Mutator::WasSuccessful() {
-  return m_found_game_settings && m_found_world_settings && m_found_level;
+  return m_found_game_settings && m_found_world_settings && m_found_level && m_found_tile_class_index;
 }
 
 }  // namespace Tunnelour
@@ -0,0 +1,393 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include "Avatar_Crowd.h"
+
+#include <string>
+
+#include "Avatar_Helper.h"
+#include "Avatar_State_Names.h"
+#include "Exceptions.h"
+#include "Tile_Bitmap.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Avatar_Crowd::Avatar_Crowd() {
+  m_animation_library = 0;
+  m_tiles = 0;
+  m_world_settings = 0;
+
+  m_behaviour_animations[RUNNING].parent_state = Avatar_Component::CHARLIE_RUNNING;
+  m_behaviour_animations[RUNNING].state = Avatar_Component::RUNNING;
+  m_behaviour_animations[FALLING].parent_state = Avatar_Component::CHARLIE_FALLING;
+  m_behaviour_animations[FALLING].state = Avatar_Component::DOWN_FACING_FALLING;
+  for (unsigned int behaviour = 0; behaviour < BEHAVIOUR_COUNT; behaviour++) {
+    m_behaviour_animations[behaviour].handle = Animation_Library::NO_SUBSET;
+    m_behaviour_animations[behaviour].number_of_frames = 0;
+    m_behaviour_animations[behaviour].is_repeatable = false;
+  }
+
+  // The same speed as Charlie_Running_Controller's running
+  m_running_x_velocity = 32;
+  m_avatars_per_thread = 256;
+  m_max_thread_count = 0;
+  m_last_thread_count = 0;
+
+  m_tick = 0;
+  m_tick_worker_count = 0;
+  m_tick_range_size = 0;
+  m_tick_size = 0;
+  m_busy_worker_count = 0;
+  m_is_stopping = false;
+}
+
+//------------------------------------------------------------------------------
+Avatar_Crowd::~Avatar_Crowd() {
+  StopWorkers();
+  Clear();
+  m_animation_library = 0;
+  m_tiles = 0;
+  m_world_settings = 0;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::Init(Animation_Library *animation_library, Tile_Grid *tiles, World_Settings_Component *world_settings) {
+  m_animation_library = animation_library;
+  m_tiles = tiles;
+  m_world_settings = world_settings;
+
+  // The animations are found once here so stepping the crowd never has to
+  // look them up.
+  for (unsigned int behaviour = 0; behaviour < BEHAVIOUR_COUNT; behaviour++) {
+    Behaviour_Animation &animation = m_behaviour_animations[behaviour];
+    animation.handle = m_animation_library->Find(animation.parent_state, animation.state);
+    if (animation.handle == Animation_Library::NO_SUBSET) {
+      std::string error;
+      error = "Animation " + Avatar_State_Names::GetInstance()->GetStateName(animation.state);
+      error += " not found in State " + Avatar_State_Names::GetInstance()->GetStateName(animation.parent_state) + " Metadata";
+      throw Exceptions::init_error(error);
+    }
+    Tileset_Helper::Animation_Subset const &subset = m_animation_library->GetSubset(animation.handle);
+    animation.number_of_frames = subset.number_of_frames;
+    animation.is_repeatable = subset.is_repeatable;
+  }
+}
+
+//------------------------------------------------------------------------------
+unsigned int Avatar_Crowd::Add(D3DXVECTOR3 position, Avatar_Component::Direction direction) {
+  unsigned int index = GetSize();
+  m_position_x.push_back(Fixed_Pixel_Helper::FromPixels(position.x));
+  m_position_y.push_back(Fixed_Pixel_Helper::FromPixels(position.y));
+  m_velocity_x.push_back(0);
+  m_velocity_y.push_back(0);
+  m_direction.push_back(static_cast<unsigned char>(direction));
+  m_behaviour.push_back(RUNNING);
+  m_state_index.push_back(0);
+  m_collision_blocks.push_back(0);
+  m_spawn_position.push_back(position);
+  m_spawn_direction.push_back(static_cast<unsigned char>(direction));
+  SetBehaviour(index, RUNNING);
+  return index;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::Clear() {
+  m_position_x.clear();
+  m_position_y.clear();
+  m_velocity_x.clear();
+  m_velocity_y.clear();
+  m_direction.clear();
+  m_behaviour.clear();
+  m_state_index.clear();
+  m_collision_blocks.clear();
+  m_spawn_position.clear();
+  m_spawn_direction.clear();
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::Reset() {
+  for (unsigned int index = 0; index < GetSize(); index++) {
+    m_position_x[index] = Fixed_Pixel_Helper::FromPixels(m_spawn_position[index].x);
+    m_position_y[index] = Fixed_Pixel_Helper::FromPixels(m_spawn_position[index].y);
+    m_direction[index] = m_spawn_direction[index];
+    SetBehaviour(index, RUNNING);
+  }
+}
+
+//------------------------------------------------------------------------------
+unsigned int Avatar_Crowd::GetSize() {
+  return static_cast<unsigned int>(m_position_x.size());
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::Update() {
+  unsigned int size = GetSize();
+  unsigned int thread_count = 1;
+  if (m_avatars_per_thread != 0) {
+    thread_count = size / m_avatars_per_thread;
+  }
+  unsigned int max_thread_count = m_max_thread_count;
+  if (max_thread_count == 0) {
+    max_thread_count = std::thread::hardware_concurrency();
+  }
+  if (max_thread_count != 0 && thread_count > max_thread_count) {
+    thread_count = max_thread_count;
+  }
+  if (thread_count <= 1) {
+    Update(0, size);
+    m_last_thread_count = 1;
+    return;
+  }
+
+  // The workers step the first ranges while this thread steps the last
+  unsigned int worker_count = thread_count - 1;
+  unsigned int range_size = (size + thread_count - 1) / thread_count;
+  StartWorkers(worker_count);
+  {
+    std::lock_guard<std::mutex> lock(m_worker_mutex);
+    m_tick_worker_count = worker_count;
+    m_tick_range_size = range_size;
+    m_tick_size = size;
+    m_busy_worker_count = worker_count;
+    m_tick++;
+  }
+  m_tick_started.notify_all();
+
+  unsigned int first = worker_count * range_size;
+  if (first > size) {
+    first = size;
+  }
+  Update(first, size);
+
+  std::unique_lock<std::mutex> lock(m_worker_mutex);
+  while (m_busy_worker_count != 0) {
+    m_tick_finished.wait(lock);
+  }
+  m_last_thread_count = thread_count;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::Update(unsigned int first, unsigned int last) {
+  for (unsigned int index = first; index < last; index++) {
+    UpdateAvatar(index);
+  }
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::SetAvatarsPerThread(unsigned int avatars_per_thread) {
+  m_avatars_per_thread = avatars_per_thread;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::SetMaxThreadCount(unsigned int max_thread_count) {
+  m_max_thread_count = max_thread_count;
+}
+
+//------------------------------------------------------------------------------
+unsigned int Avatar_Crowd::GetLastThreadCount() {
+  return m_last_thread_count;
+}
+
+//------------------------------------------------------------------------------
+D3DXVECTOR3 Avatar_Crowd::GetPosition(unsigned int index) {
+  return Fixed_Pixel_Helper::ToPixels(GetFixedPosition(index), m_spawn_position[index].z);
+}
+
+//------------------------------------------------------------------------------
+Fixed_Point Avatar_Crowd::GetFixedPosition(unsigned int index) {
+  return Fixed_Point(m_position_x[index], m_position_y[index]);
+}
+
+//------------------------------------------------------------------------------
+Avatar_Component::Direction Avatar_Crowd::GetDirection(unsigned int index) {
+  return static_cast<Avatar_Component::Direction>(m_direction[index]);
+}
+
+//------------------------------------------------------------------------------
+unsigned int Avatar_Crowd::GetParentState(unsigned int index) {
+  return m_behaviour_animations[m_behaviour[index]].parent_state;
+}
+
+//------------------------------------------------------------------------------
+unsigned int Avatar_Crowd::GetState(unsigned int index) {
+  return m_behaviour_animations[m_behaviour[index]].state;
+}
+
+//------------------------------------------------------------------------------
+unsigned int Avatar_Crowd::GetStateIndex(unsigned int index) {
+  return m_state_index[index];
+}
+
+//------------------------------------------------------------------------------
+Avatar_Component::Frame_Collision_Blocks const * Avatar_Crowd::GetCollisionBlocks(unsigned int index) {
+  return m_collision_blocks[index];
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void Avatar_Crowd::UpdateAvatar(unsigned int index) {
+  AABB last_block = GetAvatarBlock(index);
+  Behaviour behaviour = static_cast<Behaviour>(m_behaviour[index]);
+
+  if (behaviour == RUNNING) {
+    // Turn around at a wall rather than run into it. The block's bottom
+    // pixel is left out so the floor being run on is not taken for a wall.
+    bool is_right = (m_direction[index] != Avatar_Component::LEFT);
+    Fixed_Pixel displacement_x = Fixed_Pixel_Helper::FromPixels(is_right ? m_running_x_velocity : -m_running_x_velocity);
+    m_velocity_x[index] = displacement_x;
+    AABB swept_block = AABB::FromFixedPixels(last_block.left + (is_right ? 0 : displacement_x),
+                                             last_block.right + (is_right ? displacement_x : 0),
+                                             last_block.bottom + Fixed_Pixel_Helper::ONE_PIXEL,
+                                             last_block.top);
+    unsigned int wall_class = is_right ? Tile_Bitmap::RIGHT_WALL : Tile_Bitmap::LEFT_WALL;
+    AABB wall;
+    if (m_tiles->FindTouchingBounds(swept_block, wall_class, &wall)) {
+      m_direction[index] = static_cast<unsigned char>(is_right ? Avatar_Component::LEFT : Avatar_Component::RIGHT);
+      m_velocity_x[index] = 0;
+    } else {
+      m_position_x[index] += m_velocity_x[index];
+    }
+
+    // Fall once there is no floor under the block
+    AABB block = GetAvatarBlock(index);
+    AABB underfoot = AABB::FromFixedPixels(block.left,
+                                           block.right,
+                                           block.bottom - Fixed_Pixel_Helper::ONE_PIXEL,
+                                           block.bottom);
+    AABB floor;
+    if (!m_tiles->FindTouchingBounds(underfoot, Tile_Bitmap::FLOOR, &floor)) {
+      SetBehaviour(index, FALLING);
+      return;
+    }
+  } else if (behaviour == FALLING) {
+    Fixed_Pixel max_velocity_y = Fixed_Pixel_Helper::FromPixels(m_world_settings->GetMaxVelocityInPixPerFrame());
+    m_velocity_y[index] += Fixed_Pixel_Helper::FromPixels(m_world_settings->GetGravityInPixPerFrame());
+    if (m_velocity_y[index] < max_velocity_y) {
+      m_velocity_y[index] = max_velocity_y;
+    }
+    m_position_y[index] += m_velocity_y[index];
+
+    // Land on the highest floor passed through below where the block was
+    AABB block = GetAvatarBlock(index);
+    AABB swept_block = AABB::FromFixedPixels(block.left, block.right, block.bottom, last_block.bottom);
+    AABB floor;
+    if (m_tiles->FindTouchingBounds(swept_block, Tile_Bitmap::FLOOR, &floor)) {
+      Fixed_Pixel landing_y = (floor.top < last_block.bottom) ? floor.top : last_block.bottom;
+      m_position_y[index] += landing_y - block.bottom;
+      SetBehaviour(index, RUNNING);
+      return;
+    }
+  }
+
+  // Next animation frame, a frame which doesn't repeat holds on its last one
+  Behaviour_Animation const &animation = m_behaviour_animations[m_behaviour[index]];
+  unsigned int state_index = m_state_index[index] + 1;
+  if (state_index >= animation.number_of_frames) {
+    state_index = animation.is_repeatable ? 0 : m_state_index[index];
+  }
+  m_state_index[index] = state_index;
+  m_collision_blocks[index] = m_animation_library->GetCollisionBlocks(animation.handle,
+                                                                      state_index,
+                                                                      static_cast<Avatar_Component::Direction>(m_direction[index]));
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::RunWorker(unsigned int worker, unsigned int tick) {
+  std::unique_lock<std::mutex> lock(m_worker_mutex);
+  while (true) {
+    while (!m_is_stopping && m_tick == tick) {
+      m_tick_started.wait(lock);
+    }
+    if (m_is_stopping) {
+      return;
+    }
+    tick = m_tick;
+    if (worker >= m_tick_worker_count) {
+      continue;
+    }
+
+    unsigned int first = worker * m_tick_range_size;
+    unsigned int last = first + m_tick_range_size;
+    if (first > m_tick_size) {
+      first = m_tick_size;
+    }
+    if (last > m_tick_size) {
+      last = m_tick_size;
+    }
+    lock.unlock();
+    Update(first, last);
+    lock.lock();
+
+    m_busy_worker_count--;
+    if (m_busy_worker_count == 0) {
+      m_tick_finished.notify_one();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::StartWorkers(unsigned int worker_count) {
+  // Only Update starts workers and it does so between ticks, so the tick
+  // can be read without the mutex
+  while (m_workers.size() < worker_count) {
+    m_workers.push_back(std::thread(&Avatar_Crowd::RunWorker,
+                                    this,
+                                    static_cast<unsigned int>(m_workers.size()),
+                                    m_tick));
+  }
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::StopWorkers() {
+  {
+    std::lock_guard<std::mutex> lock(m_worker_mutex);
+    m_is_stopping = true;
+  }
+  m_tick_started.notify_all();
+  for (unsigned int worker = 0; worker < m_workers.size(); worker++) {
+    m_workers[worker].join();
+  }
+  m_workers.clear();
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd::SetBehaviour(unsigned int index, Behaviour behaviour) {
+  m_behaviour[index] = static_cast<unsigned char>(behaviour);
+  m_velocity_x[index] = 0;
+  m_velocity_y[index] = 0;
+  m_state_index[index] = 0;
+  m_collision_blocks[index] = m_animation_library->GetCollisionBlocks(m_behaviour_animations[behaviour].handle,
+                                                                      0,
+                                                                      static_cast<Avatar_Component::Direction>(m_direction[index]));
+}
+
+//------------------------------------------------------------------------------
+AABB Avatar_Crowd::GetAvatarBlock(unsigned int index) {
+  // The library never hands out 0 for a frame's blocks, so they are read
+  // directly rather than through Avatar_Helper::GetNamedCollisionBlock
+  Avatar_Component::Avatar_Collision_Block const &avatar_block = m_collision_blocks[index]->blocks[Avatar_Component::AVATAR_BLOCK];
+  return Avatar_Helper::CollisionBlockToAABB(avatar_block, GetFixedPosition(index));
+}
+
+}  // namespace Tunnelour
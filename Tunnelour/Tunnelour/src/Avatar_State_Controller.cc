@@ -28,14 +28,9 @@ Avatar_State_Controller::Avatar_State_Controller() {
   m_game_settings = 0;
 
   m_avatar = 0;
-  m_floor_tiles.clear();
-  m_wall_tiles.clear();
-  m_ledge_tiles.clear();
-  m_animation_metadata = 0;
-  m_current_animation_subset = 0;
+  m_tiles = 0;
+  m_animation_library = 0;
   m_adjacent_wall = 0;
-  m_current_metadata_file_path = 0;
-  m_current_metadata = 0;
   m_world_settings = 0;
   m_last_frame_time = 0;
   m_y_fallen = 0;
@@ -46,23 +41,15 @@ Avatar_State_Controller::Avatar_State_Controller() {
 
 //------------------------------------------------------------------------------
 Avatar_State_Controller::~Avatar_State_Controller() {
-  if (m_model != 0) {
-    m_model->IgnoreType(this, "Bitmap_Component");
-    m_model = 0;
-  }
+  m_model = 0;
   m_is_finished = false;
   m_has_been_initialised = false;
 
   m_game_settings = 0;
   m_avatar = 0;
-  m_floor_tiles.clear();
-  m_wall_tiles.clear();
-  m_ledge_tiles.clear();
-  m_animation_metadata = 0;
-  m_current_animation_subset = 0;
+  m_tiles = 0;
+  m_animation_library = 0;
   m_adjacent_wall = 0;
-  m_current_metadata_file_path = 0;
-  m_current_metadata = 0;
   m_world_settings = 0;
   m_last_frame_time = 0;
   m_y_fallen = 0;
@@ -75,7 +62,6 @@ Avatar_State_Controller::~Avatar_State_Controller() {
 bool Avatar_State_Controller::Init(Component_Composite *const model) {
   if (m_model == 0) {
     m_model = model;
-    m_model->ObserveType(this, "Bitmap_Component");
     m_has_been_initialised = true;
   }
 
@@ -87,11 +73,9 @@ bool Avatar_State_Controller::Run() {
   bool result = false;
   if (m_game_settings != 0 &&
       m_avatar != 0 &&
-      m_animation_metadata != 0 &&
-      m_current_animation_subset != 0 &&
+      m_tiles != 0 &&
+      m_animation_library != 0 &&
       m_adjacent_wall != 0 &&
-      m_current_metadata_file_path != 0 &&
-      m_current_metadata != 0 &&
       m_world_settings != 0 &&
       m_last_frame_time != 0 &&
       m_y_fallen != 0 &&
@@ -114,8 +98,8 @@ void Avatar_State_Controller::Run_Avatar_State() {
 
 //------------------------------------------------------------------------------
 bool Avatar_State_Controller::HasAvatarStateChanged() {
-  if (m_avatar->GetState().parent_state.compare(m_initial_state.state.parent_state) != 0 ||
-      m_avatar->GetState().state.compare(m_initial_state.state.state) != 0) {
+  if (m_avatar->GetState().parent_state != m_initial_state.state.parent_state ||
+      m_avatar->GetState().state != m_initial_state.state.state) {
     return true;
   }
 
@@ -128,18 +112,8 @@ void Avatar_State_Controller::SetAvatarComponent(Avatar_Component *avatar_compon
 }
 
 //------------------------------------------------------------------------------
-void Avatar_State_Controller::SetFloorTiles(std::vector<Tile_Bitmap*> floor_tiles) {
-  m_floor_tiles = floor_tiles;
-}
-
-//------------------------------------------------------------------------------
-void Avatar_State_Controller::SetWallTiles(std::vector<Tile_Bitmap*> wall_tiles) {
-  m_wall_tiles = wall_tiles;
-}
-
-//------------------------------------------------------------------------------
-void Avatar_State_Controller::SetLedgeTiles(std::vector<Tile_Bitmap*> ledge_tiles) {
-  m_ledge_tiles = ledge_tiles;
+void Avatar_State_Controller::SetTiles(Tile_Grid *tiles) {
+  m_tiles = tiles;
 }
 
 //------------------------------------------------------------------------------
@@ -148,13 +122,8 @@ void Avatar_State_Controller::SetGameSettings(Game_Settings_Component* game_sett
 }
 
 //------------------------------------------------------------------------------
-void Avatar_State_Controller::SetAnimationMetadata(std::vector<Tileset_Helper::Animation_Tileset_Metadata> *animation_metadata) {
-  m_animation_metadata = animation_metadata;
-}
-
-//------------------------------------------------------------------------------
-void Avatar_State_Controller::SetCurrentAnimationSubset(Tileset_Helper::Animation_Subset *current_animation_subset) {
-  m_current_animation_subset = current_animation_subset;
+void Avatar_State_Controller::SetAnimationLibrary(Animation_Library *animation_library) {
+  m_animation_library = animation_library;
 }
 
 //------------------------------------------------------------------------------
@@ -162,15 +131,6 @@ void Avatar_State_Controller::SetCurrentlyAdjacentWallTile(Avatar_Helper::Tile_C
   m_adjacent_wall = currently_adjacent_wall_tile;
 }
 
-//------------------------------------------------------------------------------
-void Avatar_State_Controller::SetCurrentMetadataFilePath(std::string *current_metadata_file_path) {
-  m_current_metadata_file_path = current_metadata_file_path;
-}
-
-//------------------------------------------------------------------------------
-void Avatar_State_Controller::SetCurrentMetadata(Tileset_Helper::Animation_Tileset_Metadata *current_metadata) {
-  m_current_metadata = current_metadata;
-}
 
 //------------------------------------------------------------------------------
 void Avatar_State_Controller::SetWorldSettings(World_Settings_Component *world_settings) {
@@ -203,79 +163,112 @@ void Avatar_State_Controller::SetCurrentlyGrabbedTile(Bitmap_Component *& curren
 }
 
 //------------------------------------------------------------------------------
-void Avatar_State_Controller::HandleEventAdd(Tunnelour::Component * const component) {
-  Tile_Bitmap *tile = 0;
-  tile = static_cast<Tile_Bitmap*>(component);
-  if (tile->IsFloor() && !m_floor_tiles.empty()) {
-    m_floor_tiles.push_back(tile);
-  }
-  if (tile->IsWall() && !m_wall_tiles.empty()) {
-    m_wall_tiles.push_back(tile);
-  }
-  if (tile->IsWall() && tile->IsFloor() && !m_ledge_tiles.empty()) {
-    m_ledge_tiles.push_back(tile);
-  }
+// protected:
+//------------------------------------------------------------------------------
+Tileset_Helper::Animation_Subset const & Avatar_State_Controller::GetCurrentAnimationSubset() {
+  Avatar_Component::Avatar_State const &current_state = m_avatar->GetState();
+  return m_animation_library->GetSubset(m_animation_library->Find(current_state.parent_state, current_state.state));
 }
 
 //------------------------------------------------------------------------------
-void Avatar_State_Controller::HandleEventRemove(Tunnelour::Component * const component) {
-  Tunnelour::Tile_Bitmap *target_bitmap = 0;
-  target_bitmap = static_cast<Tunnelour::Tile_Bitmap*>(component);
-  std::vector<Tile_Bitmap*>::iterator found_bitmap;
-  bool found = false;
-  if (target_bitmap->IsWall()) {
-    std::vector<Tile_Bitmap*>::iterator bitmap;
-    for (bitmap = m_wall_tiles.begin(); bitmap != m_wall_tiles.end(); bitmap++) {
-      if ((*bitmap)->GetID() == target_bitmap->GetID()) {
-        found_bitmap = bitmap;
-        found = true;
-      }
-    }
-    if (found) {
-      m_wall_tiles.erase(found_bitmap);
-    }
+bool Avatar_State_Controller::Run_Avatar_State_Transition(unsigned int command, bool is_frame_complete) {
+  Avatar_Component::Avatar_State current_state = m_avatar->GetState();
+  unsigned int contacts = 0;
+  if (m_transitions.IsContactSensitive(current_state.state)) {
+    contacts = Get_Avatar_Contacts();
   }
-  found = false;
-  if (target_bitmap->IsFloor()) {
-    std::vector<Tile_Bitmap*>::iterator bitmap;
-    for (bitmap = m_floor_tiles.begin(); bitmap != m_floor_tiles.end(); bitmap++) {
-      if ((*bitmap)->GetID() == target_bitmap->GetID()) {
-        found_bitmap = bitmap;
-        found = true;
-      }
-    }
-    if (found) {
-      m_floor_tiles.erase(found_bitmap);
-    }
-  }
-  found = false;
-  if (target_bitmap->IsFloor() && target_bitmap->IsWall()) {
-    std::vector<Tile_Bitmap*>::iterator bitmap;
-    for (bitmap = m_ledge_tiles.begin(); bitmap != m_ledge_tiles.end(); bitmap++) {
-      if ((*bitmap)->GetID() == target_bitmap->GetID()) {
-        found_bitmap = bitmap;
-        found = true;
-      }
-    }
-    if (found) {
-      m_ledge_tiles.erase(found_bitmap);
-    }
+
+  Avatar_State_Transitions::Transition const *transition = m_transitions.Find(current_state.state,
+                                                                              command,
+                                                                              contacts,
+                                                                              is_frame_complete);
+  if (transition == 0) {
+    return false;
   }
-}
 
+  Avatar_Component::Direction direction = current_state.direction;
+  Avatar_Component::Direction command_direction = m_avatar->GetCommand().direction;
+  if (transition->direction_source == Avatar_State_Transitions::COMMAND_DIRECTION &&
+      command_direction != Avatar_Component::NO_DIRECTION) {
+    direction = command_direction;
+  }
 
-//------------------------------------------------------------------------------
-void Avatar_State_Controller::HandleEventUpdate(Tunnelour::Component * const component) {
-  HandleEventRemove(component);
-  HandleEventAdd(component);
+  Apply_State_Hook(m_transitions.GetExitHook(current_state.state), current_state.direction);
+  Avatar_Helper::SetAvatarState(m_avatar,
+                                m_game_settings->GetTilesetPath(),
+                                m_animation_library,
+                                transition->parent_state,
+                                transition->state,
+                                direction);
+  Align_Avatar_State(transition->alignment);
+  Apply_State_Hook(m_transitions.GetEnterHook(transition->state), direction);
+  return true;
 }
 
 //------------------------------------------------------------------------------
-// protected:
+// private:
 //------------------------------------------------------------------------------
+unsigned int Avatar_State_Controller::Get_Avatar_Contacts() {
+  unsigned int contacts = 0;
+  std::vector<Tile_Bitmap*> adjacent_tiles;
+  if (Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, &adjacent_tiles, m_tiles)) {
+    contacts |= Avatar_State_Transitions::FLOOR_ADJACENT;
+  }
+  std::vector<Avatar_Helper::Tile_Collision> wall_collisions;
+  if (Avatar_Helper::IsAvatarWallColliding(m_avatar, &wall_collisions, m_tiles)) {
+    contacts |= Avatar_State_Transitions::WALL_COLLIDING;
+  }
+  return contacts;
+}
 
 //------------------------------------------------------------------------------
-// private:
+void Avatar_State_Controller::Apply_State_Hook(Avatar_State_Transitions::State_Hook const *hook, Avatar_Component::Direction direction) {
+  if (hook == 0) {
+    return;
+  }
+  D3DXVECTOR3 velocity = D3DXVECTOR3(hook->velocity.x, hook->velocity.y, 0);
+  if (direction == Avatar_Component::LEFT) {
+    velocity.x *= -1;
+  }
+  if (hook->is_keeping_y_velocity) {
+    velocity.y = m_avatar->GetVelocity().y;
+  }
+  m_avatar->SetVelocity(velocity);
+}
+
 //------------------------------------------------------------------------------
+void Avatar_State_Controller::Align_Avatar_State(Avatar_State_Transitions::Alignment alignment) {
+  bool is_facing_right = (m_avatar->GetState().direction == Avatar_Component::RIGHT);
+  switch (alignment) {
+    case Avatar_State_Transitions::ALIGN_ON_LAST_CONTACTING_FOOT:
+      Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
+      break;
+    case Avatar_State_Transitions::ALIGN_ON_LAST_HAND:
+      Avatar_Helper::AlignAvatarOnLastHand(m_avatar);
+      break;
+    case Avatar_State_Transitions::ALIGN_ON_LAST_COLLISION_BLOCK:
+      Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);
+      break;
+    case Avatar_State_Transitions::ALIGN_ON_LAST_FACING_BOTTOM:
+      if (is_facing_right) {
+        Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
+      } else {
+        Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
+      }
+      break;
+    case Avatar_State_Transitions::ALIGN_ON_LAST_BACK_BOTTOM:
+      if (is_facing_right) {
+        Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
+      } else {
+        Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
+      }
+      break;
+    case Avatar_State_Transitions::ALIGN_ON_LAST_LEADING_BOTTOM:
+      Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeadingBottom(m_avatar);
+      break;
+    default:
+      break;
+  }
+}
 
 }  // namespace Tunnelour
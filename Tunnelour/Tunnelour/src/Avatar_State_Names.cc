@@ -0,0 +1,188 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Avatar_State_Names.h"
+#include "Exceptions.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// The names of Avatar_Component::State_ID, in the same order
+//------------------------------------------------------------------------------
+static const char * const KNOWN_STATE_NAMES[] = {
+  "",
+  "Charlie_Climbing",
+  "Hanging",
+  "Climbing_1",
+  "Climbing_To_Standing",
+  "Grabbing_To_Hanging",
+  "Ascending_To_Grabbing",
+  "Descending_To_Grabbing",
+  "Climbing_2",
+  "Pop_Up",
+  "Charlie_Falling",
+  "Down_Facing_Falling",
+  "Down_Facing_Falling_To_Death",
+  "Down_Facing_Death",
+  "Down_Falling_Wall_Impact_Right",
+  "Up_Facing_Falling",
+  "Up_Facing_Falling_To_Death",
+  "Up_Facing_Death",
+  "Up_Falling_Wall_Impact_Left",
+  "Charlie_Jumping",
+  "Vertical_Jump_Takeoff",
+  "Vertical_Jump_Arc",
+  "Vertical_Jump_Landing",
+  "Gap_Jump_Takeoff",
+  "Gap_Jump_Arc_Rise",
+  "Gap_Jump_Arc_Fall",
+  "Gap_Jump_Falling",
+  "Gap_Jump_Landing",
+  "Wall_Jump_Takeoff",
+  "Wall_Jump_Rise_Arc",
+  "Wall_Jump_Fall_Arc",
+  "Wall_Jump_Landing",
+  "Wall_Jump_Rising",
+  "Wall_Jump_Falling",
+  "Charlie_Running",
+  "Running",
+  "Standing_To_Running",
+  "Wall_Colliding",
+  "Stopping",
+  "Wall_Colliding_From_Mid_Speed_Takeoff",
+  "Wall_Colliding_From_Mid_Speed_Arc",
+  "Wall_Colliding_From_Mid_Speed_Falling",
+  "Wall_Colliding_From_Mid_Speed_Landing",
+  "Wall_Colliding_From_High_Speed_Takeoff",
+  "Wall_Colliding_From_High_Speed_Arc",
+  "Wall_Colliding_From_High_Speed_Falling",
+  "Wall_Colliding_From_High_Speed_Landing",
+  "False_Start",
+  "Charlie_Standing",
+  "Standing",
+  "Initial",
+  "Looking",
+  "Idle_1",
+  "Slow_Running",
+  "Down",
+  "Jumping",
+};
+
+static_assert(sizeof(KNOWN_STATE_NAMES) / sizeof(KNOWN_STATE_NAMES[0]) == Avatar_Component::KNOWN_STATE_COUNT,
+              "KNOWN_STATE_NAMES must name every Avatar_Component::State_ID");
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Avatar_State_Names::~Avatar_State_Names() {
+}
+
+//------------------------------------------------------------------------------
+Avatar_State_Names* Avatar_State_Names::GetInstance() {
+  if (m_instance == 0) {
+    m_instance = new Avatar_State_Names();
+  }
+  return m_instance;
+}
+
+//------------------------------------------------------------------------------
+unsigned int Avatar_State_Names::GetStateID(std::string const &name) {
+  std::map<std::string, unsigned int>::iterator found = m_ids.find(name);
+  if (found != m_ids.end()) {
+    return found->second;
+  }
+
+  unsigned int state_id = static_cast<unsigned int>(m_names.size());
+  m_names.push_back(name);
+  m_ids[name] = state_id;
+  m_parent_ids.push_back(Avatar_Component::NO_STATE);
+  return state_id;
+}
+
+//------------------------------------------------------------------------------
+std::string const & Avatar_State_Names::GetStateName(unsigned int state_id) {
+  if (state_id >= m_names.size()) {
+    return m_names[Avatar_Component::NO_STATE];
+  }
+  return m_names[state_id];
+}
+
+//------------------------------------------------------------------------------
+unsigned int Avatar_State_Names::GetParentStateID(unsigned int state_id) {
+  if (state_id == Avatar_Component::NO_STATE || state_id >= m_names.size()) {
+    return Avatar_Component::NO_STATE;
+  }
+  if (m_parent_ids[state_id] == Avatar_Component::NO_STATE) {
+    unsigned int parent_state_id = GetStateID("Charlie_" + m_names[state_id]);
+    m_parent_ids[state_id] = parent_state_id;
+  }
+  return m_parent_ids[state_id];
+}
+
+//------------------------------------------------------------------------------
+Avatar_Component::Direction Avatar_State_Names::GetDirection(std::string const &name) {
+  if (name.compare("Right") == 0) {
+    return Avatar_Component::RIGHT;
+  } else if (name.compare("Left") == 0) {
+    return Avatar_Component::LEFT;
+  } else if (name.empty()) {
+    return Avatar_Component::NO_DIRECTION;
+  }
+  throw Exceptions::init_error("Unknown avatar direction: " + name);
+}
+
+//------------------------------------------------------------------------------
+std::string Avatar_State_Names::GetDirectionName(Avatar_Component::Direction direction) {
+  if (direction == Avatar_Component::RIGHT) {
+    return "Right";
+  } else if (direction == Avatar_Component::LEFT) {
+    return "Left";
+  }
+  return "";
+}
+
+//------------------------------------------------------------------------------
+Avatar_Component::Collision_Block_ID Avatar_State_Names::GetCollisionBlockID(std::string const &name) {
+  if (name.compare("Avatar") == 0) {
+    return Avatar_Component::AVATAR_BLOCK;
+  } else if (name.compare("Right_Foot") == 0) {
+    return Avatar_Component::RIGHT_FOOT_BLOCK;
+  } else if (name.compare("Left_Foot") == 0) {
+    return Avatar_Component::LEFT_FOOT_BLOCK;
+  } else if (name.compare("Hand") == 0) {
+    return Avatar_Component::HAND_BLOCK;
+  } else if (name.compare("Arm") == 0) {
+    return Avatar_Component::ARM_BLOCK;
+  }
+  throw Exceptions::init_error("Unknown avatar collision block: " + name);
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+Avatar_State_Names::Avatar_State_Names() {
+  for (unsigned int state_id = 0; state_id < Avatar_Component::KNOWN_STATE_COUNT; state_id++) {
+    m_names.push_back(KNOWN_STATE_NAMES[state_id]);
+    m_ids[KNOWN_STATE_NAMES[state_id]] = state_id;
+    m_parent_ids.push_back(Avatar_Component::NO_STATE);
+  }
+}
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+Avatar_State_Names* Avatar_State_Names::m_instance = 0;
+
+}  // namespace Tunnelour
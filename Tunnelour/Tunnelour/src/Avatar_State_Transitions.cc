@@ -0,0 +1,175 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Avatar_State_Transitions.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Avatar_State_Transitions::Avatar_State_Transitions() {
+  m_state_count = 0;
+  m_command_count = 0;
+}
+
+//------------------------------------------------------------------------------
+Avatar_State_Transitions::~Avatar_State_Transitions() {
+}
+
+//------------------------------------------------------------------------------
+void Avatar_State_Transitions::Add(unsigned int state, unsigned int command, int contacts, Frame_Condition frame, Transition const &transition) {
+  Rule rule;
+  rule.state = state;
+  rule.command = command;
+  rule.contacts = contacts;
+  rule.frame = frame;
+  rule.transition = static_cast<unsigned int>(m_transitions.size());
+  m_transitions.push_back(transition);
+  m_rules.push_back(rule);
+}
+
+//------------------------------------------------------------------------------
+void Avatar_State_Transitions::AddFrameComplete(unsigned int state, unsigned int new_parent_state, unsigned int new_state, Alignment alignment) {
+  Transition transition;
+  transition.parent_state = new_parent_state;
+  transition.state = new_state;
+  transition.direction_source = KEEP_DIRECTION;
+  transition.alignment = alignment;
+  Add(state, ANY_COMMAND, ANY_CONTACTS, FRAME_COMPLETE, transition);
+}
+
+//------------------------------------------------------------------------------
+void Avatar_State_Transitions::SetEnterHook(unsigned int state, State_Hook const &hook) {
+  if (state >= m_enter_hooks.size()) {
+    m_enter_hooks.resize(state + 1);
+  }
+  m_enter_hooks[state] = hook;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_State_Transitions::SetExitHook(unsigned int state, State_Hook const &hook) {
+  if (state >= m_exit_hooks.size()) {
+    m_exit_hooks.resize(state + 1);
+  }
+  m_exit_hooks[state] = hook;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_State_Transitions::Compile() {
+  // Size the table to cover every state and command a rule names
+  m_state_count = 0;
+  std::vector<Rule>::iterator rule;
+  for (rule = m_rules.begin(); rule != m_rules.end(); rule++) {
+    if (rule->state != ANY_STATE && rule->state + 1 > m_state_count) {
+      m_state_count = rule->state + 1;
+    }
+    if (rule->command != ANY_COMMAND && rule->command + 1 > m_state_count) {
+      m_state_count = rule->command + 1;
+    }
+  }
+
+  m_command_columns.assign(m_state_count, 0);
+  m_command_count = 1;
+  for (rule = m_rules.begin(); rule != m_rules.end(); rule++) {
+    if (rule->command != ANY_COMMAND && m_command_columns[rule->command] == 0) {
+      m_command_columns[rule->command] = m_command_count;
+      m_command_count++;
+    }
+  }
+
+  m_table.assign(m_state_count * m_command_count * CONTACT_COMBINATIONS * 2, -1);
+  m_is_contact_sensitive.assign(m_state_count, false);
+  for (rule = m_rules.begin(); rule != m_rules.end(); rule++) {
+    for (unsigned int state = 0; state < m_state_count; state++) {
+      if (rule->state != ANY_STATE && rule->state != state) {
+        continue;
+      }
+      if (rule->contacts != ANY_CONTACTS) {
+        m_is_contact_sensitive[state] = true;
+      }
+      for (unsigned int column = 0; column < m_command_count; column++) {
+        if (rule->command != ANY_COMMAND && m_command_columns[rule->command] != column) {
+          continue;
+        }
+        for (unsigned int contacts = 0; contacts < CONTACT_COMBINATIONS; contacts++) {
+          if (rule->contacts != ANY_CONTACTS && static_cast<unsigned int>(rule->contacts) != contacts) {
+            continue;
+          }
+          for (unsigned int frame = FRAME_INCOMPLETE; frame <= FRAME_COMPLETE; frame++) {
+            if (rule->frame != ANY_FRAME && static_cast<unsigned int>(rule->frame) != frame) {
+              continue;
+            }
+            m_table[GetTableIndex(state, column, contacts, frame)] = static_cast<int>(rule->transition);
+          }
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+bool Avatar_State_Transitions::IsContactSensitive(unsigned int state) {
+  if (state >= m_state_count) {
+    return false;
+  }
+  return m_is_contact_sensitive[state];
+}
+
+//------------------------------------------------------------------------------
+Avatar_State_Transitions::Transition const * Avatar_State_Transitions::Find(unsigned int state, unsigned int command, unsigned int contacts, bool is_frame_complete) {
+  if (state >= m_state_count) {
+    return 0;
+  }
+  unsigned int column = 0;
+  if (command < m_state_count) {
+    column = m_command_columns[command];
+  }
+  unsigned int frame = is_frame_complete ? FRAME_COMPLETE : FRAME_INCOMPLETE;
+  int transition = m_table[GetTableIndex(state, column, contacts % CONTACT_COMBINATIONS, frame)];
+  if (transition < 0) {
+    return 0;
+  }
+  return &m_transitions[transition];
+}
+
+//------------------------------------------------------------------------------
+Avatar_State_Transitions::State_Hook const * Avatar_State_Transitions::GetEnterHook(unsigned int state) {
+  if (state >= m_enter_hooks.size() || !m_enter_hooks[state].is_setting_velocity) {
+    return 0;
+  }
+  return &m_enter_hooks[state];
+}
+
+//------------------------------------------------------------------------------
+Avatar_State_Transitions::State_Hook const * Avatar_State_Transitions::GetExitHook(unsigned int state) {
+  if (state >= m_exit_hooks.size() || !m_exit_hooks[state].is_setting_velocity) {
+    return 0;
+  }
+  return &m_exit_hooks[state];
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+unsigned int Avatar_State_Transitions::GetTableIndex(unsigned int state, unsigned int command_column, unsigned int contacts, unsigned int frame) {
+  return (((state * m_command_count + command_column) * CONTACT_COMBINATIONS + contacts) * 2) + frame;
+}
+
+}  // namespace Tunnelour
@@ -0,0 +1,59 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+#include "Avatar_State_Watch.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Avatar_State_Watch::Avatar_State_Watch() {
+  Reset();
+}
+
+//------------------------------------------------------------------------------
+Avatar_State_Watch::~Avatar_State_Watch() {
+  m_avatar = 0;
+}
+
+//------------------------------------------------------------------------------
+bool Avatar_State_Watch::HasChanged(Avatar_Component *avatar) {
+  if (avatar == m_avatar &&
+      avatar->GetStateVersion() == m_state_version &&
+      avatar->GetLastRenderedStateVersion() == m_last_rendered_state_version) {
+    return false;
+  }
+  m_avatar = avatar;
+  m_state_version = avatar->GetStateVersion();
+  m_last_rendered_state_version = avatar->GetLastRenderedStateVersion();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void Avatar_State_Watch::Reset() {
+  m_avatar = 0;
+  m_state_version = 0;
+  m_last_rendered_state_version = 0;
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+
+}  // namespace Tunnelour
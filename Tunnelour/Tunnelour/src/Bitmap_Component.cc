@@ -32,6 +32,7 @@ Bitmap_Component::Bitmap_Component(): Frame_Component() {
   m_type = "Bitmap_Component";
   m_velocity = D3DXVECTOR3(0.0, 0.0 , 0.0);
   m_angle = 0;
+  m_is_screen_space = false;
 }
 
 //------------------------------------------------------------------------------
@@ -46,6 +47,7 @@ Bitmap_Component::~Bitmap_Component()  {
     m_texture->texture_size = D3DXVECTOR2(0, 0);
     m_velocity = D3DXVECTOR3(0, 0 ,0);
     m_angle = 0;
+    m_is_screen_space = false;
 
     delete m_texture;
     m_texture = 0;
@@ -73,9 +75,21 @@ D3DXVECTOR3 Bitmap_Component::GetVelocity() {
   return m_velocity;
 }
 
+//---------------------------------------------------------------------------
+Fixed_Point Bitmap_Component::GetFixedVelocity() {
+  return m_fixed_velocity;
+}
+
+//---------------------------------------------------------------------------
+void Bitmap_Component::SetFixedVelocity(Fixed_Point velocity) {
+  m_fixed_velocity = velocity;
+  m_velocity = Fixed_Pixel_Helper::ToPixels(m_fixed_velocity, 0);
+}
+
 //---------------------------------------------------------------------------
 void Bitmap_Component::SetVelocity(D3DXVECTOR3 velocity) {
-  m_velocity = velocity;
+  m_fixed_velocity = Fixed_Pixel_Helper::FromPixels(velocity);
+  m_velocity = Fixed_Pixel_Helper::ToPixels(m_fixed_velocity, Fixed_Pixel_Helper::Snap(velocity.z));
 }
 
 //---------------------------------------------------------------------------
@@ -98,6 +112,34 @@ void Bitmap_Component::SetTransparency(float transparency) {
   m_texture->transparency = transparency;
 }
 
+//---------------------------------------------------------------------------
+D3DXVECTOR4 Bitmap_Component::GetUVRect() {
+  // Bitmaps that never set a texture size, like Debug_Bitmap, show the
+  // whole texture.
+  if (m_texture->texture_size.x == 0 || m_texture->texture_size.y == 0) {
+    return D3DXVECTOR4(0.0f, 0.0f, 1.0f, 1.0f);
+  }
+  return D3DXVECTOR4(m_texture->top_left_position.x / m_texture->texture_size.x,
+                     m_texture->top_left_position.y / m_texture->texture_size.y,
+                     m_texture->tile_size.x / m_texture->texture_size.x,
+                     m_texture->tile_size.y / m_texture->texture_size.y);
+}
+
+//---------------------------------------------------------------------------
+bool Bitmap_Component::IsOpaque() {
+  return false;
+}
+
+//---------------------------------------------------------------------------
+bool Bitmap_Component::IsScreenSpace() {
+  return m_is_screen_space;
+}
+
+//---------------------------------------------------------------------------
+void Bitmap_Component::SetScreenSpace(bool is_screen_space) {
+  m_is_screen_space = is_screen_space;
+}
+
 //------------------------------------------------------------------------------
 // protected:
 //------------------------------------------------------------------------------
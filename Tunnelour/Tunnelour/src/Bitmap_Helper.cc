@@ -28,232 +28,99 @@ Bitmap_Helper::Bitmap_Helper() {
 Bitmap_Helper::~Bitmap_Helper() {
 }
 
+//------------------------------------------------------------------------------
+AABB Bitmap_Helper::GetAABB(Tunnelour::Bitmap_Component* Tile) {
+  return AABB::FromCentre(Tile->GetFixedPosition(), Tile->GetSize());
+}
+
 //------------------------------------------------------------------------------
 bool Bitmap_Helper::DoTheseTilesIntersect(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB) {
-  bool is_y_colliding = DoTheseTilesYCollide(TileA, TileB);
-  bool is_x_colliding = DoTheseTilesXCollide(TileA, TileB);
+  return DoTheseTilesIntersect(GetAABB(TileA), GetAABB(TileB));
+}
 
-  return is_y_colliding && is_x_colliding;
+//------------------------------------------------------------------------------
+bool Bitmap_Helper::DoTheseTilesIntersect(AABB const &TileA, AABB const &TileB) {
+  return TileA.IsIntersecting(TileB);
 }
 
 //------------------------------------------------------------------------------
 std::string Bitmap_Helper::DoesTileACollideOnTheTopOrBottom(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB) {
-  // At least one y vertex in TileA is contained in the TileB.
-  std::string collision_side = "";
-
-  float a_tile_top, a_tile_bottom;
-  a_tile_top = TileA->GetPosition()->y + static_cast<float>(TileA->GetSize().y / 2);
-  a_tile_bottom = TileA->GetPosition()->y - static_cast<float>(TileA->GetSize().y / 2);
-
-  float b_tile_top, b_tile_bottom;
-  b_tile_top = TileB->GetPosition()->y + static_cast<float>(TileB->GetSize().y / 2);
-  b_tile_bottom = TileB->GetPosition()->y - static_cast<float>(TileB->GetSize().y / 2);
-
-  if (b_tile_top < a_tile_top && b_tile_top > a_tile_bottom) {
-    collision_side = "Bottom";
-  }
-
-  if (b_tile_bottom < a_tile_top && b_tile_bottom > a_tile_bottom) {
-    collision_side = "Top";
-  }
-
-  if (a_tile_top < b_tile_top && a_tile_top > b_tile_bottom) {
-    collision_side = "Top";
-  }
-
-  if (a_tile_bottom < b_tile_top && a_tile_bottom > b_tile_bottom) {
-    collision_side = "Bottom";
-  }
-
-  if (a_tile_top == b_tile_top  && a_tile_bottom == b_tile_bottom) {
-    collision_side = "Adjacent";
-  }
+  return DoesTileACollideOnTheTopOrBottom(GetAABB(TileA), GetAABB(TileB));
+}
 
-  return collision_side;
+//------------------------------------------------------------------------------
+std::string Bitmap_Helper::DoesTileACollideOnTheTopOrBottom(AABB const &TileA, AABB const &TileB) {
+  return TileA.GetTopOrBottomCollisionSide(TileB);
 }
 
 //------------------------------------------------------------------------------
 std::string Bitmap_Helper::DoesTileACollideOnTheRightOrLeft(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB) {
-  // At least one vertex in TileA is contained in the TileB.
-  std::string collision_side = "";
-
-  float a_tile_left, a_tile_right;
-  a_tile_left = TileA->GetPosition()->x - static_cast<float>(TileA->GetSize().x / 2);
-  a_tile_right = TileA->GetPosition()->x + static_cast<float>(TileA->GetSize().x / 2);
-
-  float b_tile_left, b_tile_right;
-  b_tile_left = TileB->GetPosition()->x - static_cast<float>(TileB->GetSize().x / 2);
-  b_tile_right = TileB->GetPosition()->x + static_cast<float>(TileB->GetSize().x / 2);
-
-  if (b_tile_left > a_tile_left && b_tile_left < a_tile_right) {
-    collision_side = "Right";
-  }
-
-  if (b_tile_right < a_tile_right && b_tile_right > a_tile_left) {
-    collision_side = "Left";
-  }
-
-  if (a_tile_left > b_tile_left && a_tile_left < b_tile_right) {
-    collision_side = "Left";
-  }
-
-  if (a_tile_right < b_tile_right && a_tile_right > b_tile_left) {
-    collision_side = "Right";
-  }
-
-  if (b_tile_left == a_tile_left && b_tile_right == a_tile_right) {
-    collision_side = "Adjacent";
-  }
+  return DoesTileACollideOnTheRightOrLeft(GetAABB(TileA), GetAABB(TileB));
+}
 
-  return collision_side;
+//------------------------------------------------------------------------------
+std::string Bitmap_Helper::DoesTileACollideOnTheRightOrLeft(AABB const &TileA, AABB const &TileB) {
+  return TileA.GetRightOrLeftCollisionSide(TileB);
 }
 
 //------------------------------------------------------------------------------
 bool Bitmap_Helper::DoTheseTilesYCollide(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB) {
-  // At least one y vertex in TileA is contained in the TileB.
-
-  float a_tile_top, a_tile_bottom;
-  a_tile_top = TileA->GetPosition()->y + static_cast<float>(TileA->GetSize().y / 2);
-  a_tile_bottom = TileA->GetPosition()->y - static_cast<float>(TileA->GetSize().y / 2);
-
-  float b_tile_top, b_tile_bottom;
-  b_tile_top = TileB->GetPosition()->y + static_cast<float>(TileB->GetSize().y / 2);
-  b_tile_bottom = TileB->GetPosition()->y - static_cast<float>(TileB->GetSize().y / 2);
-
-  if (b_tile_top < a_tile_top && b_tile_top > a_tile_bottom) {
-    return true;
-  }
-
-  if (b_tile_bottom < a_tile_top && b_tile_bottom > a_tile_bottom) {
-    return true;
-  }
-
-  if (a_tile_top < b_tile_top && a_tile_top > b_tile_bottom) {
-    return true;
-  }
-
-  if (a_tile_bottom < b_tile_top && a_tile_bottom > b_tile_bottom) {
-    return true;
-  }
-
-  if (a_tile_top == b_tile_top  || a_tile_bottom == b_tile_bottom) {
-    return true;
-  }
-
-
+  return DoTheseTilesYCollide(GetAABB(TileA), GetAABB(TileB));
+}
 
-  return false;
+//------------------------------------------------------------------------------
+bool Bitmap_Helper::DoTheseTilesYCollide(AABB const &TileA, AABB const &TileB) {
+  return TileA.IsYColliding(TileB);
 }
 
 //------------------------------------------------------------------------------
 bool Bitmap_Helper::AreTheseTilesYAdjacent(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB) {
-  // At least one vertex in TileA is contained in the TileB.
-
-  float a_tile_top, a_tile_bottom;
-  a_tile_top = TileA->GetTopLeftPostion().y;
-  a_tile_bottom = TileA->GetBottomRightPostion().y;
-
-  float b_tile_top, b_tile_bottom;
-  b_tile_top = TileB->GetTopLeftPostion().y;
-  b_tile_bottom = TileB->GetBottomRightPostion().y;
-
-  if (b_tile_top == a_tile_top  || b_tile_top == a_tile_bottom) {
-    return true;
-  }
-   
-  if (b_tile_bottom == a_tile_top  || b_tile_bottom == a_tile_bottom) {
-    return true;
-  }
+  return AreTheseTilesYAdjacent(GetAABB(TileA), GetAABB(TileB));
+}
 
-  return false;
+//------------------------------------------------------------------------------
+bool Bitmap_Helper::AreTheseTilesYAdjacent(AABB const &TileA, AABB const &TileB) {
+  return TileA.IsYAdjacent(TileB);
 }
 
 //------------------------------------------------------------------------------
 bool Bitmap_Helper::DoTheseTilesXCollide(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB) {
-  // At least one vertex in TileA is contained in the TileB.
-
-  float a_tile_left, a_tile_right;
-  a_tile_left = TileA->GetPosition()->x - static_cast<float>(TileA->GetSize().x / 2);
-  a_tile_right = TileA->GetPosition()->x + static_cast<float>(TileA->GetSize().x / 2);
-
-  float b_tile_left, b_tile_right;
-  b_tile_left = TileB->GetPosition()->x - static_cast<float>(TileB->GetSize().x / 2);
-  b_tile_right = TileB->GetPosition()->x + static_cast<float>(TileB->GetSize().x / 2);
-
-  if (b_tile_left > a_tile_left && b_tile_left < a_tile_right) {
-    return true;
-  }
-
-  if (b_tile_right < a_tile_right && b_tile_right > a_tile_left) {
-    return true;
-  }
-
-  if (a_tile_left > b_tile_left && a_tile_left < b_tile_right) {
-    return true;
-  }
-
-  if (a_tile_right < b_tile_right && a_tile_right > b_tile_left) {
-    return true;
-  }
-
-  if (b_tile_left == a_tile_left || b_tile_right == a_tile_right) {
-    return true;
-  }
+  return DoTheseTilesXCollide(GetAABB(TileA), GetAABB(TileB));
+}
 
-  return false;
+//------------------------------------------------------------------------------
+bool Bitmap_Helper::DoTheseTilesXCollide(AABB const &TileA, AABB const &TileB) {
+  return TileA.IsXColliding(TileB);
 }
 
 //------------------------------------------------------------------------------
 bool Bitmap_Helper::AreTheseTilesXAdjacent(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB) {
-  // At least one vertex in TileA is contained in the TileB.
-
-  float a_tile_left, a_tile_right;
-  a_tile_left = TileA->GetPosition()->x - static_cast<float>(TileA->GetSize().x / 2);
-  a_tile_right = TileA->GetPosition()->x + static_cast<float>(TileA->GetSize().x / 2);
-
-  float b_tile_left, b_tile_right;
-  b_tile_left = TileB->GetPosition()->x - static_cast<float>(TileB->GetSize().x / 2);
-  b_tile_right = TileB->GetPosition()->x + static_cast<float>(TileB->GetSize().x / 2);
-
-  if (b_tile_left == a_tile_left  || b_tile_left == a_tile_right) {
-    return true;
-  }
-    
-  if (b_tile_right == a_tile_left  || b_tile_right == a_tile_right) {
-    return true;
-  }
+  return AreTheseTilesXAdjacent(GetAABB(TileA), GetAABB(TileB));
+}
 
-  return false;
+//------------------------------------------------------------------------------
+bool Bitmap_Helper::AreTheseTilesXAdjacent(AABB const &TileA, AABB const &TileB) {
+  return TileA.IsXAdjacent(TileB);
 }
 
 //------------------------------------------------------------------------------
 bool Bitmap_Helper::AreTheseTilesLeftXAdjacent(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB) {
-  float a_tile_left;
-  a_tile_left = TileA->GetPosition()->x - static_cast<float>(TileA->GetSize().x / 2);
-
-  float b_tile_left;
-  b_tile_left = TileB->GetPosition()->x - static_cast<float>(TileB->GetSize().x / 2);
-
-  if (b_tile_left == a_tile_left) {
-    return true;
-  }
+  return AreTheseTilesLeftXAdjacent(GetAABB(TileA), GetAABB(TileB));
+}
 
-  return false;
+//------------------------------------------------------------------------------
+bool Bitmap_Helper::AreTheseTilesLeftXAdjacent(AABB const &TileA, AABB const &TileB) {
+  return TileA.IsLeftXAdjacent(TileB);
 }
 
 //------------------------------------------------------------------------------
 bool Bitmap_Helper::AreTheseTilesRightXAdjacent(Tunnelour::Bitmap_Component* TileA, Tunnelour::Bitmap_Component* TileB) {
-  float a_tile_right;
-  a_tile_right = TileA->GetPosition()->x + static_cast<float>(TileA->GetSize().x / 2);
-
-  float b_tile_right;
-  b_tile_right = TileB->GetPosition()->x + static_cast<float>(TileB->GetSize().x / 2);
-
-  if (b_tile_right == a_tile_right) {
-    return true;
-  }
+  return AreTheseTilesRightXAdjacent(GetAABB(TileA), GetAABB(TileB));
+}
 
-  return false;
+//------------------------------------------------------------------------------
+bool Bitmap_Helper::AreTheseTilesRightXAdjacent(AABB const &TileA, AABB const &TileB) {
+  return TileA.IsRightXAdjacent(TileB);
 }
 
 //------------------------------------------------------------------------------
@@ -293,15 +160,15 @@ Tile_Bitmap* Bitmap_Helper::CollisionBlockToBitmapComponent(Avatar_Component::Av
   
   float random_line_tile = 0;
   /*
-  if (avatar_collision_block.id.compare("Left_Foot") == 0) {
+  if (avatar_collision_block.id == Avatar_Component::LEFT_FOOT_BLOCK) {
     random_line_tile = 2;
     collision_bitmap_position.z = -2.0;
   }
-  if (avatar_collision_block.id.compare("Right_Foot") == 0) {
+  if (avatar_collision_block.id == Avatar_Component::RIGHT_FOOT_BLOCK) {
     random_line_tile = 3;
     collision_bitmap_position.z = -2.0;
   }
-  if (avatar_collision_block.id.compare("Avatar") == 0) {
+  if (avatar_collision_block.id == Avatar_Component::AVATAR_BLOCK) {
     if (avatar_collision_block.is_contacting) {
       random_line_tile = 1;
     } else {
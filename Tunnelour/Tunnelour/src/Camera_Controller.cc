@@ -40,14 +40,12 @@ Camera_Controller::Camera_Controller() : Controller() {
   m_max_x_look_distance = 600;
   m_max_y_look_distance = 300;
   m_input = 0;
+  m_tile_class_index = 0;
 }
 
 //------------------------------------------------------------------------------
 Camera_Controller::~Camera_Controller() {
-  if (m_model != 0) {
-    m_model->IgnoreType(this, "Bitmap_Component");
-    m_model = 0;
-  }
+  m_model = 0;
   if (m_avatar != 0) {
     m_avatar->Ignore(this);
     m_avatar = 0;
@@ -55,7 +53,7 @@ Camera_Controller::~Camera_Controller() {
   m_game_settings = 0;
   m_camera = 0;
   m_is_shaking = false;
-  m_floor_tiles.clear();
+  m_tile_class_index = 0;
   m_adjacent_floor_tile = 0;
   m_distance_travelled = 0;
   m_leash_length = 0;
@@ -78,12 +76,11 @@ bool Camera_Controller::Init(Component_Composite * const model) {
   Camera_Controller_Mutator mutator;
   m_model->Apply(&mutator);
   if (mutator.WasSuccessful()) {
-    m_model->ObserveType(this, "Bitmap_Component");
     m_avatar = mutator.GetAvatarComponent();
     m_avatar->Observe(this);
     m_game_settings = mutator.GetGameSettings();
     m_has_been_initialised = true;
-    m_floor_tiles = mutator.GetFloorTiles();
+    m_tile_class_index = mutator.GetTileClassIndex();
     m_input = mutator.GetInputComponent();
     result = true;
   } else {
@@ -103,7 +100,7 @@ bool Camera_Controller::Run() {
     Avatar_Component::Avatar_State last_state = m_avatar->GetLastRenderedState();
     if (m_game_settings->IsCameraFollowing()) {
       std::vector<Tile_Bitmap*> *adjacent_tiles = new std::vector<Tile_Bitmap*>();
-      if (Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tiles, &m_floor_tiles)) {
+      if (Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tiles, m_tile_class_index->GetTiles())) {
         m_adjacent_floor_tile = (*adjacent_tiles->begin());
       } else {
         if (m_adjacent_floor_tile != 0) {
@@ -117,10 +114,10 @@ bool Camera_Controller::Run() {
       D3DXVECTOR3 avatar_position = *m_avatar->GetPosition();
       D3DXVECTOR3 camera_position = m_camera->GetPosition();
 
-      Avatar_Component::Avatar_Collision_Block avatar_collision_block = Avatar_Helper::GetNamedCollisionBlock("Avatar", m_avatar->GetState().avatar_collision_blocks);
+      Avatar_Component::Avatar_Collision_Block avatar_collision_block = Avatar_Helper::GetNamedCollisionBlock(Avatar_Component::AVATAR_BLOCK, m_avatar->GetState().avatar_collision_blocks);
 
-      if (current_state.state.compare("Looking") == 0) {
-        if (last_state.state.compare("Looking") != 0) {
+      if (current_state.state == Avatar_Component::LOOKING) {
+        if (last_state.state != Avatar_Component::LOOKING) {
           camera_position.x = avatar_position.x;
           camera_position.y = m_adjacent_floor_tile->GetTopLeftPostion().y + 128 + 1;
         }
@@ -148,7 +145,7 @@ bool Camera_Controller::Run() {
           camera_position.y = m_camera->GetLastPosition().y + CalculateSmoothSnapYOffset(camera_position.y);
         }
       } else {
-        if (current_state.state.compare("Initial") == 0 || last_state.state.compare("Initial") == 0) {
+        if (current_state.state == Avatar_Component::INITIAL || last_state.state == Avatar_Component::INITIAL) {
           m_radius = 0;
           camera_position.x = avatar_position.x;
           // This plus 1 (+1) is to fix a bug where black bars sometimes appear on the top
@@ -159,9 +156,9 @@ bool Camera_Controller::Run() {
           m_stationary_avatar_position.y = m_avatar->GetPosition()->y;
         } else {
           float distance = HowFarHasAvatarTravelled();
-          if (current_state.parent_state.compare("Charlie_Standing") == 0 && last_state.parent_state.compare("Charlie_Standing") == 0 ||
-              current_state.state.compare("Wall_Colliding_From_Mid_Speed_Takeoff") == 0 ||
-              current_state.direction.compare(last_state.direction) != 0) {
+          if (current_state.parent_state == Avatar_Component::CHARLIE_STANDING && last_state.parent_state == Avatar_Component::CHARLIE_STANDING ||
+              current_state.state == Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF ||
+              current_state.direction != last_state.direction) {
             if (distance > m_leash_length) {
               camera_position.x = avatar_position.x;
               m_stationary_avatar_position.x = m_avatar->GetPosition()->x;
@@ -171,7 +168,7 @@ bool Camera_Controller::Run() {
             }
           } else {
             if (distance > m_leash_length) {
-              if (current_state.direction.compare("Right") == 0) {
+              if (current_state.direction == Avatar_Component::RIGHT) {
                 camera_position.x = avatar_position.x + m_leash_length;
               } else {
                 camera_position.x = avatar_position.x - m_leash_length;
@@ -192,8 +189,8 @@ bool Camera_Controller::Run() {
             camera_position.y = m_avatar->GetBottomRightPostion().y + 128 + 1;
           }
 
-          if ((m_avatar->GetState().state.compare("Up_Facing_Falling_To_Death") == 0 && m_avatar->GetState().state_index == 0) ||
-              (m_avatar->GetState().state.compare("Down_Facing_Falling_To_Death") == 0 && m_avatar->GetState().state_index == 0)) {
+          if ((m_avatar->GetState().state == Avatar_Component::UP_FACING_FALLING_TO_DEATH && m_avatar->GetState().state_index == 0) ||
+              (m_avatar->GetState().state == Avatar_Component::DOWN_FACING_FALLING_TO_DEATH && m_avatar->GetState().state_index == 0)) {
             m_radius = 30.0;
             m_randomAngle = static_cast<float>(rand()%360);
             m_is_shaking = true;
@@ -232,35 +229,6 @@ void Camera_Controller::HandleEvent(Tunnelour::Component * const component) {
   }
 }
 
-//------------------------------------------------------------------------------
-void Camera_Controller::HandleEventAdd(Tunnelour::Component * const component) {
-  Tile_Bitmap *tile = 0;
-  tile = static_cast<Tile_Bitmap*>(component);
-  if (tile->IsFloor()) {
-    m_floor_tiles.push_back(tile);
-  }
-}
-
-//------------------------------------------------------------------------------
-void Camera_Controller::HandleEventRemove(Tunnelour::Component * const component) {
-  Tunnelour::Tile_Bitmap *target_bitmap = 0;
-  target_bitmap = static_cast<Tunnelour::Tile_Bitmap*>(component);
-  std::vector<Tile_Bitmap*>::iterator found_bitmap;
-  if (target_bitmap->IsFloor()) {
-    std::vector<Tile_Bitmap*>::iterator bitmap;
-    for (bitmap = m_floor_tiles.begin(); bitmap != m_floor_tiles.end(); bitmap++) {
-      if ((*bitmap)->GetID() == target_bitmap->GetID()) {
-        found_bitmap = bitmap;
-      }
-    }
-    m_floor_tiles.erase(found_bitmap);
-  }
-}
-
-//------------------------------------------------------------------------------
-void Camera_Controller::HandleEventUpdate(Tunnelour::Component * const component) {
-}
-
 //------------------------------------------------------------------------------
 float Camera_Controller::HowFarHasAvatarTravelled() {
   D3DXVECTOR2 point_1;
@@ -27,6 +27,8 @@ Camera_Controller_Mutator::Camera_Controller_Mutator() {
   m_avatar = 0;
   m_found_input_component = false;
   m_input = 0;
+  m_found_tile_class_index = false;
+  m_tile_class_index = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -37,7 +39,8 @@ Camera_Controller_Mutator::~Camera_Controller_Mutator() {
   m_avatar = 0;
   m_found_input_component = false;
   m_input = 0;
-  m_floor_tiles.clear();
+  m_found_tile_class_index = false;
+  m_tile_class_index = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -48,12 +51,9 @@ void Camera_Controller_Mutator::Mutate(Tunnelour::Component * const component) {
   } else if (component->GetType().compare("Avatar_Component") == 0) {
     m_avatar = static_cast<Avatar_Component*>(component);
     m_found_avatar_component = true;
-  } else if (component->GetType().compare("Bitmap_Component") == 0) {
-    Tile_Bitmap *tile = 0;
-    tile = static_cast<Tile_Bitmap*>(component);
-    if (tile->IsFloor()) {
-      m_floor_tiles.push_back(tile);
-    }
+  } else if (component->GetType().compare("Tile_Class_Index_Component") == 0) {
+    m_tile_class_index = static_cast<Tile_Class_Index_Component*>(component);
+    m_found_tile_class_index = true;
   } else if (component->GetType().compare("Input_Component") == 0) {
     m_input = static_cast<Input_Component*>(component);
     m_found_input_component = true;
@@ -76,15 +76,16 @@ Input_Component* const Camera_Controller_Mutator::GetInputComponent() {
 }
 
 //------------------------------------------------------------------------------
-std::vector<Tile_Bitmap*> Camera_Controller_Mutator::GetFloorTiles() {
-  return m_floor_tiles;
+Tile_Class_Index_Component* const Camera_Controller_Mutator::GetTileClassIndex() {
+  return m_tile_class_index;
 }
 
 //------------------------------------------------------------------------------
 bool Camera_Controller_Mutator::WasSuccessful() {
   return (m_found_game_settings &&
           m_found_avatar_component &&
-          m_found_input_component);
+          m_found_input_component &&
+          m_found_tile_class_index);
 }
 
 }  // namespace Tunnelour
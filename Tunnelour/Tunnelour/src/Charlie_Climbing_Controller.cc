@@ -37,6 +37,31 @@ Charlie_Climbing_Controller::~Charlie_Climbing_Controller() {
 //------------------------------------------------------------------------------
 bool Charlie_Climbing_Controller::Init(Component_Composite *const model) {
   Avatar_State_Controller::Init(model);
+
+  // Grabbing a ledge and climbing up it, holding on by the hand throughout
+  Avatar_State_Transitions::Alignment hand = Avatar_State_Transitions::ALIGN_ON_LAST_HAND;
+  m_transitions.AddFrameComplete(Avatar_Component::ASCENDING_TO_GRABBING,
+                                 Avatar_Component::CHARLIE_CLIMBING,
+                                 Avatar_Component::GRABBING_TO_HANGING,
+                                 hand);
+  m_transitions.AddFrameComplete(Avatar_Component::DESCENDING_TO_GRABBING,
+                                 Avatar_Component::CHARLIE_CLIMBING,
+                                 Avatar_Component::GRABBING_TO_HANGING,
+                                 hand);
+  m_transitions.AddFrameComplete(Avatar_Component::GRABBING_TO_HANGING,
+                                 Avatar_Component::CHARLIE_CLIMBING,
+                                 Avatar_Component::HANGING,
+                                 hand);
+  m_transitions.AddFrameComplete(Avatar_Component::CLIMBING_1,
+                                 Avatar_Component::CHARLIE_CLIMBING,
+                                 Avatar_Component::CLIMBING_2,
+                                 hand);
+  m_transitions.AddFrameComplete(Avatar_Component::CLIMBING_2,
+                                 Avatar_Component::CHARLIE_CLIMBING,
+                                 Avatar_Component::CLIMBING_TO_STANDING,
+                                 hand);
+  m_transitions.Compile();
+
   m_has_been_initialised = true;
   return true;
 }
@@ -53,16 +78,16 @@ void Charlie_Climbing_Controller::Run_Avatar_State() {
 
   // If there is a command (Left, Right, Run, Etc.)
   // The avatar will only respond to commands if they are in the Hanging state
-  if (current_command.state.compare("") != 0 && current_state.state.compare("Hanging") == 0) {
-    if (current_state.direction.compare(current_command.direction) == 0) {
+  if (current_command.state != Avatar_Component::NO_STATE && current_state.state == Avatar_Component::HANGING) {
+    if (current_state.direction == current_command.direction) {
       // Go up the ledge
-      Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Climbing", "Climbing_1", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+      Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_CLIMBING, Avatar_Component::CLIMBING_1, m_avatar->GetState().direction);
       Avatar_Helper::AlignAvatarOnLastHand(m_avatar);
       has_state_changed = true;
-    } else if (current_command.state.compare("Down") == 0) {
+    } else if (current_command.state == Avatar_Component::DOWN) {
       // Fall off the ledge
-      Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Jumping", "Wall_Jump_Fall_Arc", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
-      if (m_avatar->GetState().direction.compare("Right") == 0) {
+      Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_JUMPING, Avatar_Component::WALL_JUMP_FALL_ARC, m_avatar->GetState().direction);
+      if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
         Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightTop(m_avatar);
         Avatar_Helper::MoveAvatarTileAdjacent(m_avatar, "Left", *m_currently_grabbed_tile);
       } else {
@@ -75,41 +100,21 @@ void Charlie_Climbing_Controller::Run_Avatar_State() {
     // Continue the current state
     unsigned int state_index = current_state.state_index;
     state_index++;
-    if (state_index > (m_current_animation_subset->number_of_frames - 1)) {
+    if (state_index > (GetCurrentAnimationSubset().number_of_frames - 1)) {
       // State has finished!
-      if (m_current_animation_subset->is_repeatable) {
+      if (GetCurrentAnimationSubset().is_repeatable) {
         // Repeat state
         state_index = 0;
       } else {
         // Find the next state
-        if (current_state.state.compare("Ascending_To_Grabbing") == 0) {
-          Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Climbing", "Grabbing_To_Hanging", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastHand(m_avatar);
-          has_state_changed = true;
-        } else if (current_state.state.compare("Grabbing_To_Hanging") == 0) {
-          Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Climbing", "Hanging", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastHand(m_avatar);
-          has_state_changed = true;
-        } else if (current_state.state.compare("Descending_To_Grabbing") == 0) {
-          Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Climbing", "Grabbing_To_Hanging", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastHand(m_avatar);
-          has_state_changed = true;
-        } else if (current_state.state.compare("Climbing_1") == 0) {
-          Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Climbing", "Climbing_2", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastHand(m_avatar);
-          has_state_changed = true;
-        } else if (current_state.state.compare("Climbing_2") == 0) {
-          Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Climbing", "Climbing_To_Standing", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastHand(m_avatar);
+        if (Run_Avatar_State_Transition(current_command.state, true)) {
           has_state_changed = true;
-        } else if (current_state.state.compare("Climbing_To_Standing") == 0 || 
-                   current_state.state.compare("Pop_Up") == 0) {
+        } else if (current_state.state == Avatar_Component::CLIMBING_TO_STANDING || 
+                   current_state.state == Avatar_Component::POP_UP) {
           m_avatar->SetVelocity(D3DXVECTOR3(0, 0, 0));
-          if (current_command.state.compare("Jumping") == 0) {
-            D3DXVECTOR3 position = *m_avatar->GetPosition();
-            position += m_avatar->GetVelocity();
-            m_avatar->SetPosition(position);
-            if (current_command.direction.compare("Right") == 0) {
+          if (current_command.state == Avatar_Component::JUMPING) {
+            m_avatar->MoveFixedPosition(m_avatar->GetFixedVelocity());
+            if (current_command.direction == Avatar_Component::RIGHT) {
               float y_velocity = 24;
               float x_velocity = 24;
               m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
@@ -118,33 +123,33 @@ void Charlie_Climbing_Controller::Run_Avatar_State() {
               float x_velocity = -24;
               m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
             }
-            if (current_command.direction.compare("Right") == 0 || current_command.direction.compare("Left") == 0) {
-              Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Jumping", "Gap_Jump_Takeoff", current_command.direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+            if (current_command.direction == Avatar_Component::RIGHT || current_command.direction == Avatar_Component::LEFT) {
+              Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_JUMPING, Avatar_Component::GAP_JUMP_TAKEOFF, current_command.direction);
             } else {
-              Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Jumping", "Gap_Jump_Takeoff", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+              Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_JUMPING, Avatar_Component::GAP_JUMP_TAKEOFF, m_avatar->GetState().direction);
             }
             has_state_changed = true;
             Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
-          } else if (current_command.state.compare("Running") == 0) {
-            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Running", "Standing_To_Running", current_command.direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+          } else if (current_command.state == Avatar_Component::RUNNING) {
+            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_RUNNING, Avatar_Component::STANDING_TO_RUNNING, current_command.direction);
             Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
           } else {
-            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Standing", "Standing", current_state.direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_STANDING, Avatar_Component::STANDING, current_state.direction);
             Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
           }
           has_state_changed = true;
           (*m_y_fallen) = 0;
         } else {
           std::string error;
-          error = "No handling for this non-repeating animation: " + current_state.state;
+          error = "No handling for this non-repeating animation: " + Avatar_State_Names::GetInstance()->GetStateName(current_state.state);
           throw Exceptions::init_error(error);
         }
       }
     }
     if (!has_state_changed) {
       if (current_state == last_state) {
-        Avatar_Helper::SetAvatarStateAnimationFrame(m_avatar, state_index, m_current_animation_subset);
-        if (current_state.state.compare("Climbing_To_Standing") == 0) {
+        Avatar_Helper::SetAvatarStateAnimationFrame(m_avatar, state_index, m_animation_library);
+        if (current_state.state == Avatar_Component::CLIMBING_TO_STANDING) {
           Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
         } else {
           Avatar_Helper::AlignAvatarOnLastHand(m_avatar);
@@ -38,6 +38,32 @@ Charlie_Falling_Controller::~Charlie_Falling_Controller() {
 //------------------------------------------------------------------------------
 bool Charlie_Falling_Controller::Init(Component_Composite *const model) {
   Avatar_State_Controller::Init(model);
+
+  // Falling to death ends in death
+  m_transitions.AddFrameComplete(Avatar_Component::DOWN_FACING_FALLING_TO_DEATH,
+                                 Avatar_Component::CHARLIE_FALLING,
+                                 Avatar_Component::DOWN_FACING_DEATH,
+                                 Avatar_State_Transitions::ALIGN_ON_LAST_COLLISION_BLOCK);
+  m_transitions.AddFrameComplete(Avatar_Component::UP_FACING_FALLING_TO_DEATH,
+                                 Avatar_Component::CHARLIE_FALLING,
+                                 Avatar_Component::UP_FACING_DEATH,
+                                 Avatar_State_Transitions::ALIGN_ON_LAST_COLLISION_BLOCK);
+
+  // Hitting a wall flips the avatar over and nudges it off the wall
+  m_transitions.AddFrameComplete(Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT,
+                                 Avatar_Component::CHARLIE_FALLING,
+                                 Avatar_Component::UP_FACING_FALLING,
+                                 Avatar_State_Transitions::ALIGN_ON_LAST_FACING_BOTTOM);
+  m_transitions.AddFrameComplete(Avatar_Component::UP_FALLING_WALL_IMPACT_LEFT,
+                                 Avatar_Component::CHARLIE_FALLING,
+                                 Avatar_Component::DOWN_FACING_FALLING,
+                                 Avatar_State_Transitions::ALIGN_ON_LAST_BACK_BOTTOM);
+  m_transitions.SetExitHook(Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT,
+                            Avatar_State_Transitions::State_Hook(-2, 0, true));
+  m_transitions.SetExitHook(Avatar_Component::UP_FALLING_WALL_IMPACT_LEFT,
+                            Avatar_State_Transitions::State_Hook(2, 0, true));
+  m_transitions.Compile();
+
   m_has_been_initialised = true;
   return true;
 }
@@ -51,63 +77,21 @@ void Charlie_Falling_Controller::Run_Avatar_State() {
   // If you are in the Falling state you have no control of the Avatar
   unsigned int state_index = current_state.state_index;
   state_index++;
-  if (state_index > (m_current_animation_subset->number_of_frames - 1)) {
-    if (m_current_animation_subset->is_repeatable) {
+  if (state_index > (GetCurrentAnimationSubset().number_of_frames - 1)) {
+    if (GetCurrentAnimationSubset().is_repeatable) {
       // Repeat the current state
       state_index = 0;
-      Avatar_Helper::SetAvatarStateAnimationFrame(m_avatar, state_index, m_current_animation_subset);
+      Avatar_Helper::SetAvatarStateAnimationFrame(m_avatar, state_index, m_animation_library);
     }
     else {
       // Find the next state to transfer into
-      if (current_state.state.compare("Down_Facing_Falling_To_Death") == 0) {
-        Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Falling", "Down_Facing_Death", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
-        Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);
-        state_index = 0;
-        current_state = m_avatar->GetState();
-      }
-      else if (current_state.state.compare("Down_Falling_Wall_Impact_Right") == 0) {
-        Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Falling", "Up_Facing_Falling", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
-        if (m_avatar->GetState().direction.compare("Right") == 0) {
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
-          D3DXVECTOR3 old_velocity = m_avatar->GetVelocity();
-          D3DXVECTOR3 new_velocity = D3DXVECTOR3(-2, old_velocity.y, 0);
-          m_avatar->SetVelocity(new_velocity);
-        }
-        else {
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
-          D3DXVECTOR3 old_velocity = m_avatar->GetVelocity();
-          D3DXVECTOR3 new_velocity = D3DXVECTOR3(2, old_velocity.y, 0);
-          m_avatar->SetVelocity(new_velocity);
-        }
-        state_index = 0;
-        current_state = m_avatar->GetState();
-      }
-      else if (current_state.state.compare("Up_Facing_Falling_To_Death") == 0) {
-        Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Falling", "Up_Facing_Death", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
-        Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);
-        state_index = 0;
-        current_state = m_avatar->GetState();
-      }
-      else if (current_state.state.compare("Up_Falling_Wall_Impact_Left") == 0) {
-        Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Falling", "Down_Facing_Falling", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
-        if (m_avatar->GetState().direction.compare("Right") == 0) {
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
-          D3DXVECTOR3 old_velocity = m_avatar->GetVelocity();
-          D3DXVECTOR3 new_velocity = D3DXVECTOR3(2, old_velocity.y, 0);
-          m_avatar->SetVelocity(new_velocity);
-        }
-        else {
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
-          D3DXVECTOR3 old_velocity = m_avatar->GetVelocity();
-          D3DXVECTOR3 new_velocity = D3DXVECTOR3(-2, old_velocity.y, 0);
-          m_avatar->SetVelocity(new_velocity);
-        }
+      if (Run_Avatar_State_Transition(m_avatar->GetCommand().state, true)) {
         state_index = 0;
         current_state = m_avatar->GetState();
       }
       else {
         std::string error;
-        error = "No handling for the non-repeating animation: " + current_state.state;
+        error = "No handling for the non-repeating animation: " + Avatar_State_Names::GetInstance()->GetStateName(current_state.state);
         throw Exceptions::init_error(error);
       }
     }
@@ -116,17 +100,17 @@ void Charlie_Falling_Controller::Run_Avatar_State() {
     // If this isn't the first time the avatar has run through (because it would have been set
     // by the SetAvatarState() before recalling the RunAvatarState()) update the state.
     if (m_avatar->GetState() == m_avatar->GetLastRenderedState()) {
-      Avatar_Helper::SetAvatarStateAnimationFrame(m_avatar, state_index, m_current_animation_subset);
+      Avatar_Helper::SetAvatarStateAnimationFrame(m_avatar, state_index, m_animation_library);
       Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
     }
   }
 
-  if (current_state.state.compare("Down_Facing_Falling_To_Death") != 0 &&
-    current_state.state.compare("Down_Facing_Death") != 0 &&
-    current_state.state.compare("Up_Facing_Falling_To_Death") != 0 &&
-    current_state.state.compare("Down_Falling_Wall_Impact_Right") != 0 &&
-    current_state.state.compare("Up_Falling_Wall_Impact_Left") != 0 &&
-    current_state.state.compare("Up_Facing_Death") != 0) {
+  if (current_state.state != Avatar_Component::DOWN_FACING_FALLING_TO_DEATH &&
+    current_state.state != Avatar_Component::DOWN_FACING_DEATH &&
+    current_state.state != Avatar_Component::UP_FACING_FALLING_TO_DEATH &&
+    current_state.state != Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT &&
+    current_state.state != Avatar_Component::UP_FALLING_WALL_IMPACT_LEFT &&
+    current_state.state != Avatar_Component::UP_FACING_DEATH) {
     // Move the avatar down with respect with gravity
     // gravity doesn't affect the above states.
     D3DXVECTOR3 new_velocity = m_avatar->GetVelocity();
@@ -139,9 +123,7 @@ void Charlie_Falling_Controller::Run_Avatar_State() {
     }
 
     m_avatar->SetVelocity(new_velocity);
-    D3DXVECTOR3 position = *m_avatar->GetPosition();
-    position += new_velocity;
-    m_avatar->SetPosition(position);
+    m_avatar->MoveFixedPosition(m_avatar->GetFixedVelocity());
 
     // Add the velocity fallen to the total fallen variable
     (*m_y_fallen) += m_avatar->GetVelocity().y;
@@ -149,27 +131,27 @@ void Charlie_Falling_Controller::Run_Avatar_State() {
 
   std::vector<Avatar_Helper::Tile_Collision> out_colliding_wall_tiles;
   bool is_wall_colliding = false;
-  is_wall_colliding = Avatar_Helper::IsAvatarWallColliding(m_avatar, &out_colliding_wall_tiles, &m_wall_tiles);
+  is_wall_colliding = Avatar_Helper::IsAvatarWallColliding(m_avatar, &out_colliding_wall_tiles, m_tiles);
   if (is_wall_colliding) {
     // Set the currently adjacent tile pointer.
     (*m_adjacent_wall) = *(out_colliding_wall_tiles.begin());
     // State transitions are different depending on whether the avatar is collising with
     // a tile on the left or the right (of that tile)
     if (out_colliding_wall_tiles.begin()->collision_side.compare("Left") == 0) {
-      if (current_state.state.compare("Down_Falling_Wall_Impact_Right") != 0 &&
-        m_avatar->GetLastRenderedState().state.compare("Down_Falling_Wall_Impact_Right") != 0 &&
-        current_state.state.compare("Up_Falling_Wall_Impact_Left") != 0 &&
-        m_avatar->GetLastRenderedState().state.compare("Up_Falling_Wall_Impact_Left") != 0) {
-        if (current_state.state.compare("Down_Facing_Falling_To_Death") != 0 &&
-          current_state.state.compare("Down_Facing_Death") != 0 &&
-          current_state.state.compare("Up_Facing_Falling_To_Death") != 0 &&
-          current_state.state.compare("Up_Facing_Death") != 0) {
-          if (m_avatar->GetState().direction.compare("Right") == 0) {
-            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Falling", "Down_Falling_Wall_Impact_Right", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+      if (current_state.state != Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT &&
+        m_avatar->GetLastRenderedState().state != Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT &&
+        current_state.state != Avatar_Component::UP_FALLING_WALL_IMPACT_LEFT &&
+        m_avatar->GetLastRenderedState().state != Avatar_Component::UP_FALLING_WALL_IMPACT_LEFT) {
+        if (current_state.state != Avatar_Component::DOWN_FACING_FALLING_TO_DEATH &&
+          current_state.state != Avatar_Component::DOWN_FACING_DEATH &&
+          current_state.state != Avatar_Component::UP_FACING_FALLING_TO_DEATH &&
+          current_state.state != Avatar_Component::UP_FACING_DEATH) {
+          if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
+            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_FALLING, Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT, m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
           }
           else {
-            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Falling", "Up_Falling_Wall_Impact_Left", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_FALLING, Avatar_Component::UP_FALLING_WALL_IMPACT_LEFT, m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
           }
           // This removes the horizontal velocity from the avatar
@@ -181,20 +163,20 @@ void Charlie_Falling_Controller::Run_Avatar_State() {
       Avatar_Helper::MoveAvatarTileAdjacent(m_avatar, "Left", out_colliding_wall_tiles.begin()->colliding_tile);
     }
     else {
-      if (current_state.state.compare("Down_Falling_Wall_Impact_Right") != 0 &&
-        m_avatar->GetLastRenderedState().state.compare("Down_Falling_Wall_Impact_Right") != 0 &&
-        current_state.state.compare("Up_Falling_Wall_Impact_Left") != 0 &&
-        m_avatar->GetLastRenderedState().state.compare("Up_Falling_Wall_Impact_Left") != 0) {
-        if (current_state.state.compare("Down_Facing_Falling_To_Death") != 0 &&
-          current_state.state.compare("Down_Facing_Death") != 0 &&
-          current_state.state.compare("Up_Facing_Falling_To_Death") != 0 &&
-          current_state.state.compare("Up_Facing_Death") != 0) {
-          if (m_avatar->GetState().direction.compare("Right") == 0) {
-            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Falling", "Up_Falling_Wall_Impact_Left", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+      if (current_state.state != Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT &&
+        m_avatar->GetLastRenderedState().state != Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT &&
+        current_state.state != Avatar_Component::UP_FALLING_WALL_IMPACT_LEFT &&
+        m_avatar->GetLastRenderedState().state != Avatar_Component::UP_FALLING_WALL_IMPACT_LEFT) {
+        if (current_state.state != Avatar_Component::DOWN_FACING_FALLING_TO_DEATH &&
+          current_state.state != Avatar_Component::DOWN_FACING_DEATH &&
+          current_state.state != Avatar_Component::UP_FACING_FALLING_TO_DEATH &&
+          current_state.state != Avatar_Component::UP_FACING_DEATH) {
+          if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
+            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_FALLING, Avatar_Component::UP_FALLING_WALL_IMPACT_LEFT, m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
           }
           else {
-            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Falling", "Down_Falling_Wall_Impact_Right", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+            Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_FALLING, Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT, m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
           }
           // This removes the horizontal velocity from the avatar
@@ -210,21 +192,21 @@ void Charlie_Falling_Controller::Run_Avatar_State() {
   // If the avatar has fallen on the floor while in the falling state
   // they are dead! Make it so.
 
-  if (current_state.state.compare("Down_Facing_Falling_To_Death") != 0 &&
-      current_state.state.compare("Down_Facing_Death") != 0 &&
-      current_state.state.compare("Up_Facing_Falling_To_Death") != 0 &&
-      current_state.state.compare("Up_Facing_Death") != 0) {
+  if (current_state.state != Avatar_Component::DOWN_FACING_FALLING_TO_DEATH &&
+      current_state.state != Avatar_Component::DOWN_FACING_DEATH &&
+      current_state.state != Avatar_Component::UP_FACING_FALLING_TO_DEATH &&
+      current_state.state != Avatar_Component::UP_FACING_DEATH) {
     std::vector<Avatar_Helper::Tile_Collision> out_colliding_floor_tiles;
-    bool is_colliding = Avatar_Helper::IsAvatarFloorColliding(m_avatar, &out_colliding_floor_tiles, &m_floor_tiles);
+    bool is_colliding = Avatar_Helper::IsAvatarFloorColliding(m_avatar, &out_colliding_floor_tiles, m_tiles);
     if (is_colliding) {
       if ((*m_y_fallen) < m_falling_point_of_safe_landing) {
-        if (current_state.state.compare("Down_Facing_Falling") == 0 || current_state.state.compare("Down_Falling_Wall_Impact_Right") == 0) {
-          Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Falling", "Down_Facing_Falling_To_Death", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+        if (current_state.state == Avatar_Component::DOWN_FACING_FALLING || current_state.state == Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT) {
+          Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_FALLING, Avatar_Component::DOWN_FACING_FALLING_TO_DEATH, m_avatar->GetState().direction);
         }
-        else if (current_state.state.compare("Up_Facing_Falling") == 0 || current_state.state.compare("Up_Falling_Wall_Impact_Left") == 0) {
-          Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Falling", "Up_Facing_Falling_To_Death", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+        else if (current_state.state == Avatar_Component::UP_FACING_FALLING || current_state.state == Avatar_Component::UP_FALLING_WALL_IMPACT_LEFT) {
+          Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_FALLING, Avatar_Component::UP_FACING_FALLING_TO_DEATH, m_avatar->GetState().direction);
         }
-        if (m_avatar->GetState().direction.compare("Left") == 0) {
+        if (m_avatar->GetState().direction == Avatar_Component::LEFT) {
           Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
         }
         else {
@@ -234,7 +216,7 @@ void Charlie_Falling_Controller::Run_Avatar_State() {
         has_state_changed = true;
       }
       else {
-        Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_metadata, "Charlie_Standing", "Standing", m_avatar->GetState().direction, m_current_metadata_file_path, m_current_metadata, m_current_animation_subset);
+        Avatar_Helper::SetAvatarState(m_avatar, m_game_settings->GetTilesetPath(), m_animation_library, Avatar_Component::CHARLIE_STANDING, Avatar_Component::STANDING, m_avatar->GetState().direction);
         Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);
         m_y_fallen = 0;
         Avatar_Helper::MoveAvatarTileAdjacent(m_avatar, "Top", out_colliding_floor_tiles.begin()->colliding_tile);
@@ -47,6 +47,41 @@ Charlie_Jumping_Controller::~Charlie_Jumping_Controller() {
 //------------------------------------------------------------------------------
 bool Charlie_Jumping_Controller::Init(Component_Composite *const model) {
   m_model = model;
+
+  // Each stage of a jump runs into the next as its animation finishes.
+  // Landings depend on the command and velocity and are handled in
+  // Run_Avatar_State.
+  Avatar_State_Transitions::Alignment collision_block = Avatar_State_Transitions::ALIGN_ON_LAST_COLLISION_BLOCK;
+  m_transitions.AddFrameComplete(Avatar_Component::WALL_JUMP_TAKEOFF,
+                                 Avatar_Component::CHARLIE_JUMPING,
+                                 Avatar_Component::WALL_JUMP_RISE_ARC,
+                                 collision_block);
+  m_transitions.AddFrameComplete(Avatar_Component::WALL_JUMP_RISE_ARC,
+                                 Avatar_Component::CHARLIE_JUMPING,
+                                 Avatar_Component::WALL_JUMP_RISING,
+                                 collision_block);
+  m_transitions.AddFrameComplete(Avatar_Component::WALL_JUMP_FALL_ARC,
+                                 Avatar_Component::CHARLIE_JUMPING,
+                                 Avatar_Component::WALL_JUMP_FALLING,
+                                 collision_block);
+  m_transitions.AddFrameComplete(Avatar_Component::VERTICAL_JUMP_TAKEOFF,
+                                 Avatar_Component::CHARLIE_JUMPING,
+                                 Avatar_Component::VERTICAL_JUMP_ARC,
+                                 collision_block);
+  m_transitions.AddFrameComplete(Avatar_Component::GAP_JUMP_TAKEOFF,
+                                 Avatar_Component::CHARLIE_JUMPING,
+                                 Avatar_Component::GAP_JUMP_ARC_RISE,
+                                 collision_block);
+  m_transitions.AddFrameComplete(Avatar_Component::GAP_JUMP_ARC_RISE,
+                                 Avatar_Component::CHARLIE_JUMPING,
+                                 Avatar_Component::GAP_JUMP_ARC_FALL,
+                                 collision_block);
+  m_transitions.AddFrameComplete(Avatar_Component::GAP_JUMP_ARC_FALL,
+                                 Avatar_Component::CHARLIE_JUMPING,
+                                 Avatar_Component::GAP_JUMP_FALLING,
+                                 collision_block);
+  m_transitions.Compile();
+
   m_has_been_initialised = true;
   return true;
 }
@@ -59,9 +94,9 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
   bool has_state_changed = false;
 
   // This state does not recognize the follwing commands:
-  if (current_command.state == "Down" ||
-        current_command.state == "Looking") {
-    current_command.state = "";
+  if (current_command.state == Avatar_Component::DOWN ||
+        current_command.state == Avatar_Component::LOOKING) {
+    current_command.state = Avatar_Component::NO_STATE;
   }
 
   unsigned int state_index = current_state.state_index;
@@ -73,61 +108,49 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
   // state controller or a different state controller by SetAvatarState.
   if (current_state == last_state) {
     // State includes 0 as the first state.
-    if (state_index > (m_current_animation_subset->number_of_frames - 1)) {
-      if (m_current_animation_subset->is_repeatable) {
-        if (current_state.state == "Wall_Jump_Rising") {
+    if (state_index > (GetCurrentAnimationSubset().number_of_frames - 1)) {
+      if (GetCurrentAnimationSubset().is_repeatable) {
+        if (current_state.state == Avatar_Component::WALL_JUMP_RISING) {
           if (m_avatar->GetVelocity().y <= 0) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Wall_Jump_Fall_Arc",
-                                          current_state.direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::WALL_JUMP_FALL_ARC,
+                                          current_state.direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);
             has_state_changed = true;
           }
-        } else if (current_state.state == "Wall_Jump_Falling") {
+        } else if (current_state.state == Avatar_Component::WALL_JUMP_FALLING) {
           if ((*m_y_fallen) < m_safe_falling_limit) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Falling",
-                                          "Down_Facing_Falling",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_FALLING,
+                                          Avatar_Component::DOWN_FACING_FALLING,
+                                          m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);;
             has_state_changed = true;
           }
-        } else if (current_state.state == "Gap_Jump_Falling") {
+        } else if (current_state.state == Avatar_Component::GAP_JUMP_FALLING) {
           if ((*m_y_fallen) < m_safe_falling_limit) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Falling",
-                                          "Down_Facing_Falling",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_FALLING,
+                                          Avatar_Component::DOWN_FACING_FALLING,
+                                          m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);;
             has_state_changed = true;
           }
-        } else if (current_state.state == "Vertical_Jump_Arc") {
+        } else if (current_state.state == Avatar_Component::VERTICAL_JUMP_ARC) {
           if ((*m_y_fallen) < m_safe_falling_limit) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Falling",
-                                          "Down_Facing_Falling",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_FALLING,
+                                          Avatar_Component::DOWN_FACING_FALLING,
+                                          m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);;
             has_state_changed = true;
           }
@@ -135,105 +158,51 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
         // This is set for alignment on the previous state
         state_index = 0;
       } else {
-        if (current_state.state == "Wall_Jump_Takeoff") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Jumping",
-                                        "Wall_Jump_Rise_Arc",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);;
-          has_state_changed = true;
-        } else if (current_state.state == "Wall_Jump_Rise_Arc") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Jumping",
-                                        "Wall_Jump_Rising",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);;
-          has_state_changed = true;
-        } else if (current_state.state == "Wall_Jump_Fall_Arc") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Jumping",
-                                        "Wall_Jump_Falling",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);;
-          has_state_changed = true;
-        } else if (current_state.state == "Vertical_Jump_Takeoff") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Jumping",
-                                        "Vertical_Jump_Arc",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);;
+        // Find the next state
+        if (Run_Avatar_State_Transition(current_command.state, true)) {
           has_state_changed = true;
-        } else if (current_state.state == "Vertical_Jump_Landing" ||
-                     current_state.state == "Wall_Jump_Landing") {
+        } else if (current_state.state == Avatar_Component::VERTICAL_JUMP_LANDING ||
+                     current_state.state == Avatar_Component::WALL_JUMP_LANDING) {
           m_avatar->SetVelocity(D3DXVECTOR3(0, 0, 0));
 
-          if (current_command.state == "Jumping") {
+          if (current_command.state == Avatar_Component::JUMPING) {
             float y_velocity = m_vertical_jump_y_initial_velocity;
             float x_velocity = m_vertical_jump_x_initial_velocity;
-            if (current_state.direction == "Left") {
+            if (current_state.direction == Avatar_Component::LEFT) {
               x_velocity *= -1;
             }
             m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
 
-            if (current_command.direction == "Right" ||
-                  current_command.direction == "Left" ) {
+            if (current_command.direction == Avatar_Component::RIGHT ||
+                  current_command.direction == Avatar_Component::LEFT ) {
               Avatar_Helper::SetAvatarState(m_avatar,
                                             m_game_settings->GetTilesetPath(),
-                                            m_animation_metadata,
-                                            "Charlie_Jumping",
-                                            "Vertical_Jump_Takeoff",
-                                            current_command.direction,
-                                            m_current_metadata_file_path,
-                                            m_current_metadata,
-                                            m_current_animation_subset);
+                                            m_animation_library,
+                                            Avatar_Component::CHARLIE_JUMPING,
+                                            Avatar_Component::VERTICAL_JUMP_TAKEOFF,
+                                            current_command.direction);
             } else {
               Avatar_Helper::SetAvatarState(m_avatar,
                                             m_game_settings->GetTilesetPath(),
-                                            m_animation_metadata,
-                                            "Charlie_Jumping",
-                                            "Vertical_Jump_Takeoff",
-                                            m_avatar->GetState().direction,
-                                            m_current_metadata_file_path,
-                                            m_current_metadata,
-                                            m_current_animation_subset);
+                                            m_animation_library,
+                                            Avatar_Component::CHARLIE_JUMPING,
+                                            Avatar_Component::VERTICAL_JUMP_TAKEOFF,
+                                            m_avatar->GetState().direction);
             }
-            if (m_avatar->GetState().direction == "Right") {
+            if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
               Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
             } else {
               Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
             }
             has_state_changed = true;
-          } else if (current_command.state == "Running") {
+          } else if (current_command.state == Avatar_Component::RUNNING) {
               Avatar_Helper::SetAvatarState(m_avatar,
                                             m_game_settings->GetTilesetPath(),
-                                            m_animation_metadata,
-                                            "Charlie_Running",
-                                            "Standing_To_Running",
-                                            current_command.direction,
-                                            m_current_metadata_file_path,
-                                            m_current_metadata,
-                                            m_current_animation_subset);
-              if (current_command.direction == "Right") {
+                                            m_animation_library,
+                                            Avatar_Component::CHARLIE_RUNNING,
+                                            Avatar_Component::STANDING_TO_RUNNING,
+                                            current_command.direction);
+              if (current_command.direction == Avatar_Component::RIGHT) {
                 Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
               } else {
                 Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
@@ -241,14 +210,11 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
           } else {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Standing",
-                                          "Standing",
-                                          current_state.direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
-            if (m_avatar->GetState().direction == "Right") {
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_STANDING,
+                                          Avatar_Component::STANDING,
+                                          current_state.direction);
+            if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
               Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
             } else {
               Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
@@ -257,77 +223,35 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
           has_state_changed = true;
           (*m_y_fallen) = 0;
           (*m_distance_traveled) = 0;
-        } else if (current_state.state == "Gap_Jump_Takeoff") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Jumping",
-                                        "Gap_Jump_Arc_Rise",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);;
-          has_state_changed = true;
-        } else if (current_state.state == "Gap_Jump_Arc_Rise") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Jumping",
-                                        "Gap_Jump_Arc_Fall",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);;
-          has_state_changed = true;
-        } else if (current_state.state == "Gap_Jump_Arc_Fall") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Jumping",
-                                        "Gap_Jump_Falling",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);;
-          has_state_changed = true;
-        } else if (current_state.state == "Gap_Jump_Landing") {
+        } else if (current_state.state == Avatar_Component::GAP_JUMP_LANDING) {
           m_avatar->SetVelocity(D3DXVECTOR3(m_avatar->GetVelocity().x, 0, 0));
-          if (current_command.state == "Jumping") {
+          if (current_command.state == Avatar_Component::JUMPING) {
             // Avatar is Jumping after a Gap Jump
             if (current_command.direction == current_state.direction) {
               float y_velocity = m_gap_jump_y_initial_velocity;
               float x_velocity = m_gap_jump_x_initial_velocity;
-              if (current_command.direction == "Left") {
+              if (current_command.direction == Avatar_Component::LEFT) {
                 x_velocity *= -1;
               }
               m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
 
-              if (current_command.direction == "Right" ||
-                    current_command.direction == "Left") {
+              if (current_command.direction == Avatar_Component::RIGHT ||
+                    current_command.direction == Avatar_Component::LEFT) {
                 Avatar_Helper::SetAvatarState(m_avatar,
                                               m_game_settings->GetTilesetPath(),
-                                              m_animation_metadata,
-                                              "Charlie_Jumping",
-                                              "Gap_Jump_Takeoff",
-                                              current_command.direction,
-                                              m_current_metadata_file_path,
-                                              m_current_metadata,
-                                              m_current_animation_subset);
+                                              m_animation_library,
+                                              Avatar_Component::CHARLIE_JUMPING,
+                                              Avatar_Component::GAP_JUMP_TAKEOFF,
+                                              current_command.direction);
               } else {
                 Avatar_Helper::SetAvatarState(m_avatar,
                                               m_game_settings->GetTilesetPath(),
-                                              m_animation_metadata,
-                                              "Charlie_Jumping",
-                                              "Gap_Jump_Takeoff",
-                                              m_avatar->GetState().direction,
-                                              m_current_metadata_file_path,
-                                              m_current_metadata,
-                                              m_current_animation_subset);
+                                              m_animation_library,
+                                              Avatar_Component::CHARLIE_JUMPING,
+                                              Avatar_Component::GAP_JUMP_TAKEOFF,
+                                              m_avatar->GetState().direction);
               }
-              if (m_avatar->GetState().direction == "Right") {
+              if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
                 Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
               } else {
                 Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
@@ -335,14 +259,11 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
             } else {
               Avatar_Helper::SetAvatarState(m_avatar,
                                             m_game_settings->GetTilesetPath(),
-                                            m_animation_metadata,
-                                            "Charlie_Running",
-                                            "Stopping",
-                                            m_avatar->GetState().direction,
-                                            m_current_metadata_file_path,
-                                            m_current_metadata,
-                                            m_current_animation_subset);
-              if (m_avatar->GetState().direction == "Right") {
+                                            m_animation_library,
+                                            Avatar_Component::CHARLIE_RUNNING,
+                                            Avatar_Component::STOPPING,
+                                            m_avatar->GetState().direction);
+              if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
                 Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
               } else {
                 Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
@@ -350,31 +271,26 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
               has_state_changed = true;
               (*m_is_moving_continuously) = false;
             }
-          } else if (current_command.state == "Running") {
+          } else if (current_command.state == Avatar_Component::RUNNING) {
             // After is running after landing from a Gap Jump
             if (current_command.direction == current_state.direction) {
               (*m_is_moving_continuously) = true;
               D3DXVECTOR3 new_velocity(m_running_x_velocity, 0, 0);
-              if (current_state.direction == "Left") {
+              if (current_state.direction == Avatar_Component::LEFT) {
                  new_velocity.x *= -1;
               }
               m_avatar->SetVelocity(new_velocity);
 
-              D3DXVECTOR3 position = *m_avatar->GetPosition();
-              position += new_velocity;
+              m_avatar->MoveFixedPosition(m_avatar->GetFixedVelocity());
               (*m_y_fallen) += m_avatar->GetVelocity().y;
-              m_avatar->SetPosition(position);
 
               Avatar_Helper::SetAvatarState(m_avatar,
                                             m_game_settings->GetTilesetPath(),
-                                            m_animation_metadata,
-                                            "Charlie_" + current_command.state,
+                                            m_animation_library,
+                                            Avatar_State_Names::GetInstance()->GetParentStateID(current_command.state),
                                             current_command.state,
-                                            current_command.direction,
-                                            m_current_metadata_file_path,
-                                            m_current_metadata,
-                                            m_current_animation_subset);
-              if (m_avatar->GetState().direction == "Right") {
+                                            current_command.direction);
+              if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
                 Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
               } else {
                 Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
@@ -382,14 +298,11 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
             } else {
               Avatar_Helper::SetAvatarState(m_avatar,
                                             m_game_settings->GetTilesetPath(),
-                                            m_animation_metadata,
-                                            "Charlie_Running",
-                                            "Stopping",
-                                            m_avatar->GetState().direction,
-                                            m_current_metadata_file_path,
-                                            m_current_metadata,
-                                            m_current_animation_subset);
-              if (m_avatar->GetState().direction == "Right") {
+                                            m_animation_library,
+                                            Avatar_Component::CHARLIE_RUNNING,
+                                            Avatar_Component::STOPPING,
+                                            m_avatar->GetState().direction);
+              if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
                 Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
               } else {
                 Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
@@ -400,14 +313,11 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
           } else {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Standing",
-                                          "Standing",
-                                          current_state.direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
-            if (m_avatar->GetState().direction == "Right") {
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_STANDING,
+                                          Avatar_Component::STANDING,
+                                          current_state.direction);
+            if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
               Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
             } else {
               Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
@@ -417,7 +327,7 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
           (*m_y_fallen) = 0;
         } else {
           string error;
-          error = "No handling for the non-repeating animation: " + current_command.state;
+          error = "No handling for the non-repeating animation: " + Avatar_State_Names::GetInstance()->GetStateName(current_command.state);
           throw Exceptions::init_error(error);
         }
       }
@@ -433,23 +343,23 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
     if (current_state == last_state) {
       Avatar_Helper::SetAvatarStateAnimationFrame(m_avatar,
                                                   state_index,
-                                                  m_current_animation_subset);
+                                                  m_animation_library);
       // Align the new avatar state on the last
-      if (current_state.state == "Wall_Jump_Takeoff" ||
-          current_state.state == "Vertical_Jump_Landing" ||
-          current_state.state == "Vertical_Jump_Takeoff" ||
-          current_state.state == "Gap_Jump_Takeoff" ||
-          current_state.state == "Gap_Jump_Landing") {
+      if (current_state.state == Avatar_Component::WALL_JUMP_TAKEOFF ||
+          current_state.state == Avatar_Component::VERTICAL_JUMP_LANDING ||
+          current_state.state == Avatar_Component::VERTICAL_JUMP_TAKEOFF ||
+          current_state.state == Avatar_Component::GAP_JUMP_TAKEOFF ||
+          current_state.state == Avatar_Component::GAP_JUMP_LANDING) {
         Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
-      } else if (current_state.state == "Wall_Jump_Rise_Arc" ||
-                 current_state.state == "Wall_Jump_Rising" ||
-                 current_state.state == "Wall_Jump_Fall_Arc" ||
-                 current_state.state == "Wall_Jump_Falling" ) {
+      } else if (current_state.state == Avatar_Component::WALL_JUMP_RISE_ARC ||
+                 current_state.state == Avatar_Component::WALL_JUMP_RISING ||
+                 current_state.state == Avatar_Component::WALL_JUMP_FALL_ARC ||
+                 current_state.state == Avatar_Component::WALL_JUMP_FALLING ) {
         Avatar_Helper::MoveAvatarTileAdjacent(m_avatar,
                                               m_adjacent_wall->collision_side,
                                               m_adjacent_wall->colliding_tile);
       } else {
-        if (m_avatar->GetState().direction == "Right") {
+        if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
           Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
         } else {
           Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
@@ -458,19 +368,16 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
     }
 
     // Move the avatar!
-    if (current_state.state == "Vertical_Jump_Arc" ||
-        current_state.state == "Gap_Jump_Arc_Rise" ||
-        current_state.state == "Gap_Jump_Arc_Fall" ||
-        current_state.state == "Gap_Jump_Falling" ||
-        current_state.state == "Wall_Jump_Rise_Arc" ||
-        current_state.state == "Wall_Jump_Rising" ||
-        current_state.state == "Wall_Jump_Fall_Arc" ||
-        current_state.state == "Wall_Jump_Falling") {
-      D3DXVECTOR3 position = *m_avatar->GetPosition();
-      D3DXVECTOR3 velocity = m_avatar->GetVelocity();
-      position += velocity;
+    if (current_state.state == Avatar_Component::VERTICAL_JUMP_ARC ||
+        current_state.state == Avatar_Component::GAP_JUMP_ARC_RISE ||
+        current_state.state == Avatar_Component::GAP_JUMP_ARC_FALL ||
+        current_state.state == Avatar_Component::GAP_JUMP_FALLING ||
+        current_state.state == Avatar_Component::WALL_JUMP_RISE_ARC ||
+        current_state.state == Avatar_Component::WALL_JUMP_RISING ||
+        current_state.state == Avatar_Component::WALL_JUMP_FALL_ARC ||
+        current_state.state == Avatar_Component::WALL_JUMP_FALLING) {
+      m_avatar->MoveFixedPosition(m_avatar->GetFixedVelocity());
       (*m_y_fallen) += m_avatar->GetVelocity().y;
-      m_avatar->SetPosition(position);
 
       D3DXVECTOR3 new_velocity = m_avatar->GetVelocity();
       new_velocity.y += m_world_settings->GetGravityInPixPerFrame();
@@ -479,31 +386,29 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
       }
 
       m_avatar->SetVelocity(new_velocity);
-    } else if (current_state.state == "Gap_Jump_Landing") {
-      D3DXVECTOR3 position = *m_avatar->GetPosition();
-      position.x += m_avatar->GetVelocity().x;
-      m_avatar->SetPosition(position);
+    } else if (current_state.state == Avatar_Component::GAP_JUMP_LANDING) {
+      m_avatar->MoveFixedPosition(Fixed_Point(m_avatar->GetFixedVelocity().x, 0));
     }
 
     // Is the new avatar tile and position colliding with a wall tile?
     vector<Avatar_Helper::Tile_Collision> *out_colliding_ledge_tiles = new vector<Avatar_Helper::Tile_Collision>();
-    bool can_avatar_grab_a_ledge = Avatar_Helper::CanAvatarGrabALedge(m_avatar, out_colliding_ledge_tiles, &m_ledge_tiles);
+    bool can_avatar_grab_a_ledge = Avatar_Helper::CanAvatarGrabALedge(m_avatar, out_colliding_ledge_tiles, m_tiles);
     vector<Avatar_Helper::Tile_Collision> *out_colliding_wall_tiles = new vector<Avatar_Helper::Tile_Collision>();
     bool is_wall_colliding = false;
     is_wall_colliding = Avatar_Helper::IsAvatarWallColliding(m_avatar,
                                                              out_colliding_wall_tiles,
-                                                             &m_wall_tiles);
+                                                             m_tiles);
     if (is_wall_colliding) {
       (*m_adjacent_wall) = *(out_colliding_wall_tiles->begin());
-      if (current_state.state == "Vertical_Jump_Takeoff" ||
-          current_state.state == "Vertical_Jump_Arc" ||
-          current_state.state == "Vertical_Jump_Landing" ||
-          current_state.state == "Wall_Jump_Takeoff" ||
-          current_state.state == "Wall_Jump_Rise_Arc" ||
-          current_state.state == "Wall_Jump_Rising" ||
-          current_state.state == "Wall_Jump_Fall_Arc" ||
-          current_state.state == "Wall_Jump_Falling" ||
-          current_state.state == "Wall_Jump_Landing") {
+      if (current_state.state == Avatar_Component::VERTICAL_JUMP_TAKEOFF ||
+          current_state.state == Avatar_Component::VERTICAL_JUMP_ARC ||
+          current_state.state == Avatar_Component::VERTICAL_JUMP_LANDING ||
+          current_state.state == Avatar_Component::WALL_JUMP_TAKEOFF ||
+          current_state.state == Avatar_Component::WALL_JUMP_RISE_ARC ||
+          current_state.state == Avatar_Component::WALL_JUMP_RISING ||
+          current_state.state == Avatar_Component::WALL_JUMP_FALL_ARC ||
+          current_state.state == Avatar_Component::WALL_JUMP_FALLING ||
+          current_state.state == Avatar_Component::WALL_JUMP_LANDING) {
         float y_velocity = m_avatar->GetVelocity().y;
         float x_velocity = 0;
         m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
@@ -513,29 +418,23 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
       } else if (can_avatar_grab_a_ledge) {
         Avatar_Helper::SetAvatarState(m_avatar,
                                       m_game_settings->GetTilesetPath(),
-                                      m_animation_metadata,
-                                      "Charlie_Climbing",
-                                      "Descending_To_Grabbing",
-                                      m_avatar->GetState().direction,
-                                      m_current_metadata_file_path,
-                                      m_current_metadata,
-                                      m_current_animation_subset);
+                                      m_animation_library,
+                                      Avatar_Component::CHARLIE_CLIMBING,
+                                      Avatar_Component::DESCENDING_TO_GRABBING,
+                                      m_avatar->GetState().direction);
         Avatar_Helper::AlignAvatarOnLastLedgeEdge(m_avatar,
                                                 *(out_colliding_ledge_tiles->begin()));
         *m_currently_grabbed_tile = out_colliding_ledge_tiles->begin()->colliding_tile;
         (*m_y_fallen) = 0;
         (*m_distance_traveled) = 0;
         has_state_changed = true;
-      } else if (current_state.state == "Gap_Jump_Landing") {
+      } else if (current_state.state == Avatar_Component::GAP_JUMP_LANDING) {
         Avatar_Helper::SetAvatarState(m_avatar,
                                       m_game_settings->GetTilesetPath(),
-                                      m_animation_metadata,
-                                      "Charlie_Running",
-                                      "Wall_Colliding_From_Mid_Speed_Takeoff",
-                                      m_avatar->GetState().direction,
-                                      m_current_metadata_file_path,
-                                      m_current_metadata,
-                                      m_current_animation_subset);
+                                      m_animation_library,
+                                      Avatar_Component::CHARLIE_RUNNING,
+                                      Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF,
+                                      m_avatar->GetState().direction);
         Avatar_Helper::MoveAvatarTileAdjacent(m_avatar,
                                               m_adjacent_wall->collision_side,
                                               m_adjacent_wall->colliding_tile);
@@ -545,13 +444,13 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
         // This is called when the avatar is jumping
         // and the command is to jump
         // and the avatar is colliding with a wall.
-        if (current_command.state == "Jumping") {
+        if (current_command.state == Avatar_Component::JUMPING) {
           float y_velocity = m_wall_jump_y_initial_velocity;
           float x_velocity = m_wall_jump_x_initial_velocity;
           if (m_avatar->GetVelocity().y > 0) {
               if ((*m_distance_traveled) > m_wall_jump_boost_distance_threshold) {
-              if (current_state.state == "Gap_Jump_Takeoff" ||
-                   (current_state.state == "Gap_Jump_Arc_Rise" &&
+              if (current_state.state == Avatar_Component::GAP_JUMP_TAKEOFF ||
+                   (current_state.state == Avatar_Component::GAP_JUMP_ARC_RISE &&
                      (current_state.state_index == 0 ||
                       current_state.state_index == 1))) {
                 y_velocity = m_vertical_jump_y_initial_velocity + m_wall_jump_y_initial_velocity;
@@ -559,20 +458,17 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
             }
           }
 
-          if (current_state.direction == "Left") {
+          if (current_state.direction == Avatar_Component::LEFT) {
             x_velocity = (x_velocity * -1);
           }
 
           m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
           Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Wall_Jump_Takeoff",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::WALL_JUMP_TAKEOFF,
+                                          m_avatar->GetState().direction);
           has_state_changed = true;
           if (out_colliding_wall_tiles->begin()->collision_side == "Right") {
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
@@ -589,28 +485,22 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
                                                   out_colliding_wall_tiles->begin()->colliding_tile);
           }
         } else if ((*m_y_fallen) < m_safe_falling_limit) {
-          if (m_avatar->GetState().direction == "Right") {
+          if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Vertical_Jump_Arc",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::VERTICAL_JUMP_ARC,
+                                          m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
             has_state_changed = true;
           } else {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Vertical_Jump_Arc",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::VERTICAL_JUMP_ARC,
+                                          m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
             has_state_changed = true;
           }
@@ -626,28 +516,22 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
                                                   out_colliding_wall_tiles->begin()->colliding_tile);
           }
         } else {
-          if (m_avatar->GetState().direction == "Right") {
+          if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Falling",
-                                          "Down_Falling_Wall_Impact_Right",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_FALLING,
+                                          Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT,
+                                          m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
             has_state_changed = true;
           } else {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Falling",
-                                          "Down_Falling_Wall_Impact_Right",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_FALLING,
+                                          Avatar_Component::DOWN_FALLING_WALL_IMPACT_RIGHT,
+                                          m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
             has_state_changed = true;
           }
@@ -670,64 +554,52 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
     delete out_colliding_ledge_tiles;
 
     // Is the new avatar size and position colliding with the floor?
-    if (current_state.state == "Gap_Jump_Arc_Fall" ||
-        current_state.state == "Gap_Jump_Falling" ||
-        current_state.state == "Vertical_Jump_Arc" ||
-        current_state.state == "Wall_Jump_Fall_Arc" ||
-        current_state.state == "Wall_Jump_Falling" ||
-        current_state.state == "Wall_Jump_Rise_Arc" ||
-        current_state.state == "Wall_Jump_Rising") {
+    if (current_state.state == Avatar_Component::GAP_JUMP_ARC_FALL ||
+        current_state.state == Avatar_Component::GAP_JUMP_FALLING ||
+        current_state.state == Avatar_Component::VERTICAL_JUMP_ARC ||
+        current_state.state == Avatar_Component::WALL_JUMP_FALL_ARC ||
+        current_state.state == Avatar_Component::WALL_JUMP_FALLING ||
+        current_state.state == Avatar_Component::WALL_JUMP_RISE_ARC ||
+        current_state.state == Avatar_Component::WALL_JUMP_RISING) {
       vector<Tile_Bitmap*> *adjacent_tiles = new vector<Tile_Bitmap*>();
       vector<Avatar_Helper::Tile_Collision> *out_colliding_floor_tiles = new vector<Avatar_Helper::Tile_Collision>();
-      bool is_floor_colliding = Avatar_Helper::IsAvatarFloorColliding(m_avatar, out_colliding_floor_tiles, &m_floor_tiles);
+      bool is_floor_colliding = Avatar_Helper::IsAvatarFloorColliding(m_avatar, out_colliding_floor_tiles, m_tiles);
       if (is_floor_colliding) {
         if ((*m_y_fallen) < m_safe_falling_limit) {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Falling",
-                                        "Down_Facing_Falling_To_Death",
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata, 
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_FALLING,
+                                        Avatar_Component::DOWN_FACING_FALLING_TO_DEATH,
+                                        m_avatar->GetState().direction);
         } else {
-          if (current_state.state == "Vertical_Jump_Arc") {
+          if (current_state.state == Avatar_Component::VERTICAL_JUMP_ARC) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Vertical_Jump_Landing",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
-          } else if (current_state.state == "Gap_Jump_Arc_Fall" ||
-                       current_state.state == "Gap_Jump_Falling") {
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::VERTICAL_JUMP_LANDING,
+                                          m_avatar->GetState().direction);
+          } else if (current_state.state == Avatar_Component::GAP_JUMP_ARC_FALL ||
+                       current_state.state == Avatar_Component::GAP_JUMP_FALLING) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Gap_Jump_Landing",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
-          } else if (current_state.state == "Wall_Jump_Falling" ||
-                       current_state.state == "Wall_Jump_Fall_Arc") {
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::GAP_JUMP_LANDING,
+                                          m_avatar->GetState().direction);
+          } else if (current_state.state == Avatar_Component::WALL_JUMP_FALLING ||
+                       current_state.state == Avatar_Component::WALL_JUMP_FALL_ARC) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Wall_Jump_Landing",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::WALL_JUMP_LANDING,
+                                          m_avatar->GetState().direction);
           }
         }
 
-        if (m_avatar->GetState().direction == "Right") {
+        if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
           Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
         } else {
           Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
@@ -742,52 +614,40 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
         has_state_changed = true;
       } else if (Avatar_Helper::IsAvatarFloorAdjacent(m_avatar,
                                                       adjacent_tiles,
-                                                      &m_floor_tiles)) {
+                                                      m_tiles)) {
         if ((*m_y_fallen) < m_safe_falling_limit) {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Falling",
-                                        "Down_Facing_Falling_To_Death",
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_FALLING,
+                                        Avatar_Component::DOWN_FACING_FALLING_TO_DEATH,
+                                        m_avatar->GetState().direction);
         } else {
-          if (current_state.state == "Vertical_Jump_Arc") {
+          if (current_state.state == Avatar_Component::VERTICAL_JUMP_ARC) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Vertical_Jump_Landing",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
-          } else if (current_state.state == "Gap_Jump_Arc_Fall" ||
-                     current_state.state == "Gap_Jump_Falling") {
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::VERTICAL_JUMP_LANDING,
+                                          m_avatar->GetState().direction);
+          } else if (current_state.state == Avatar_Component::GAP_JUMP_ARC_FALL ||
+                     current_state.state == Avatar_Component::GAP_JUMP_FALLING) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Gap_Jump_Landing",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
-          } else if (current_state.state == "Wall_Jump_Falling" ||
-                     current_state.state == "Wall_Jump_Rising" ||
-                     current_state.state == "Wall_Jump_Rise_Arc" ||
-                     current_state.state == "Wall_Jump_Fall_Arc") {
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::GAP_JUMP_LANDING,
+                                          m_avatar->GetState().direction);
+          } else if (current_state.state == Avatar_Component::WALL_JUMP_FALLING ||
+                     current_state.state == Avatar_Component::WALL_JUMP_RISING ||
+                     current_state.state == Avatar_Component::WALL_JUMP_RISE_ARC ||
+                     current_state.state == Avatar_Component::WALL_JUMP_FALL_ARC) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Wall_Jump_Landing",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::WALL_JUMP_LANDING,
+                                          m_avatar->GetState().direction);
           }
         }
 
@@ -804,34 +664,31 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
     }
 
     // Check to see if the avatar is in range to grab a ledge
-    if (current_state.state == "Vertical_Jump_Takeoff" ||
-        current_state.state == "Vertical_Jump_Arc" ||
-        current_state.state == "Vertical_Jump_Landing" ||
-        current_state.state == "Gap_Jump_Takeoff" ||
-        current_state.state == "Gap_Jump_Arc_Rise" ||
-        current_state.state == "Gap_Jump_Arc_Fall" ||
-        current_state.state == "Gap_Jump_Falling" ||
-        current_state.state == "Wall_Jump_Takeoff" ||
-        current_state.state == "Wall_Jump_Rise_Arc" ||
-        current_state.state == "Wall_Jump_Fall_Arc" ||
-        current_state.state == "Wall_Jump_Rising" ||
-        current_state.state == "Wall_Jump_Falling") {
+    if (current_state.state == Avatar_Component::VERTICAL_JUMP_TAKEOFF ||
+        current_state.state == Avatar_Component::VERTICAL_JUMP_ARC ||
+        current_state.state == Avatar_Component::VERTICAL_JUMP_LANDING ||
+        current_state.state == Avatar_Component::GAP_JUMP_TAKEOFF ||
+        current_state.state == Avatar_Component::GAP_JUMP_ARC_RISE ||
+        current_state.state == Avatar_Component::GAP_JUMP_ARC_FALL ||
+        current_state.state == Avatar_Component::GAP_JUMP_FALLING ||
+        current_state.state == Avatar_Component::WALL_JUMP_TAKEOFF ||
+        current_state.state == Avatar_Component::WALL_JUMP_RISE_ARC ||
+        current_state.state == Avatar_Component::WALL_JUMP_FALL_ARC ||
+        current_state.state == Avatar_Component::WALL_JUMP_RISING ||
+        current_state.state == Avatar_Component::WALL_JUMP_FALLING) {
       vector<Avatar_Helper::Tile_Collision> *out_colliding_floor_tiles = new vector<Avatar_Helper::Tile_Collision>();
-      bool can_avatar_grab_a_ledge = Avatar_Helper::CanAvatarGrabALedge(m_avatar, out_colliding_floor_tiles, &m_ledge_tiles);
+      bool can_avatar_grab_a_ledge = Avatar_Helper::CanAvatarGrabALedge(m_avatar, out_colliding_floor_tiles, m_tiles);
       if (can_avatar_grab_a_ledge) {
-          if (current_state.state == "Wall_Jump_Rise_Arc" ||
-              current_state.state == "Wall_Jump_Fall_Arc" ||
-              current_state.state == "Wall_Jump_Rising" ||
-              current_state.state == "Wall_Jump_Falling") {
+          if (current_state.state == Avatar_Component::WALL_JUMP_RISE_ARC ||
+              current_state.state == Avatar_Component::WALL_JUMP_FALL_ARC ||
+              current_state.state == Avatar_Component::WALL_JUMP_RISING ||
+              current_state.state == Avatar_Component::WALL_JUMP_FALLING) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Climbing",
-                                          "Ascending_To_Grabbing",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_CLIMBING,
+                                          Avatar_Component::ASCENDING_TO_GRABBING,
+                                          m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastLedgeEdge(m_avatar,
                                                     *(out_colliding_floor_tiles->begin()));
             *m_currently_grabbed_tile = out_colliding_floor_tiles->begin()->colliding_tile;
@@ -841,13 +698,10 @@ void Charlie_Jumping_Controller::Run_Avatar_State() {
           } else {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Climbing",
-                                          "Pop_Up",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_CLIMBING,
+                                          Avatar_Component::POP_UP,
+                                          m_avatar->GetState().direction);
             Avatar_Helper::AlignAvatarOnLastLedgeEdge(m_avatar,
                                                     *(out_colliding_floor_tiles->begin()));
             *m_currently_grabbed_tile = out_colliding_floor_tiles->begin()->colliding_tile;
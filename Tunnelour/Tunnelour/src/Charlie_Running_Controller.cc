@@ -59,6 +59,59 @@ Charlie_Running_Controller::~Charlie_Running_Controller() {
 //------------------------------------------------------------------------------
 bool Charlie_Running_Controller::Init(Component_Composite *const model) {
   Avatar_State_Controller::Init(model);
+
+  // Bouncing off a wall moves through its stages as each animation
+  // finishes, pushed back from the wall on the way up.
+  Avatar_State_Transitions::Alignment leading_bottom = Avatar_State_Transitions::ALIGN_ON_LAST_LEADING_BOTTOM;
+  m_transitions.AddFrameComplete(Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF,
+                                 Avatar_Component::CHARLIE_RUNNING,
+                                 Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_ARC,
+                                 leading_bottom);
+  m_transitions.AddFrameComplete(Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_ARC,
+                                 Avatar_Component::CHARLIE_RUNNING,
+                                 Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_FALLING,
+                                 leading_bottom);
+  m_transitions.AddFrameComplete(Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_FALLING,
+                                 Avatar_Component::CHARLIE_RUNNING,
+                                 Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING,
+                                 leading_bottom);
+  m_transitions.AddFrameComplete(Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF,
+                                 Avatar_Component::CHARLIE_RUNNING,
+                                 Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_ARC,
+                                 leading_bottom);
+  m_transitions.AddFrameComplete(Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_ARC,
+                                 Avatar_Component::CHARLIE_RUNNING,
+                                 Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_FALLING,
+                                 leading_bottom);
+  m_transitions.AddFrameComplete(Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_FALLING,
+                                 Avatar_Component::CHARLIE_RUNNING,
+                                 Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_LANDING,
+                                 leading_bottom);
+  m_transitions.SetEnterHook(Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_ARC,
+                             Avatar_State_Transitions::State_Hook(-m_wall_colliding_mid_x_initial_velocity,
+                                                                  m_wall_colliding_mid_y_initial_velocity));
+  m_transitions.SetEnterHook(Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING,
+                             Avatar_State_Transitions::State_Hook(0, 0));
+  m_transitions.SetEnterHook(Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_ARC,
+                             Avatar_State_Transitions::State_Hook(-m_wall_colliding_high_x_initial_velocity,
+                                                                  m_wall_colliding_high_y_initial_velocity));
+  m_transitions.SetEnterHook(Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_FALLING,
+                             Avatar_State_Transitions::State_Hook(-m_wall_colliding_high_x_initial_velocity,
+                                                                  m_wall_colliding_high_y_initial_velocity));
+  m_transitions.SetEnterHook(Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_LANDING,
+                             Avatar_State_Transitions::State_Hook(0, 0));
+
+  // Getting up to speed
+  m_transitions.AddFrameComplete(Avatar_Component::STANDING_TO_RUNNING,
+                                 Avatar_Component::CHARLIE_RUNNING,
+                                 Avatar_Component::RUNNING,
+                                 Avatar_State_Transitions::ALIGN_ON_LAST_CONTACTING_FOOT);
+  m_transitions.AddFrameComplete(Avatar_Component::SLOW_RUNNING,
+                                 Avatar_Component::CHARLIE_RUNNING,
+                                 Avatar_Component::RUNNING,
+                                 Avatar_State_Transitions::ALIGN_ON_LAST_CONTACTING_FOOT);
+  m_transitions.Compile();
+
   m_has_been_initialised = true;
   return true;
 }
@@ -73,8 +126,8 @@ void Charlie_Running_Controller::Run_Avatar_State() {
 
   // Look into removing this, the velocity doesen't need to be set every time
   // this state controller is set.
-  if (current_state.state == "Running" && current_state == last_state) {
-    if (current_state.direction == "Right") {
+  if (current_state.state == Avatar_Component::RUNNING && current_state == last_state) {
+    if (current_state.direction == Avatar_Component::RIGHT) {
       m_avatar->SetVelocity(D3DXVECTOR3(m_takeoff_running_x_velocity, 0, 0));
     } else {  // Left
       m_avatar->SetVelocity(D3DXVECTOR3(m_takeoff_running_x_velocity * -1, 0, 0));
@@ -82,58 +135,58 @@ void Charlie_Running_Controller::Run_Avatar_State() {
     if (((*m_distance_traveled) > m_takeoff_running_x_distance) ||
           (*m_is_moving_continuously)) {
       (*m_is_moving_continuously) = true;
-      if (current_state.direction == "Right") {
+      if (current_state.direction == Avatar_Component::RIGHT) {
         m_avatar->SetVelocity(D3DXVECTOR3(m_running_x_velocity, 0, 0));
       } else {  // Left
         m_avatar->SetVelocity(D3DXVECTOR3(m_running_x_velocity * -1, 0, 0));
       }
     }
-  } else if (current_state.state == "Stopping" ||
-             current_state.state == "False_Start")  {
-    if (current_state.direction == "Right") {
+  } else if (current_state.state == Avatar_Component::STOPPING ||
+             current_state.state == Avatar_Component::FALSE_START)  {
+    if (current_state.direction == Avatar_Component::RIGHT) {
       float new_x_velocity = m_avatar->GetVelocity().x - ceil(m_avatar->GetVelocity().x/2);
       m_avatar->SetVelocity(D3DXVECTOR3(new_x_velocity, 0, 0));
     } else {  // Left
       float new_x_velocity = m_avatar->GetVelocity().x + ceil((m_avatar->GetVelocity().x * -1)/2);
       m_avatar->SetVelocity(D3DXVECTOR3(new_x_velocity, 0, 0));
     }
-  } else if (current_state.state == "Wall_Colliding")  {
+  } else if (current_state.state == Avatar_Component::WALL_COLLIDING)  {
      m_avatar->SetVelocity(D3DXVECTOR3(0, 0 , 0));
-  } else if (current_state.state == "Standing_To_Running") {
+  } else if (current_state.state == Avatar_Component::STANDING_TO_RUNNING) {
     m_avatar->SetVelocity(D3DXVECTOR3(0, 0 , 0));
   }
 
   if (((current_state.state != current_command.state) || current_state.direction != current_command.direction) &&
        // The states listed below can be canceled with a different
        // direction or command.
-       (current_state.state != "Stopping" || current_state.state_index == (m_current_animation_subset->number_of_frames -1)) &&
-       (current_state.state != "False_Start" || current_state.state_index == (m_current_animation_subset->number_of_frames -1)) &&
-        current_state.state != "Wall_Colliding_From_Mid_Speed_Arc"  &&
-        current_state.state != "Wall_Colliding_From_Mid_Speed_Falling"  &&
-       (current_state.state != "Wall_Colliding_From_Mid_Speed_Landing" || current_state.state_index == (m_current_animation_subset->number_of_frames -1)) &&
-        current_state.state != "Wall_Colliding_From_High_Speed_Arc" &&
-        current_state.state != "Wall_Colliding_From_High_Speed_Falling"  &&
-       (current_state.state != "Wall_Colliding_From_High_Speed_Landing" || current_state.state_index == (m_current_animation_subset->number_of_frames -1)) &&
-        current_state.state != "Standing_To_Running") {
+       (current_state.state != Avatar_Component::STOPPING || current_state.state_index == (GetCurrentAnimationSubset().number_of_frames -1)) &&
+       (current_state.state != Avatar_Component::FALSE_START || current_state.state_index == (GetCurrentAnimationSubset().number_of_frames -1)) &&
+        current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_ARC  &&
+        current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_FALLING  &&
+       (current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING || current_state.state_index == (GetCurrentAnimationSubset().number_of_frames -1)) &&
+        current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_ARC &&
+        current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_FALLING  &&
+       (current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_LANDING || current_state.state_index == (GetCurrentAnimationSubset().number_of_frames -1)) &&
+        current_state.state != Avatar_Component::STANDING_TO_RUNNING) {
     // Ignore these commands
-    if (current_command.state == "Down" ||
-        current_command.state == "Looking" ) {
-      current_command.state = "";
+    if (current_command.state == Avatar_Component::DOWN ||
+        current_command.state == Avatar_Component::LOOKING ) {
+      current_command.state = Avatar_Component::NO_STATE;
     }
 
-    if (current_command.state == "Jumping") {
-      if (current_state.state == "Wall_Colliding_From_Mid_Speed_Takeoff" ||
-          current_state.state == "Wall_Colliding_From_High_Speed_Takeoff" ){
+    if (current_command.state == Avatar_Component::JUMPING) {
+      if (current_state.state == Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF ||
+          current_state.state == Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF ){
         if (current_state.state_index == 0 || current_state.state_index == 1) {
             float y_velocity = m_wall_jump_y_initial_velocity;
-            if (last_state.parent_state == "Charlie_Jumping") {
+            if (last_state.parent_state == Avatar_Component::CHARLIE_JUMPING) {
                 y_velocity += m_avatar->GetVelocity().y;
             } else {
                 y_velocity += m_vertical_jump_y_initial_velocity;
             }
 
             float x_velocity = m_vertical_jump_x_initial_velocity;
-            if (current_state.direction == "Left") {
+            if (current_state.direction == Avatar_Component::LEFT) {
               x_velocity = (x_velocity * -1);
             }
 
@@ -141,52 +194,43 @@ void Charlie_Running_Controller::Run_Avatar_State() {
 
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Wall_Jump_Takeoff",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::WALL_JUMP_TAKEOFF,
+                                          m_avatar->GetState().direction);
             Avatar_Helper::MoveAvatarTileAdjacent(m_avatar,
                                                   m_adjacent_wall->collision_side,
                                                   m_adjacent_wall->colliding_tile);
 
             has_state_changed = true;
           }
-      } else if (current_state.state == "Wall_Colliding") {
+      } else if (current_state.state == Avatar_Component::WALL_COLLIDING) {
         float y_velocity = m_vertical_jump_y_initial_velocity;
         float x_velocity = m_vertical_jump_x_initial_velocity;
-        if (current_state.direction == "Left") {
+        if (current_state.direction == Avatar_Component::LEFT) {
           x_velocity = (x_velocity * -1);
         }
 
         m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
 
-        if (current_command.direction == "Right" ||
-              current_command.direction == "Left" ) {
+        if (current_command.direction == Avatar_Component::RIGHT ||
+              current_command.direction == Avatar_Component::LEFT ) {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Jumping",
-                                        "Wall_Jump_Takeoff",
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_JUMPING,
+                                        Avatar_Component::WALL_JUMP_TAKEOFF,
+                                        m_avatar->GetState().direction);
         } else {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Jumping",
-                                        "Wall_Jump_Takeoff",
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_JUMPING,
+                                        Avatar_Component::WALL_JUMP_TAKEOFF,
+                                        m_avatar->GetState().direction);
         }
 
-        if (current_command.direction == "Right") {
+        if (current_command.direction == Avatar_Component::RIGHT) {
           Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
         } else {
           Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
@@ -194,24 +238,21 @@ void Charlie_Running_Controller::Run_Avatar_State() {
         has_state_changed = true;
       } else {
        if (current_command.direction != current_state.direction &&
-           current_state.state != "Wall_Colliding_From_Mid_Speed_Takeoff" &&
-           current_state.state != "Wall_Colliding_From_High_Speed_Takeoff" &&
-           current_state.state != "Stopping") {
+           current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF &&
+           current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF &&
+           current_state.state != Avatar_Component::STOPPING) {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Stopping",
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_RUNNING,
+                                        Avatar_Component::STOPPING,
+                                        m_avatar->GetState().direction);
           Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
           has_state_changed = true;
           (*m_distance_traveled) = 0;
         } else {
-          string direction;
-          if (current_command.direction == "") {
+          Avatar_Component::Direction direction;
+          if (current_command.direction == Avatar_Component::NO_DIRECTION) {
             direction = m_avatar->GetState().direction;
           } else {
             direction = current_command.direction;
@@ -235,7 +276,7 @@ void Charlie_Running_Controller::Run_Avatar_State() {
             y_velocity = m_takeoff_gap_jump_y_initial_velocity;
           }
 
-          if (direction == "Left") {
+          if (direction == Avatar_Component::LEFT) {
             x_velocity = (x_velocity * -1);
           }
 
@@ -243,166 +284,130 @@ void Charlie_Running_Controller::Run_Avatar_State() {
 
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Jumping",
-                                        "Gap_Jump_Takeoff",
-                                        direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_JUMPING,
+                                        Avatar_Component::GAP_JUMP_TAKEOFF,
+                                        direction);
           Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
           has_state_changed = true;
         }
       }
-    } else if (current_command.state == "") {
-      if (current_state.state != "Wall_Colliding_From_Mid_Speed_Takeoff" &&
-          current_state.state != "Wall_Colliding_From_High_Speed_Takeoff") {
-        if (current_state.state == "Standing_To_Running" ||
-           (current_state.state == "Running" && current_state.state_index == 0)) {
+    } else if (current_command.state == Avatar_Component::NO_STATE) {
+      if (current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF &&
+          current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF) {
+        if (current_state.state == Avatar_Component::STANDING_TO_RUNNING ||
+           (current_state.state == Avatar_Component::RUNNING && current_state.state_index == 0)) {
            Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "False_Start",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-        } else if (current_state.state == "False_Start" ||
-                   current_state.state == "Wall_Colliding_From_Mid_Speed_Landing" ||
-                   current_state.state == "Stopping" ) {
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_RUNNING,
+                                        Avatar_Component::FALSE_START,
+                                        current_state.direction);
+        } else if (current_state.state == Avatar_Component::FALSE_START ||
+                   current_state.state == Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING ||
+                   current_state.state == Avatar_Component::STOPPING ) {
            Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Standing",
-                                        "Standing",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_STANDING,
+                                        Avatar_Component::STANDING,
+                                        current_state.direction);
        } else {
            Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Stopping",
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_RUNNING,
+                                        Avatar_Component::STOPPING,
+                                        m_avatar->GetState().direction);
        }
         Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
         has_state_changed = true;
       }
-    } else if (current_state.state == "Wall_Colliding") {
-      if (current_command.state == "Running") {
+    } else if (current_state.state == Avatar_Component::WALL_COLLIDING) {
+      if (current_command.state == Avatar_Component::RUNNING) {
         if (current_command.direction != current_state.direction) {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Standing_To_Running",
-                                        current_command.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_RUNNING,
+                                        Avatar_Component::STANDING_TO_RUNNING,
+                                        current_command.direction);
           has_state_changed = true;
           Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
           (*m_distance_traveled) = 0;
         }
       } else {
-        if (current_command.direction == "Right" ||
-              current_command.direction == "Left") {
+        if (current_command.direction == Avatar_Component::RIGHT ||
+              current_command.direction == Avatar_Component::LEFT) {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_" + current_command.state,
+                                        m_animation_library,
+                                        Avatar_State_Names::GetInstance()->GetParentStateID(current_command.state),
                                         current_command.state,
-                                        current_command.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        current_command.direction);
         } else {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_" + current_command.state,
+                                        m_animation_library,
+                                        Avatar_State_Names::GetInstance()->GetParentStateID(current_command.state),
                                         current_command.state,
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_avatar->GetState().direction);
         }
         has_state_changed = true;
         Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
       }
-    } else if (current_command.state == "Running") {
-      if (current_state.state != "Wall_Colliding_From_Mid_Speed_Takeoff" &&
-            current_state.state != "Wall_Colliding_From_High_Speed_Takeoff") {
-        if (current_state.state != "Standing_To_Running" &&
-             (current_state.state == "Running" && current_state.state_index)) {
+    } else if (current_command.state == Avatar_Component::RUNNING) {
+      if (current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF &&
+            current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF) {
+        if (current_state.state != Avatar_Component::STANDING_TO_RUNNING &&
+             (current_state.state == Avatar_Component::RUNNING && current_state.state_index)) {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Stopping",
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_RUNNING,
+                                        Avatar_Component::STOPPING,
+                                        m_avatar->GetState().direction);
         } else {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Standing",
-                                        "Standing",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_STANDING,
+                                        Avatar_Component::STANDING,
+                                        current_state.direction);
         }
         Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
         (*m_is_moving_continuously) = false;
         has_state_changed = true;
       }
     } else {
-      if (current_state.state != "Wall_Colliding_From_Mid_Speed_Takeoff" &&
-            current_state.state != "Wall_Colliding_From_High_Speed_Takeoff") {
+      if (current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF &&
+            current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF) {
         if (current_command.direction != current_state.direction) {
-          if (current_state.state != "Standing_To_Running" &&
-                current_state.state != "Stopping") {
+          if (current_state.state != Avatar_Component::STANDING_TO_RUNNING &&
+                current_state.state != Avatar_Component::STOPPING) {
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Running",
-                                          "Stopping",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_RUNNING,
+                                          Avatar_Component::STOPPING,
+                                          m_avatar->GetState().direction);
           } else {
-            if (current_command.direction == "Right" ||
-                  current_command.direction == "Left" ) {
+            if (current_command.direction == Avatar_Component::RIGHT ||
+                  current_command.direction == Avatar_Component::LEFT ) {
               Avatar_Helper::SetAvatarState(m_avatar,
                                             m_game_settings->GetTilesetPath(),
-                                            m_animation_metadata,
-                                            "Charlie_" + current_command.state,
+                                            m_animation_library,
+                                            Avatar_State_Names::GetInstance()->GetParentStateID(current_command.state),
                                             current_command.state,
-                                            current_command.direction,
-                                            m_current_metadata_file_path,
-                                            m_current_metadata,
-                                            m_current_animation_subset);
+                                            current_command.direction);
               m_avatar->SetVelocity(D3DXVECTOR3(0, 0, 0));
             } else {
               Avatar_Helper::SetAvatarState(m_avatar,
                                             m_game_settings->GetTilesetPath(),
-                                            m_animation_metadata,
-                                            "Charlie_" + current_command.state,
+                                            m_animation_library,
+                                            Avatar_State_Names::GetInstance()->GetParentStateID(current_command.state),
                                             current_command.state,
-                                            m_avatar->GetState().direction,
-                                            m_current_metadata_file_path,
-                                            m_current_metadata,
-                                            m_current_animation_subset);
+                                            m_avatar->GetState().direction);
               m_avatar->SetVelocity(D3DXVECTOR3(0, 0, 0));
             }
             has_state_changed = true;
@@ -416,135 +421,16 @@ void Charlie_Running_Controller::Run_Avatar_State() {
   if (!has_state_changed) {
     unsigned int state_index = current_state.state_index;
     state_index++;
-    if (state_index > (m_current_animation_subset->number_of_frames - 1)) {
-      if (m_current_animation_subset->is_repeatable) {
+    if (state_index > (GetCurrentAnimationSubset().number_of_frames - 1)) {
+      if (GetCurrentAnimationSubset().is_repeatable) {
         state_index = 0;
       } else {
-        if (current_state.state == "Wall_Colliding_From_Mid_Speed_Takeoff") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Wall_Colliding_From_Mid_Speed_Arc",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Align_New_Avatar_State();
-          D3DXVECTOR3 velocity = D3DXVECTOR3(0, 0, 0);
-          velocity.y = m_wall_colliding_mid_y_initial_velocity;
-          velocity.x = m_wall_colliding_mid_x_initial_velocity;
-          if (current_state.direction == "Right") {
-             velocity.x *= -1;
-          }
-          m_avatar->SetVelocity(velocity);
-          has_state_changed = true;
-        } else if (current_state.state == "Wall_Colliding_From_Mid_Speed_Arc") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Wall_Colliding_From_Mid_Speed_Falling",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Align_New_Avatar_State();
-          has_state_changed = true;
-        } else if (current_state.state == "Wall_Colliding_From_Mid_Speed_Falling") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Wall_Colliding_From_Mid_Speed_Landing",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Align_New_Avatar_State();
-          D3DXVECTOR3 velocity = D3DXVECTOR3(0, 0, 0);
-          m_avatar->SetVelocity(velocity);
-          has_state_changed = true;
-        } else if (current_state.state == "Wall_Colliding_From_High_Speed_Takeoff") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Wall_Colliding_From_High_Speed_Arc",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Align_New_Avatar_State();
-          D3DXVECTOR3 velocity = D3DXVECTOR3(0, 0, 0);
-          velocity.y = m_wall_colliding_high_y_initial_velocity;
-          velocity.x = m_wall_colliding_high_x_initial_velocity;
-          if (current_state.direction == "Right") {
-             velocity.x *= -1;
-          }
-          m_avatar->SetVelocity(velocity);
-          has_state_changed = true;
-        } else if (current_state.state == "Wall_Colliding_From_High_Speed_Arc") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Wall_Colliding_From_High_Speed_Falling",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Align_New_Avatar_State();
-          D3DXVECTOR3 velocity = D3DXVECTOR3(0, 0, 0);
-          velocity.y = m_wall_colliding_high_y_initial_velocity;
-          velocity.x = m_wall_colliding_high_x_initial_velocity;
-          if (current_state.direction == "Right") {
-             velocity.x *= -1;
-          }
-          m_avatar->SetVelocity(velocity);
-          has_state_changed = true;
-        } else if (current_state.state == "Wall_Colliding_From_High_Speed_Falling") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Wall_Colliding_From_High_Speed_Landing",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Align_New_Avatar_State();
-          D3DXVECTOR3 velocity = D3DXVECTOR3(0, 0, 0);
-          m_avatar->SetVelocity(velocity);
-          has_state_changed = true;
-        } else if (current_state.state == "Standing_To_Running") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Running",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
-          has_state_changed = true;
-        } else if (current_state.state == "Slow_Running") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Running",
-                                        current_state.direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
+        if (Run_Avatar_State_Transition(current_command.state, true)) {
           has_state_changed = true;
         } else {
           string error;
           error = "No handling for the non-repeating animation: ";
-          error += current_command.state;
+          error += Avatar_State_Names::GetInstance()->GetStateName(current_command.state);
           throw Exceptions::init_error(error);
         }
       }
@@ -554,25 +440,22 @@ void Charlie_Running_Controller::Run_Avatar_State() {
       if (current_state == last_state) {
         Avatar_Helper::SetAvatarStateAnimationFrame(m_avatar,
                                                     state_index,
-                                                    m_current_animation_subset);
-        if (current_state.state == "Wall_Colliding_From_Mid_Speed_Takeoff" ||
-            current_state.state == "Wall_Colliding_From_Mid_Speed_Landing" ||
-            current_state.state == "Wall_Colliding_From_High_Speed_Takeoff" ||
-            current_state.state == "Wall_Colliding_From_High_Speed_Landing" ||
-            current_state.state == "Standing_To_Running") {
+                                                    m_animation_library);
+        if (current_state.state == Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF ||
+            current_state.state == Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING ||
+            current_state.state == Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF ||
+            current_state.state == Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_LANDING ||
+            current_state.state == Avatar_Component::STANDING_TO_RUNNING) {
           Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
         } else {
           Align_New_Avatar_State();
         }
       }
 
-      if (current_state.state == "Wall_Colliding_From_Mid_Speed_Arc" ||
-          current_state.state == "Wall_Colliding_From_Mid_Speed_Falling" ||
-          current_state.state == "Wall_Colliding_From_High_Speed_Arc" ||
-          current_state.state == "Wall_Colliding_From_High_Speed_Falling") {
-        D3DXVECTOR3 position = *m_avatar->GetPosition();
-        position = *m_avatar->GetPosition();
-
+      if (current_state.state == Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_ARC ||
+          current_state.state == Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_FALLING ||
+          current_state.state == Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_ARC ||
+          current_state.state == Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_FALLING) {
         D3DXVECTOR3 new_velocity = m_avatar->GetVelocity();
         new_velocity.y += m_world_settings->GetGravityInPixPerFrame();
         if (new_velocity.y < m_world_settings->GetMaxVelocityInPixPerFrame()) {
@@ -580,17 +463,14 @@ void Charlie_Running_Controller::Run_Avatar_State() {
         }
 
         m_avatar->SetVelocity(new_velocity);
-        position += new_velocity;
+        m_avatar->MoveFixedPosition(m_avatar->GetFixedVelocity());
         (*m_y_fallen) += m_avatar->GetVelocity().y;
-        m_avatar->SetPosition(position);
-      } else if (current_state.state != "Wall_Colliding_From_Mid_Speed_Takeoff" ||
-                 current_state.state != "Wall_Colliding_From_High_Speed_Takeoff" ||
-                 current_state.state != "Wall_Colliding_From_Mid_Speed_Landing" ||
-                 current_state.state != "Wall_Colliding_From_High_Speed_Landing") {
-        D3DXVECTOR3 position = *m_avatar->GetPosition();
+      } else if (current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF ||
+                 current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF ||
+                 current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING ||
+                 current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_LANDING) {
         D3DXVECTOR3 velocity = m_avatar->GetVelocity();
-        position += velocity;
-        m_avatar->SetPosition(position);
+        m_avatar->MoveFixedPosition(m_avatar->GetFixedVelocity());
         if (velocity.x < 0) {
           (*m_distance_traveled) += (velocity.x * -1.0f);
         } else {
@@ -600,94 +480,79 @@ void Charlie_Running_Controller::Run_Avatar_State() {
 
       // Detect if the avatar is intersecting with a wall
       vector<Avatar_Helper::Tile_Collision> *out_colliding_wall_tiles = new vector<Avatar_Helper::Tile_Collision>();
-      if (Avatar_Helper::IsAvatarWallColliding(m_avatar, out_colliding_wall_tiles, &m_wall_tiles)) {
+      if (Avatar_Helper::IsAvatarWallColliding(m_avatar, out_colliding_wall_tiles, m_tiles)) {
         if (m_adjacent_wall == 0) {
           m_adjacent_wall = new Avatar_Helper::Tile_Collision();  
         } 
         *m_adjacent_wall = *(out_colliding_wall_tiles->begin());
           
-        if (current_state.state != "Wall_Colliding" && last_state.state != "Wall_Colliding") {
-          if  (current_state.state != "Stopping" &&
-               last_state.state != "Stopping" &&
-               current_state.state != "Wall_Colliding_From_Mid_Speed_Takeoff" &&
-               last_state.state != "Wall_Colliding_From_Mid_Speed_Takeoff" &&
-               current_state.state != "Wall_Colliding_From_Mid_Speed_Arc" &&
-               last_state.state != "Wall_Colliding_From_Mid_Speed_Arc" &&
-               current_state.state != "Wall_Colliding_From_Mid_Speed_Falling" &&
-               last_state.state != "Wall_Colliding_From_Mid_Speed_Falling" &&
-               current_state.state != "Wall_Colliding_From_Mid_Speed_Landing" &&
-               last_state.state != "Wall_Colliding_From_Mid_Speed_Landing" &&
-               current_state.state != "Wall_Colliding_From_High_Speed_Takeoff" &&
-               last_state.state != "Wall_Colliding_From_High_Speed_Takeoff" &&
-               current_state.state != "Wall_Colliding_From_High_Speed_Arc" &&
-               last_state.state != "Wall_Colliding_From_High_Speed_Arc" &&
-               current_state.state != "Wall_Colliding_From_High_Speed_Falling" &&
-               last_state.state != "Wall_Colliding_From_High_Speed_Falling" &&
-               current_state.state != "Wall_Colliding_From_High_Speed_Landing" &&
-               last_state.state != "Wall_Colliding_From_High_Speed_Landing") {
+        if (current_state.state != Avatar_Component::WALL_COLLIDING && last_state.state != Avatar_Component::WALL_COLLIDING) {
+          if  (current_state.state != Avatar_Component::STOPPING &&
+               last_state.state != Avatar_Component::STOPPING &&
+               current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF &&
+               last_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF &&
+               current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_ARC &&
+               last_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_ARC &&
+               current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_FALLING &&
+               last_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_FALLING &&
+               current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING &&
+               last_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING &&
+               current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF &&
+               last_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF &&
+               current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_ARC &&
+               last_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_ARC &&
+               current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_FALLING &&
+               last_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_FALLING &&
+               current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_LANDING &&
+               last_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_LANDING) {
             // Check to see if we need to move the avatar back to adjacent
             std::vector<Tile_Bitmap*> *adjacent_tile = new std::vector<Tile_Bitmap*>();
-            Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tile, &m_floor_tiles);
-            if (out_colliding_wall_tiles->begin()->collision_side != current_state.direction) {
-              if (current_state.state == "Standing_To_Running") {
+            Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tile, m_tiles);
+            if (out_colliding_wall_tiles->begin()->collision_side != Avatar_State_Names::GetDirectionName(current_state.direction)) {
+              if (current_state.state == Avatar_Component::STANDING_TO_RUNNING) {
                 Avatar_Helper::SetAvatarState(m_avatar,
                                               m_game_settings->GetTilesetPath(),
-                                              m_animation_metadata,
-                                              "Charlie_Running",
-                                              "Wall_Colliding",
-                                              m_avatar->GetState().direction,
-                                              m_current_metadata_file_path,
-                                              m_current_metadata,
-                                              m_current_animation_subset);
+                                              m_animation_library,
+                                              Avatar_Component::CHARLIE_RUNNING,
+                                              Avatar_Component::WALL_COLLIDING,
+                                              m_avatar->GetState().direction);
                 m_avatar->SetVelocity(D3DXVECTOR3(0, 0, 0));
               } else {
                  if ((*m_distance_traveled) <= m_stopping_from_running_distance) {
                    Avatar_Helper::SetAvatarState(m_avatar,
                                                  m_game_settings->GetTilesetPath(),
-                                                 m_animation_metadata,
-                                                 "Charlie_Running",
-                                                 "Stopping",
-                                                 m_avatar->GetState().direction,
-                                                 m_current_metadata_file_path,
-                                                 m_current_metadata,
-                                                 m_current_animation_subset);
+                                                 m_animation_library,
+                                                 Avatar_Component::CHARLIE_RUNNING,
+                                                 Avatar_Component::STOPPING,
+                                                 m_avatar->GetState().direction);
                    m_avatar->SetVelocity(D3DXVECTOR3(0, 0, 0));
                  } else if (((*m_distance_traveled) <= m_wall_colliding_mid_distance ||
-                               last_state.state == "Gap_Jump_Landing") && 
-                              (last_state.state != "Wall_Colliding_From_Mid_Speed_Landing")) { 
+                               last_state.state == Avatar_Component::GAP_JUMP_LANDING) && 
+                              (last_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING)) { 
                    Avatar_Helper::SetAvatarState(m_avatar,
                                                  m_game_settings->GetTilesetPath(),
-                                                 m_animation_metadata,
-                                                 "Charlie_Running",
-                                                 "Wall_Colliding_From_Mid_Speed_Takeoff",
-                                                 m_avatar->GetState().direction,
-                                                 m_current_metadata_file_path,
-                                                 m_current_metadata,
-                                                 m_current_animation_subset);
+                                                 m_animation_library,
+                                                 Avatar_Component::CHARLIE_RUNNING,
+                                                 Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF,
+                                                 m_avatar->GetState().direction);
                     m_avatar->SetVelocity(D3DXVECTOR3(0, 0, 0));
                   } else if ((m_avatar->GetVelocity().x == m_running_x_velocity ||
                            m_avatar->GetVelocity().x == m_running_x_velocity * -1) && 
-                          (last_state.state != "Wall_Colliding_From_High_Speed_Landing")) { 
+                          (last_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_LANDING)) { 
                      Avatar_Helper::SetAvatarState(m_avatar,
                                                    m_game_settings->GetTilesetPath(),
-                                                   m_animation_metadata,
-                                                   "Charlie_Running",
-                                                   "Wall_Colliding_From_High_Speed_Takeoff",
-                                                   m_avatar->GetState().direction,
-                                                   m_current_metadata_file_path,
-                                                   m_current_metadata,
-                                                   m_current_animation_subset);
+                                                   m_animation_library,
+                                                   Avatar_Component::CHARLIE_RUNNING,
+                                                   Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF,
+                                                   m_avatar->GetState().direction);
                      m_avatar->SetVelocity(D3DXVECTOR3(0, 0, 0));
                    } else {
                      Avatar_Helper::SetAvatarState(m_avatar,
                                                    m_game_settings->GetTilesetPath(),
-                                                   m_animation_metadata,
-                                                   "Charlie_Running",
-                                                   "Wall_Colliding",
-                                                   m_avatar->GetState().direction,
-                                                   m_current_metadata_file_path,
-                                                   m_current_metadata,
-                                                   m_current_animation_subset);
+                                                   m_animation_library,
+                                                   Avatar_Component::CHARLIE_RUNNING,
+                                                   Avatar_Component::WALL_COLLIDING,
+                                                   m_avatar->GetState().direction);
                      m_avatar->SetVelocity(D3DXVECTOR3(0, 0, 0));
                    }
               }
@@ -700,20 +565,17 @@ void Charlie_Running_Controller::Run_Avatar_State() {
               (*m_distance_traveled) = 0;
               has_state_changed = true;
             }
-          } else if (current_state.state != "Stopping" && last_state.state == "Stopping") {
-            if (out_colliding_wall_tiles->begin()->collision_side != current_state.direction) {
+          } else if (current_state.state != Avatar_Component::STOPPING && last_state.state == Avatar_Component::STOPPING) {
+            if (out_colliding_wall_tiles->begin()->collision_side != Avatar_State_Names::GetDirectionName(current_state.direction)) {
             // Check to see if we need to move the avatar back to adjacent
             std::vector<Tile_Bitmap*> *adjacent_tile = new std::vector<Tile_Bitmap*>();
-            Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tile, &m_floor_tiles);
+            Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tile, m_tiles);
              Avatar_Helper::SetAvatarState(m_avatar,
                                            m_game_settings->GetTilesetPath(),
-                                           m_animation_metadata,
-                                           "Charlie_Running",
-                                           "Wall_Colliding",
-                                           m_avatar->GetState().direction,
-                                           m_current_metadata_file_path,
-                                           m_current_metadata,
-                                           m_current_animation_subset);
+                                           m_animation_library,
+                                           Avatar_Component::CHARLIE_RUNNING,
+                                           Avatar_Component::WALL_COLLIDING,
+                                           m_avatar->GetState().direction);
               Align_New_Avatar_State(); 
               if (!adjacent_tile->empty()) {
                 Avatar_Helper::MoveAvatarTileAdjacent(m_avatar,
@@ -740,22 +602,22 @@ void Charlie_Running_Controller::Run_Avatar_State() {
 
       // Detect if the avatar is overbalancing from running 
       vector<Tile_Bitmap*> *adjacent_tiles = new vector<Tile_Bitmap*>();
-      if (!Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tiles, &m_floor_tiles) &&
-           current_state.state != "Wall_Colliding_From_Mid_Speed_Takeoff" &&
-           current_state.state != "Wall_Colliding_From_Mid_Speed_Arc" &&
-           current_state.state != "Wall_Colliding_From_Mid_Speed_Falling" &&
-           current_state.state != "Wall_Colliding_From_Mid_Speed_Landing" &&
-           current_state.state != "Wall_Colliding_From_High_Speed_Takeoff" &&
-           current_state.state != "Wall_Colliding_From_High_Speed_Arc" &&
-           current_state.state != "Wall_Colliding_From_High_Speed_Falling" &&
-           current_state.state != "Wall_Colliding_From_High_Speed_Landing") {
+      if (!Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tiles, m_tiles) &&
+           current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_TAKEOFF &&
+           current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_ARC &&
+           current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_FALLING &&
+           current_state.state != Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING &&
+           current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_TAKEOFF &&
+           current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_ARC &&
+           current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_FALLING &&
+           current_state.state != Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_LANDING) {
         if (adjacent_tiles->empty()) {
           // This algorithm puts the avatar BACK on the tile it overbalanced from
           vector<Tile_Bitmap*> *adjacent_tile = new vector<Tile_Bitmap*>();
           int offset = 0;
           bool try_opposite_direction = false;
-          while (!Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tile, &m_floor_tiles)) {
-            if (m_avatar->GetState().direction == "Right") {
+          while (!Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tile, m_tiles)) {
+            if (m_avatar->GetState().direction == Avatar_Component::RIGHT) {
               offset -= 8;
             } else {
               offset += 8;
@@ -765,9 +627,7 @@ void Charlie_Running_Controller::Run_Avatar_State() {
               offset = offset * -1;
             }
 
-            D3DXVECTOR3 position = *m_avatar->GetPosition();
-            position.x += offset;
-            m_avatar->SetPosition(position);
+            m_avatar->MoveFixedPosition(Fixed_Point(offset * Fixed_Pixel_Helper::ONE_PIXEL, 0));
 
             if (offset > 64 || offset < -64) {
               if (!try_opposite_direction) {
@@ -784,25 +644,21 @@ void Charlie_Running_Controller::Run_Avatar_State() {
           adjacent_tiles = adjacent_tile;
         }
 
-        if (current_state.state == "Stopping") {
-          if (current_state.direction == "Right") {
+        if (current_state.state == Avatar_Component::STOPPING) {
+          if (current_state.direction == Avatar_Component::RIGHT) {
             Avatar_Helper::MoveAvatarTileAdjacent(m_avatar,
                                                   "Right",
                                                  *(adjacent_tiles->begin()));
-            Avatar_Component::Avatar_Collision_Block avatar = Avatar_Helper::GetNamedCollisionBlock("Avatar", current_state.avatar_collision_blocks);
-            D3DXVECTOR3 position = *m_avatar->GetPosition();
-            position.x -= avatar.size.x;
-            m_avatar->SetPosition(position);
-          } else  if (current_state.direction == "Left") {
+            Avatar_Component::Avatar_Collision_Block avatar = Avatar_Helper::GetNamedCollisionBlock(Avatar_Component::AVATAR_BLOCK, current_state.avatar_collision_blocks);
+            m_avatar->MoveFixedPosition(Fixed_Point(-Fixed_Pixel_Helper::FromPixels(avatar.size.x), 0));
+          } else  if (current_state.direction == Avatar_Component::LEFT) {
             Avatar_Helper::MoveAvatarTileAdjacent(m_avatar, "Left", *(adjacent_tiles->begin()));
-            Avatar_Component::Avatar_Collision_Block avatar = Avatar_Helper::GetNamedCollisionBlock("Avatar", current_state.avatar_collision_blocks);
-            D3DXVECTOR3 position = *m_avatar->GetPosition();
-            position.x += avatar.size.x;
-            m_avatar->SetPosition(position);
+            Avatar_Component::Avatar_Collision_Block avatar = Avatar_Helper::GetNamedCollisionBlock(Avatar_Component::AVATAR_BLOCK, current_state.avatar_collision_blocks);
+            m_avatar->MoveFixedPosition(Fixed_Point(Fixed_Pixel_Helper::FromPixels(avatar.size.x), 0));
           }
         } else {
           if (m_avatar->GetState().direction == m_avatar->GetLastRenderedState().direction) {
-            if (current_state.direction == "Right") {
+            if (current_state.direction == Avatar_Component::RIGHT) {
               float y_velocity = m_overbalancing_y_velocity;
               float x_velocity = m_overbalancing_x_velocity;
               m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
@@ -814,15 +670,12 @@ void Charlie_Running_Controller::Run_Avatar_State() {
 
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Gap_Jump_Arc_Fall",
-                                          m_avatar->GetState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::GAP_JUMP_ARC_FALL,
+                                          m_avatar->GetState().direction);
           } else {
-            if (current_state.direction == "Right") {
+            if (current_state.direction == Avatar_Component::RIGHT) {
               float y_velocity = m_overbalancing_y_velocity;
               float x_velocity = m_overbalancing_x_velocity;
               m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
@@ -834,13 +687,10 @@ void Charlie_Running_Controller::Run_Avatar_State() {
 
             Avatar_Helper::SetAvatarState(m_avatar,
                                           m_game_settings->GetTilesetPath(),
-                                          m_animation_metadata,
-                                          "Charlie_Jumping",
-                                          "Gap_Jump_Arc_Fall",
-                                          m_avatar->GetLastRenderedState().direction,
-                                          m_current_metadata_file_path,
-                                          m_current_metadata,
-                                          m_current_animation_subset);
+                                          m_animation_library,
+                                          Avatar_Component::CHARLIE_JUMPING,
+                                          Avatar_Component::GAP_JUMP_ARC_FALL,
+                                          m_avatar->GetLastRenderedState().direction);
           }
 
           Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
@@ -854,19 +704,16 @@ void Charlie_Running_Controller::Run_Avatar_State() {
       }
       
       vector<Avatar_Helper::Tile_Collision> *out_colliding_floor_tiles = new vector<Avatar_Helper::Tile_Collision>();
-      bool is_floor_colliding = Avatar_Helper::IsAvatarFloorColliding(m_avatar, out_colliding_floor_tiles, &m_floor_tiles);
+      bool is_floor_colliding = Avatar_Helper::IsAvatarFloorColliding(m_avatar, out_colliding_floor_tiles, m_tiles);
       if (is_floor_colliding) {
-        if (current_state.state == "Wall_Colliding_From_Mid_Speed_Arc" ||
-            current_state.state == "Wall_Colliding_From_Mid_Speed_Falling") {
+        if (current_state.state == Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_ARC ||
+            current_state.state == Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_FALLING) {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Wall_Colliding_From_Mid_Speed_Landing",
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_RUNNING,
+                                        Avatar_Component::WALL_COLLIDING_FROM_MID_SPEED_LANDING,
+                                        m_avatar->GetState().direction);
           Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
           Avatar_Helper::MoveAvatarTileAdjacent(m_avatar,
                                                 "Top",
@@ -874,17 +721,14 @@ void Charlie_Running_Controller::Run_Avatar_State() {
           m_avatar->SetVelocity(D3DXVECTOR3(0, 0, 0));
           (*m_distance_traveled) = 0;
           has_state_changed = true;
-        } else if (current_state.state == "Wall_Colliding_From_High_Speed_Arc" ||
-                   current_state.state == "Wall_Colliding_From_High_Speed_Falling") {
+        } else if (current_state.state == Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_ARC ||
+                   current_state.state == Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_FALLING) {
           Avatar_Helper::SetAvatarState(m_avatar,
                                         m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Running",
-                                        "Wall_Colliding_From_High_Speed_Landing",
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
+                                        m_animation_library,
+                                        Avatar_Component::CHARLIE_RUNNING,
+                                        Avatar_Component::WALL_COLLIDING_FROM_HIGH_SPEED_LANDING,
+                                        m_avatar->GetState().direction);
           Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
           Avatar_Helper::MoveAvatarTileAdjacent(m_avatar,
                                                 "Top",
@@ -914,19 +758,7 @@ void Charlie_Running_Controller::Run_Avatar_State() {
 
 //------------------------------------------------------------------------------
 void Charlie_Running_Controller::Align_New_Avatar_State() {
-  Avatar_Component::Avatar_State current_state = m_avatar->GetState();
-
-  if (m_avatar->GetVelocity().x > 0) {
-    Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
-  } else if (m_avatar->GetVelocity().x < 0) {
-    Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
-  } else if (current_state.direction == "Right") {
-    Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockRightBottom(m_avatar);
-  } else if  (current_state.direction == "Left") {
-    Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeftBottom(m_avatar);
-  } else {
-    Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlock(m_avatar);
-  }
+  Avatar_Helper::AlignAvatarOnLastAvatarCollisionBlockLeadingBottom(m_avatar);
 }
 
 }  // namespace Tunnelour
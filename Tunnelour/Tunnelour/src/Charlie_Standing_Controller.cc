@@ -52,6 +52,52 @@ Charlie_Standing_Controller::~Charlie_Standing_Controller() {
 //------------------------------------------------------------------------------
 bool Charlie_Standing_Controller::Init(Component_Composite *const model) {
   Avatar_State_Controller::Init(model);
+
+  m_transitions.AddFrameComplete(Avatar_Component::INITIAL,
+                                 Avatar_Component::CHARLIE_STANDING,
+                                 Avatar_Component::STANDING,
+                                 Avatar_State_Transitions::ALIGN_ON_LAST_CONTACTING_FOOT);
+
+  // Commands, the avatar is lined up on its foot after any of them
+  Avatar_State_Transitions::Transition transition;
+  transition.parent_state = Avatar_Component::CHARLIE_JUMPING;
+  transition.state = Avatar_Component::VERTICAL_JUMP_TAKEOFF;
+  transition.direction_source = Avatar_State_Transitions::COMMAND_DIRECTION;
+  m_transitions.Add(Avatar_State_Transitions::ANY_STATE,
+                    Avatar_Component::JUMPING,
+                    Avatar_State_Transitions::ANY_CONTACTS,
+                    Avatar_State_Transitions::ANY_FRAME,
+                    transition);
+  m_transitions.SetEnterHook(Avatar_Component::VERTICAL_JUMP_TAKEOFF,
+                             Avatar_State_Transitions::State_Hook(m_vertical_jump_x_initial_velocity,
+                                                                  m_vertical_jump_y_initial_velocity));
+
+  transition.parent_state = Avatar_Component::CHARLIE_RUNNING;
+  transition.state = Avatar_Component::STANDING_TO_RUNNING;
+  transition.direction_source = Avatar_State_Transitions::COMMAND_DIRECTION;
+  m_transitions.Add(Avatar_State_Transitions::ANY_STATE,
+                    Avatar_Component::RUNNING,
+                    Avatar_State_Transitions::ANY_CONTACTS,
+                    Avatar_State_Transitions::ANY_FRAME,
+                    transition);
+
+  transition.parent_state = Avatar_Component::CHARLIE_STANDING;
+  transition.state = Avatar_Component::LOOKING;
+  transition.direction_source = Avatar_State_Transitions::KEEP_DIRECTION;
+  m_transitions.Add(Avatar_State_Transitions::ANY_STATE,
+                    Avatar_Component::LOOKING,
+                    Avatar_State_Transitions::ANY_CONTACTS,
+                    Avatar_State_Transitions::ANY_FRAME,
+                    transition);
+
+  transition.state = Avatar_Component::STANDING;
+  m_transitions.Add(Avatar_State_Transitions::ANY_STATE,
+                    Avatar_Component::STANDING,
+                    Avatar_State_Transitions::ANY_CONTACTS,
+                    Avatar_State_Transitions::ANY_FRAME,
+                    transition);
+  m_transitions.Compile();
+
   m_has_been_initialised = true;
   return true;
 }
@@ -68,89 +114,23 @@ void Charlie_Standing_Controller::Run_Avatar_State() {
 
   bool has_state_changed = false;
 
-  if (current_command.state == "") {
-    current_command.state = "Standing";
+  if (current_command.state == Avatar_Component::NO_STATE) {
+    current_command.state = Avatar_Component::STANDING;
   }
 
   // If there is a command (Left, Right, Run, Etc.)
   // or the direction is different
-  if (current_command.state != "" &&
+  if (current_command.state != Avatar_Component::NO_STATE &&
         current_state.state != current_command.state) {
     std::vector<Tile_Bitmap*> *adjacent_tiles = new std::vector<Tile_Bitmap*>();
-    Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tiles, &m_floor_tiles);
-    if (current_command.state == "Jumping") {
-      float y_velocity = m_vertical_jump_y_initial_velocity;
-      float x_velocity = m_vertical_jump_x_initial_velocity;
-      if (current_command.direction == "Right" ||
-            current_command.direction == "Left") {
-        Avatar_Helper::SetAvatarState(m_avatar,
-                                      m_game_settings->GetTilesetPath(),
-                                      m_animation_metadata,
-                                      "Charlie_Jumping",
-                                      "Vertical_Jump_Takeoff",
-                                      current_command.direction,
-                                      m_current_metadata_file_path,
-                                      m_current_metadata,
-                                      m_current_animation_subset);
-        if (current_command.direction == "Left") {
-          x_velocity *= -1;
-        }
-        m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
-      } else {
-        Avatar_Helper::SetAvatarState(m_avatar,
-                                      m_game_settings->GetTilesetPath(),
-                                      m_animation_metadata,
-                                      "Charlie_Jumping",
-                                      "Vertical_Jump_Takeoff",
-                                      m_avatar->GetState().direction,
-                                      m_current_metadata_file_path,
-                                      m_current_metadata,
-                                      m_current_animation_subset);
-        if (current_state.direction == "Left") {
-          x_velocity *= -1;
-        }
-        m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
-      }
-    } else if (current_command.state == "Running") {
-      Avatar_Helper::SetAvatarState(m_avatar,
-                                    m_game_settings->GetTilesetPath(),
-                                    m_animation_metadata,
-                                    "Charlie_Running",
-                                    "Standing_To_Running",
-                                    current_command.direction,
-                                    m_current_metadata_file_path,
-                                    m_current_metadata,
-                                    m_current_animation_subset);
-      has_state_changed = true;
-    } else if (current_command.state == "Looking") {
-      Avatar_Helper::SetAvatarState(m_avatar,
-                                    m_game_settings->GetTilesetPath(),
-                                    m_animation_metadata,
-                                    "Charlie_Standing",
-                                    "Looking",
-                                    m_avatar->GetState().direction,
-                                    m_current_metadata_file_path,
-                                    m_current_metadata,
-                                    m_current_animation_subset);
-      has_state_changed = true;
-    } else if (current_command.state == "Standing") {
-      Avatar_Helper::SetAvatarState(m_avatar,
-                                    m_game_settings->GetTilesetPath(),
-                                    m_animation_metadata,
-                                    "Charlie_Standing",
-                                    "Standing",
-                                    m_avatar->GetState().direction,
-                                    m_current_metadata_file_path,
-                                    m_current_metadata,
-                                    m_current_animation_subset);
-      has_state_changed = true;
-    }
+    Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tiles, m_tiles);
+    Run_Avatar_State_Transition(current_command.state, false);
     Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
     // If there was an adjacent tile before
     if (!adjacent_tiles->empty()) {
       // Check to see if we need to move the avatar back to adjacent
       std::vector<Tile_Bitmap*> *adjacent_tiles_now = new std::vector<Tile_Bitmap*>();
-      if (!Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tiles_now, &m_floor_tiles)) {
+      if (!Avatar_Helper::IsAvatarFloorAdjacent(m_avatar, adjacent_tiles_now, m_tiles)) {
         Avatar_Helper::MoveAvatarTileAdjacent(m_avatar,
                                               "Top",
                                               *(adjacent_tiles->begin()));
@@ -159,25 +139,16 @@ void Charlie_Standing_Controller::Run_Avatar_State() {
   } else {  // No command, run the standing animation,
     unsigned int state_index = current_state.state_index;
     state_index++;
-    if (state_index > (m_current_animation_subset->number_of_frames - 1)) {
-      if (m_current_animation_subset->is_repeatable) {
+    if (state_index > (GetCurrentAnimationSubset().number_of_frames - 1)) {
+      if (GetCurrentAnimationSubset().is_repeatable) {
         state_index = 0;
       } else {
-        if (current_state.state == "Initial") {
-          Avatar_Helper::SetAvatarState(m_avatar,
-                                        m_game_settings->GetTilesetPath(),
-                                        m_animation_metadata,
-                                        "Charlie_Standing",
-                                        "Standing",
-                                        m_avatar->GetState().direction,
-                                        m_current_metadata_file_path,
-                                        m_current_metadata,
-                                        m_current_animation_subset);
-          Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
+        if (Run_Avatar_State_Transition(current_command.state, true)) {
+          has_state_changed = true;
         } else {
           std::string error;
           error = "No handling for this non-repeating animation: ";
-          error += current_command.state;
+          error += Avatar_State_Names::GetInstance()->GetStateName(current_command.state);
           throw Exceptions::init_error(error);
         }
       }
@@ -186,14 +157,14 @@ void Charlie_Standing_Controller::Run_Avatar_State() {
     if (m_avatar->GetState() == m_avatar->GetLastRenderedState()) {
       Avatar_Helper::SetAvatarStateAnimationFrame(m_avatar,
                                                   state_index,
-                                                  m_current_animation_subset);
+                                                  m_animation_library);
     }
   }
 
   if (!HasAvatarStateChanged()) {
     // Detect if the avatar is intersecting with a wall
     std::vector<Avatar_Helper::Tile_Collision> *out_colliding_wall_tiles = new std::vector<Avatar_Helper::Tile_Collision>();
-    if (Avatar_Helper::IsAvatarWallColliding(m_avatar, out_colliding_wall_tiles, &m_wall_tiles)) {
+    if (Avatar_Helper::IsAvatarWallColliding(m_avatar, out_colliding_wall_tiles, m_tiles)) {
       m_adjacent_wall = &(*(out_colliding_wall_tiles->begin()));
       // Move back avatar
       if ((*out_colliding_wall_tiles->begin()).collision_side == "Right") {
@@ -212,41 +183,35 @@ void Charlie_Standing_Controller::Run_Avatar_State() {
     std::vector<Tile_Bitmap*> *adjacent_tiles = new std::vector<Tile_Bitmap*>();
     if (!Avatar_Helper::IsAvatarFloorAdjacent(m_avatar,
                                               adjacent_tiles,
-                                              &m_floor_tiles)) {
+                                              m_tiles)) {
       if (m_avatar->GetState().direction == m_avatar->GetLastRenderedState().direction) {
         float y_velocity = m_overbalancing_y_velocity;
         float x_velocity = m_overbalancing_x_velocity;
-        if (current_state.direction == "Left") {
+        if (current_state.direction == Avatar_Component::LEFT) {
           x_velocity *= -1;
         }
         m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
 
         Avatar_Helper::SetAvatarState(m_avatar,
                                       m_game_settings->GetTilesetPath(),
-                                      m_animation_metadata,
-                                      "Charlie_Jumping",
-                                      "Gap_Jump_Arc_Fall",
-                                      m_avatar->GetState().direction,
-                                      m_current_metadata_file_path,
-                                      m_current_metadata,
-                                      m_current_animation_subset);
+                                      m_animation_library,
+                                      Avatar_Component::CHARLIE_JUMPING,
+                                      Avatar_Component::GAP_JUMP_ARC_FALL,
+                                      m_avatar->GetState().direction);
       } else {
         float y_velocity = m_overbalancing_y_velocity;
         float x_velocity = m_overbalancing_x_velocity;
-        if (m_avatar->GetLastRenderedState().direction == "Left") {
+        if (m_avatar->GetLastRenderedState().direction == Avatar_Component::LEFT) {
           x_velocity *= -1;
         }
         m_avatar->SetVelocity(D3DXVECTOR3(x_velocity, y_velocity, 0));
 
         Avatar_Helper::SetAvatarState(m_avatar,
                                       m_game_settings->GetTilesetPath(),
-                                      m_animation_metadata,
-                                      "Charlie_Jumping",
-                                      "Gap_Jump_Arc_Fall",
-                                      m_avatar->GetLastRenderedState().direction,
-                                      m_current_metadata_file_path,
-                                      m_current_metadata,
-                                      m_current_animation_subset);
+                                      m_animation_library,
+                                      Avatar_Component::CHARLIE_JUMPING,
+                                      Avatar_Component::GAP_JUMP_ARC_FALL,
+                                      m_avatar->GetLastRenderedState().direction);
       }
 
       Avatar_Helper::AlignAvatarOnLastContactingFoot(m_avatar);
@@ -0,0 +1,115 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Collision_Cache.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Collision_Cache::~Collision_Cache() {
+  Clear();
+}
+
+//------------------------------------------------------------------------------
+Collision_Cache* Collision_Cache::GetInstance() {
+  if (m_instance == 0) {
+    m_instance = new Collision_Cache();
+  }
+  return m_instance;
+}
+
+//------------------------------------------------------------------------------
+Collision_Cache::Query_Key Collision_Cache::GetKey(Query_Type type, Avatar_Component *avatar, Tile_Grid *tiles) {
+  Query_Key key;
+  key.avatar = avatar;
+  key.avatar_state_version = avatar->GetStateVersion();
+  key.avatar_last_rendered_state_version = avatar->GetLastRenderedStateVersion();
+  key.avatar_command_version = 0;
+  if (type == LEDGE_GRAB) {
+    key.avatar_command_version = avatar->GetCommandVersion();
+  }
+  key.position = avatar->GetFixedPosition();
+  key.last_rendered_position = avatar->GetLastRenderedFixedPosition();
+  key.size = avatar->GetSize();
+  key.tiles = tiles;
+  key.tiles_version = tiles->GetVersion();
+  return key;
+}
+
+//------------------------------------------------------------------------------
+Collision_Cache::Query_Result const * Collision_Cache::Find(Query_Type type, Query_Key const &key) {
+  for (unsigned int index = 0; index < ENTRIES_PER_QUERY_TYPE; index++) {
+    Entry &entry = m_entries[type][index];
+    if (entry.is_valid && entry.key == key) {
+      m_statistics.hits++;
+      return &entry.result;
+    }
+  }
+  m_statistics.misses++;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+Collision_Cache::Query_Result * Collision_Cache::Store(Query_Type type, Query_Key const &key) {
+  Entry &entry = m_entries[type][m_next_entry[type]];
+  m_next_entry[type] = (m_next_entry[type] + 1) % ENTRIES_PER_QUERY_TYPE;
+
+  entry.is_valid = true;
+  entry.key = key;
+  entry.result.is_colliding = false;
+  entry.result.tiles.clear();
+  entry.result.collisions.clear();
+  return &entry.result;
+}
+
+//------------------------------------------------------------------------------
+void Collision_Cache::Clear() {
+  for (unsigned int type = 0; type < QUERY_TYPE_COUNT; type++) {
+    for (unsigned int index = 0; index < ENTRIES_PER_QUERY_TYPE; index++) {
+      m_entries[type][index].is_valid = false;
+      m_entries[type][index].result.tiles.clear();
+      m_entries[type][index].result.collisions.clear();
+    }
+    m_next_entry[type] = 0;
+  }
+}
+
+//------------------------------------------------------------------------------
+Collision_Cache::Statistics Collision_Cache::GetStatistics() {
+  return m_statistics;
+}
+
+//------------------------------------------------------------------------------
+void Collision_Cache::ResetStatistics() {
+  m_statistics.hits = 0;
+  m_statistics.misses = 0;
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+Collision_Cache::Collision_Cache() {
+  Clear();
+  ResetStatistics();
+}
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+Collision_Cache* Collision_Cache::m_instance = 0;
+
+}  // namespace Tunnelour
@@ -16,6 +16,8 @@
 #include "Debug_Data_Display_Controller.h"
 #include <iomanip>      // std::setprecision
 #include "Debug_Data_Display_Controller_Mutator.h"
+#include "Avatar_State_Names.h"
+#include "Collision_Cache.h"
 #include "Exceptions.h"
 #include "Bitmap_Helper.h"
 #include "String_Helper.h"
@@ -44,6 +46,10 @@ Debug_Data_Display_Controller::Debug_Data_Display_Controller() : Controller(),
   m_avatar_jumping_height_display = 0;
   m_avatar_distance_traveled_display = 0;
   m_avatar_seconds_past_display = 0;
+  m_collision_cache_display = 0;
+  m_state_resolution_display = 0;
+  m_crowd_display = 0;
+  m_level_load_display = 0;
   m_fps = 0;
   m_is_debug_mode = false;
   m_avatar = 0;
@@ -68,6 +74,10 @@ Debug_Data_Display_Controller::~Debug_Data_Display_Controller() {
   m_avatar_jumping_height_display = 0;
   m_avatar_distance_traveled_display = 0;
   m_avatar_seconds_past_display = 0;
+  m_collision_cache_display = 0;
+  m_state_resolution_display = 0;
+  m_crowd_display = 0;
+  m_level_load_display = 0;
   m_fps = 0;
   m_is_debug_mode = false;
   m_avatar = 0;
@@ -136,8 +146,21 @@ bool Debug_Data_Display_Controller::Run() {
     if (m_avatar_seconds_past_display == 0) {
       CreateAvatarSecondsPastDisplay();
     }
+    if (m_collision_cache_display == 0) {
+      CreateCollisionCacheDisplay();
+    }
+    if (m_state_resolution_display == 0) {
+      CreateStateResolutionDisplay();
+    }
+    if (m_crowd_display == 0) {
+      CreateCrowdDisplay();
+    }
+    if (m_level_load_display == 0) {
+      CreateLevelLoadDisplay();
+    }
 
-    if (!m_avatar->GetState().avatar_collision_blocks.empty()) {
+    Avatar_Component::Frame_Collision_Blocks const *avatar_collision_blocks = m_avatar->GetState().avatar_collision_blocks;
+    if (avatar_collision_blocks != 0) {
       // Remove the current bitmaps from the model
       vector<Tile_Bitmap*>::iterator collision_bitmap;
       for (collision_bitmap = m_collision_bitmaps.begin(); collision_bitmap != m_collision_bitmaps.end(); collision_bitmap++) {
@@ -145,10 +168,10 @@ bool Debug_Data_Display_Controller::Run() {
       }
       m_collision_bitmaps.clear();
 
-      vector<Avatar_Component::Avatar_Collision_Block>::iterator avatar_collision_block;
-      vector<Avatar_Component::Avatar_Collision_Block> avatar_collision_blocks = m_avatar->GetState().avatar_collision_blocks;
-      for (avatar_collision_block = avatar_collision_blocks.begin(); avatar_collision_block != avatar_collision_blocks.end(); avatar_collision_block++) {
-        Tile_Bitmap *avatar_collision_block_bitmap = Bitmap_Helper::CollisionBlockToBitmapComponent((*avatar_collision_block),
+      for (unsigned int id = Avatar_Component::AVATAR_BLOCK; id < Avatar_Component::COLLISION_BLOCK_COUNT; id++) {
+        Avatar_Component::Avatar_Collision_Block const &avatar_collision_block = avatar_collision_blocks->blocks[id];
+        if (avatar_collision_block.id == Avatar_Component::NO_COLLISION_BLOCK) { continue; }
+        Tile_Bitmap *avatar_collision_block_bitmap = Bitmap_Helper::CollisionBlockToBitmapComponent(avatar_collision_block,
                                                                                                       m_avatar,
                                                                                                       m_debug_tileset_metadata,
                                                                                                       m_game_settings->GetTilesetPath());
@@ -175,6 +198,10 @@ bool Debug_Data_Display_Controller::Run() {
         m_avatar_jumping_height_display->GetTexture()->transparency = 0.0f;
         m_avatar_distance_traveled_display->GetTexture()->transparency = 0.0f;
         m_avatar_seconds_past_display->GetTexture()->transparency = 0.0f;
+        m_collision_cache_display->GetTexture()->transparency = 0.0f;
+        m_state_resolution_display->GetTexture()->transparency = 0.0f;
+        m_crowd_display->GetTexture()->transparency = 0.0f;
+        m_level_load_display->GetTexture()->transparency = 0.0f;
         vector<Tile_Bitmap*>::iterator collision_bitmap;
         for (collision_bitmap = m_collision_bitmaps.begin(); collision_bitmap != m_collision_bitmaps.end(); collision_bitmap++) {
           (*collision_bitmap)->GetTexture()->transparency = 0.0f;
@@ -191,6 +218,10 @@ bool Debug_Data_Display_Controller::Run() {
         m_avatar_jumping_height_display->GetTexture()->transparency = 1.0f;
         m_avatar_distance_traveled_display->GetTexture()->transparency = 1.0f;
         m_avatar_seconds_past_display->GetTexture()->transparency = 1.0f;
+        m_collision_cache_display->GetTexture()->transparency = 1.0f;
+        m_state_resolution_display->GetTexture()->transparency = 1.0f;
+        m_crowd_display->GetTexture()->transparency = 1.0f;
+        m_level_load_display->GetTexture()->transparency = 1.0f;
         vector<Tile_Bitmap*>::iterator collision_bitmap;
         for (collision_bitmap = m_collision_bitmaps.begin(); collision_bitmap != m_collision_bitmaps.end(); collision_bitmap++) {
           (*collision_bitmap)->GetTexture()->transparency = 1.0f;
@@ -209,6 +240,10 @@ bool Debug_Data_Display_Controller::Run() {
     UpdateAvatarHeightDisplay();
     UpdateAvatarDistanceTraveledDisplay();
     UpdateAvatarSecondsPastDisplay();
+    UpdateCollisionCacheDisplay();
+    UpdateStateResolutionDisplay();
+    UpdateCrowdDisplay();
+    UpdateLevelLoadDisplay();
     result = true;
   }
   return result;
@@ -227,23 +262,22 @@ void Debug_Data_Display_Controller::CreateDebugDataHeading() {
   m_heading->GetText()->text = "DEBUG MODE";
   m_heading->GetTexture()->transparency = 0.0f;
   m_heading->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_heading->SetScreenSpace(true);
   m_model->Add(m_heading);
 }
 
 //------------------------------------------------------------------------------
 void Debug_Data_Display_Controller::UpdateDebugDataHeading() {
-  float top_left_window_x = m_camera->GetPosition().x -
-                            m_game_settings->GetResolution().x / 2;
-  float top_left_window_y = m_camera->GetPosition().y +
-                            m_game_settings->GetResolution().y / 2;
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
+  float top_left_window_y = m_game_settings->GetResolution().y / 2;
   float debug_data_text_title_x = top_left_window_x +
                                   m_heading->GetSize().x / 2 +
                                   10;  // This is the offset from the top
   float debug_data_text_title_y = top_left_window_y -
                                   m_heading->GetSize().y / 2;
-  m_heading->SetPosition(D3DXVECTOR3(debug_data_text_title_x,
-                                     debug_data_text_title_y,
-                                     m_text_z_position));
+  SetScreenPosition(m_heading, D3DXVECTOR3(debug_data_text_title_x,
+                                           debug_data_text_title_y,
+                                           m_text_z_position));
 }
 
 //------------------------------------------------------------------------------
@@ -252,34 +286,27 @@ void Debug_Data_Display_Controller::CreateFPSDisplay() {
   m_fps_display->GetText()->font_csv_file = m_font_path;
   m_fps_display->GetTexture()->transparency = 0.0f;
   m_fps_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_fps_display->SetScreenSpace(true);
   m_model->Add(m_fps_display);
 }
 
 //------------------------------------------------------------------------------
 void Debug_Data_Display_Controller::UpdateFPSDisplay() {
-  float top_left_window_x = m_camera->GetPosition().x -
-                            m_game_settings->GetResolution().x / 2;
-  float top_left_window_y = m_camera->GetPosition().y +
-                          m_game_settings->GetResolution().y / 2;
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
+  float top_left_window_y = m_game_settings->GetResolution().y / 2;
   Game_Metrics_Component::FPS_Data fps_data = m_game_metrics->GetFPSData();
   std::string fps_text = "F.P.S: ";
   fps_text += to_string(static_cast<long double>(fps_data.fps));
-  if (fps_text.compare(m_fps_display->GetText()->text) != 0) {
-    m_fps_display->GetText()->text = fps_text;
-    m_fps_display->GetFrame()->index_buffer = 0;
-    m_fps_display->GetTexture()->texture = 0;
-    m_fps_display->GetFrame()->vertex_buffer = 0;
-    m_fps_display->Init();
-  }
+  m_fps_display->SetText(fps_text);
   float m_fps_display_x = top_left_window_x +
                           m_fps_display->GetSize().x / 2 +
                           10;  // This is the offset from the top
   float m_fps_display_y = top_left_window_y -
                           m_fps_display->GetSize().y / 2 -
                           m_heading->GetSize().y;
-  m_fps_display->SetPosition(D3DXVECTOR3(m_fps_display_x,
-                                         m_fps_display_y,
-                                         m_text_z_position));
+  SetScreenPosition(m_fps_display, D3DXVECTOR3(m_fps_display_x,
+                                               m_fps_display_y,
+                                               m_text_z_position));
 }
 
 //------------------------------------------------------------------------------
@@ -288,32 +315,26 @@ void Debug_Data_Display_Controller::CreateAvatarPositionDisplay() {
   m_avatar_position_display->GetText()->font_csv_file = m_font_path;
   m_avatar_position_display->GetTexture()->transparency = 0.0f;
   m_avatar_position_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_avatar_position_display->SetScreenSpace(true);
   m_model->Add(m_avatar_position_display);
 }
 
 //------------------------------------------------------------------------------
 void Debug_Data_Display_Controller::UpdateAvatarPositionDisplay() {
-  float top_left_window_x = m_camera->GetPosition().x -
-                            m_game_settings->GetResolution().x / 2;
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
   std::string avatar_position_x = to_string(static_cast<long double>(m_avatar->GetPosition()->x));
   std::string avatar_position_y = to_string(static_cast<long double>(m_avatar->GetPosition()->y));
   std::string position_text = "Avatar Pos: x:" + avatar_position_x  + ",y:" + avatar_position_y;
-  if (position_text.compare(m_avatar_position_display->GetText()->text) != 0) {
-    m_avatar_position_display->GetText()->text = position_text;
-    m_avatar_position_display->GetFrame()->index_buffer = 0;
-    m_avatar_position_display->GetTexture()->texture = 0;
-    m_avatar_position_display->GetFrame()->vertex_buffer = 0;
-    m_avatar_position_display->Init();
-  }
+  m_avatar_position_display->SetText(position_text);
   float m_avatar_display_x = top_left_window_x +
                              m_avatar_position_display->GetSize().x / 2 +
                              10;  // This is the offset from the top
   float m_avatar_display_y = m_fps_display->GetBottomRightPostion().y -
                              m_avatar_position_display->GetSize().y / 2;
 
-  m_avatar_position_display->SetPosition(D3DXVECTOR3(m_avatar_display_x,
-                                                     m_avatar_display_y,
-                                                     m_text_z_position));
+  SetScreenPosition(m_avatar_position_display, D3DXVECTOR3(m_avatar_display_x,
+                                                           m_avatar_display_y,
+                                                           m_text_z_position));
 }
 
 //------------------------------------------------------------------------------
@@ -322,34 +343,29 @@ void Debug_Data_Display_Controller::CreateAvatarStateDisplay() {
   m_avatar_state_display->GetText()->font_csv_file = m_font_path;
   m_avatar_state_display->GetTexture()->transparency = 0.0f;
   m_avatar_state_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_avatar_state_display->SetScreenSpace(true);
   m_model->Add(m_avatar_state_display);
 }
 
 //------------------------------------------------------------------------------
 void Debug_Data_Display_Controller::UpdateAvatarStateDisplay() {
-  float top_left_window_x = m_camera->GetPosition().x -
-                            m_game_settings->GetResolution().x / 2;
-  std::string avatar_state = m_avatar->GetState().parent_state;
-  std::string avatar_subset = m_avatar->GetState().state;
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
+  Avatar_State_Names *state_names = Avatar_State_Names::GetInstance();
+  std::string avatar_state = state_names->GetStateName(m_avatar->GetState().parent_state);
+  std::string avatar_subset = state_names->GetStateName(m_avatar->GetState().state);
   std::string avatar_subset_index = to_string(static_cast<long double>(m_avatar->GetState().state_index));
-  std::string avatar_direction = m_avatar->GetState().direction;
+  std::string avatar_direction = Avatar_State_Names::GetDirectionName(m_avatar->GetState().direction);
   std::string state_text = "Avatar State: " + avatar_state  + "::" + avatar_subset + " " + avatar_subset_index + "(" + avatar_direction + ")";
-  if (state_text.compare(m_avatar_state_display->GetText()->text) != 0) {
-    m_avatar_state_display->GetText()->text = state_text;
-    m_avatar_state_display->GetFrame()->index_buffer = 0;
-    m_avatar_state_display->GetTexture()->texture = 0;
-    m_avatar_state_display->GetFrame()->vertex_buffer = 0;
-    m_avatar_state_display->Init();
-  }
+  m_avatar_state_display->SetText(state_text);
   float m_avatar_display_x = top_left_window_x +
                              m_avatar_state_display->GetSize().x / 2 +
                              10;  // This is the offset from the top
   float m_avatar_display_y = m_avatar_position_display->GetBottomRightPostion().y -
                              m_avatar_state_display->GetSize().y / 2;
 
-  m_avatar_state_display->SetPosition(D3DXVECTOR3(m_avatar_display_x,
-                                                     m_avatar_display_y,
-                                                     m_text_z_position));
+  SetScreenPosition(m_avatar_state_display, D3DXVECTOR3(m_avatar_display_x,
+                                                        m_avatar_display_y,
+                                                        m_text_z_position));
 }
 
 //------------------------------------------------------------------------------
@@ -358,23 +374,17 @@ void Debug_Data_Display_Controller::CreateAvatarVelocityDisplay() {
   m_avatar_velocity_display->GetText()->font_csv_file = m_font_path;
   m_avatar_velocity_display->GetTexture()->transparency = 0.0f;
   m_avatar_velocity_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_avatar_velocity_display->SetScreenSpace(true);
   m_model->Add(m_avatar_velocity_display);
 }
 
 //------------------------------------------------------------------------------
 void Debug_Data_Display_Controller::UpdateAvatarVelocityDisplay() {
-  float top_left_window_x = m_camera->GetPosition().x -
-                            m_game_settings->GetResolution().x / 2;
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
   std::string avatar_velocity_x = to_string(static_cast<long double>(m_avatar->GetVelocity().x));
   std::string avatar_velocity_y = to_string(static_cast<long double>(m_avatar->GetVelocity().y));
   std::string velocity_text = "Avatar Velocity: x:" + avatar_velocity_x  + ",y:" + avatar_velocity_y;
-  if (velocity_text.compare(m_avatar_velocity_display->GetText()->text) != 0) {
-    m_avatar_velocity_display->GetText()->text = velocity_text;
-    m_avatar_velocity_display->GetFrame()->index_buffer = 0;
-    m_avatar_velocity_display->GetTexture()->texture = 0;
-    m_avatar_velocity_display->GetFrame()->vertex_buffer = 0;
-    m_avatar_velocity_display->Init();
-  }
+  m_avatar_velocity_display->SetText(velocity_text);
 
   float m_avatar_display_x = top_left_window_x +
                              m_avatar_velocity_display->GetSize().x / 2 +
@@ -382,9 +392,9 @@ void Debug_Data_Display_Controller::UpdateAvatarVelocityDisplay() {
   float m_avatar_display_y = m_avatar_state_display->GetBottomRightPostion().y -
                              m_avatar_velocity_display->GetSize().y / 2;
 
-  m_avatar_velocity_display->SetPosition(D3DXVECTOR3(m_avatar_display_x,
-                                                     m_avatar_display_y,
-                                                     m_text_z_position));
+  SetScreenPosition(m_avatar_velocity_display, D3DXVECTOR3(m_avatar_display_x,
+                                                           m_avatar_display_y,
+                                                           m_text_z_position));
 }
 
 //------------------------------------------------------------------------------
@@ -393,17 +403,17 @@ void Debug_Data_Display_Controller::CreateAvatarDistanceDisplay() {
   m_avatar_jumping_distance_display->GetText()->font_csv_file = m_font_path;
   m_avatar_jumping_distance_display->GetTexture()->transparency = 0.0f;
   m_avatar_jumping_distance_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_avatar_jumping_distance_display->SetScreenSpace(true);
   m_model->Add(m_avatar_jumping_distance_display);
 }
 
 //------------------------------------------------------------------------------
 void Debug_Data_Display_Controller::UpdateAvatarDistanceDisplay() {
-  float top_left_window_x = m_camera->GetPosition().x -
-                            m_game_settings->GetResolution().x / 2;
-  std::string current_parent_state = m_avatar->GetState().parent_state;
-  if (current_parent_state.compare("Charlie_Jumping") == 0) {
-    std::string last_parent_state = m_avatar->GetLastRenderedState().parent_state;
-    if (last_parent_state.compare("Charlie_Jumping") != 0) {
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
+  unsigned int current_parent_state = m_avatar->GetState().parent_state;
+  if (current_parent_state == Avatar_Component::CHARLIE_JUMPING) {
+    unsigned int last_parent_state = m_avatar->GetLastRenderedState().parent_state;
+    if (last_parent_state != Avatar_Component::CHARLIE_JUMPING) {
       m_jumping_distance = 0;
     }
     float distance_moved = m_avatar->GetPosition()->x - m_avatar->GetLastRenderedPosition().x;
@@ -412,13 +422,7 @@ void Debug_Data_Display_Controller::UpdateAvatarDistanceDisplay() {
 
   std::string distance_string = to_string(static_cast<long double>(m_jumping_distance));
   std::string distance_text = "Avatar Jump Distance: " + distance_string;
-  if (distance_text.compare(m_avatar_jumping_distance_display->GetText()->text) != 0) {
-    m_avatar_jumping_distance_display->GetText()->text = distance_text;
-    m_avatar_jumping_distance_display->GetFrame()->index_buffer = 0;
-    m_avatar_jumping_distance_display->GetTexture()->texture = 0;
-    m_avatar_jumping_distance_display->GetFrame()->vertex_buffer = 0;
-    m_avatar_jumping_distance_display->Init();
-  }
+  m_avatar_jumping_distance_display->SetText(distance_text);
 
   float m_avatar_display_x = top_left_window_x +
                              m_avatar_jumping_distance_display->GetSize().x / 2 +
@@ -426,9 +430,9 @@ void Debug_Data_Display_Controller::UpdateAvatarDistanceDisplay() {
   float m_avatar_display_y = m_avatar_velocity_display->GetBottomRightPostion().y -
                              m_avatar_jumping_distance_display->GetSize().y / 2;
 
-  m_avatar_jumping_distance_display->SetPosition(D3DXVECTOR3(m_avatar_display_x,
-                                                     m_avatar_display_y,
-                                                     m_text_z_position));
+  SetScreenPosition(m_avatar_jumping_distance_display, D3DXVECTOR3(m_avatar_display_x,
+                                                                   m_avatar_display_y,
+                                                                   m_text_z_position));
 }
 
 //------------------------------------------------------------------------------
@@ -437,15 +441,15 @@ void Debug_Data_Display_Controller::CreateAvatarHeightDisplay() {
   m_avatar_jumping_height_display->GetText()->font_csv_file = m_font_path;
   m_avatar_jumping_height_display->GetTexture()->transparency = 0.0f;
   m_avatar_jumping_height_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_avatar_jumping_height_display->SetScreenSpace(true);
   m_model->Add(m_avatar_jumping_height_display);
 }
 
 //------------------------------------------------------------------------------
 void Debug_Data_Display_Controller::UpdateAvatarHeightDisplay() {
-  float top_left_window_x = m_camera->GetPosition().x -
-                            m_game_settings->GetResolution().x / 2;
-  if (m_avatar->GetState().parent_state.compare("Charlie_Jumping") == 0) {
-    if (m_avatar->GetLastRenderedState().parent_state.compare("Charlie_Jumping") != 0) {
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
+  if (m_avatar->GetState().parent_state == Avatar_Component::CHARLIE_JUMPING) {
+    if (m_avatar->GetLastRenderedState().parent_state != Avatar_Component::CHARLIE_JUMPING) {
       m_jumping_height = 0;
     }
     float current_y = m_avatar->GetPosition()->y;
@@ -458,13 +462,7 @@ void Debug_Data_Display_Controller::UpdateAvatarHeightDisplay() {
 
   std::string distance_string = to_string(static_cast<long double>(m_jumping_height));
   std::string height_text = "Avatar Jump Height: " + distance_string;
-  if (height_text.compare(m_avatar_jumping_height_display->GetText()->text) != 0) {
-    m_avatar_jumping_height_display->GetText()->text = height_text;
-    m_avatar_jumping_height_display->GetFrame()->index_buffer = 0;
-    m_avatar_jumping_height_display->GetTexture()->texture = 0;
-    m_avatar_jumping_height_display->GetFrame()->vertex_buffer = 0;
-    m_avatar_jumping_height_display->Init();
-  }
+  m_avatar_jumping_height_display->SetText(height_text);
 
   float m_avatar_display_x = top_left_window_x +
                              m_avatar_jumping_height_display->GetSize().x / 2 +
@@ -472,9 +470,9 @@ void Debug_Data_Display_Controller::UpdateAvatarHeightDisplay() {
   float m_avatar_display_y = m_avatar_jumping_distance_display->GetBottomRightPostion().y -
                              m_avatar_jumping_height_display->GetSize().y / 2;
 
-  m_avatar_jumping_height_display->SetPosition(D3DXVECTOR3(m_avatar_display_x,
-                                                     m_avatar_display_y,
-                                                     m_text_z_position));
+  SetScreenPosition(m_avatar_jumping_height_display, D3DXVECTOR3(m_avatar_display_x,
+                                                                 m_avatar_display_y,
+                                                                 m_text_z_position));
 }
 
 //------------------------------------------------------------------------------
@@ -483,26 +481,20 @@ void Debug_Data_Display_Controller::CreateAvatarDistanceTraveledDisplay() {
   m_avatar_distance_traveled_display->GetText()->font_csv_file = m_font_path;
   m_avatar_distance_traveled_display->GetTexture()->transparency = 0.0f;
   m_avatar_distance_traveled_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_avatar_distance_traveled_display->SetScreenSpace(true);
   m_model->Add(m_avatar_distance_traveled_display);
 }
 
 //------------------------------------------------------------------------------
 void Debug_Data_Display_Controller::UpdateAvatarDistanceTraveledDisplay() {
-  float top_left_window_x = m_camera->GetPosition().x -
-                            m_game_settings->GetResolution().x / 2;
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
   std::ostringstream distance;
   distance << std::setprecision(2);
   distance << std::fixed;
   distance << m_game_metrics->GetDistanceTraveled();
 
   std::string travelled_text = "Distance Traveled: " + distance.str() + " meters";
-  if (travelled_text.compare(m_avatar_distance_traveled_display->GetText()->text) != 0) {
-    m_avatar_distance_traveled_display->GetText()->text = travelled_text;
-    m_avatar_distance_traveled_display->GetFrame()->index_buffer = 0;
-    m_avatar_distance_traveled_display->GetTexture()->texture = 0;
-    m_avatar_distance_traveled_display->GetFrame()->vertex_buffer = 0;
-    m_avatar_distance_traveled_display->Init();
-  }
+  m_avatar_distance_traveled_display->SetText(travelled_text);
 
   float m_avatar_display_x = top_left_window_x +
                              m_avatar_distance_traveled_display->GetSize().x / 2 +
@@ -510,9 +502,9 @@ void Debug_Data_Display_Controller::UpdateAvatarDistanceTraveledDisplay() {
   float m_avatar_display_y = m_avatar_jumping_height_display->GetBottomRightPostion().y -
                              m_avatar_distance_traveled_display->GetSize().y / 2;
 
-  m_avatar_distance_traveled_display->SetPosition(D3DXVECTOR3(m_avatar_display_x,
-                                                     m_avatar_display_y,
-                                                     m_text_z_position));
+  SetScreenPosition(m_avatar_distance_traveled_display, D3DXVECTOR3(m_avatar_display_x,
+                                                                    m_avatar_display_y,
+                                                                    m_text_z_position));
 }
 
 //------------------------------------------------------------------------------
@@ -521,32 +513,163 @@ void Debug_Data_Display_Controller::CreateAvatarSecondsPastDisplay() {
   m_avatar_seconds_past_display->GetText()->font_csv_file = m_font_path;
   m_avatar_seconds_past_display->GetTexture()->transparency = 0.0f;
   m_avatar_seconds_past_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_avatar_seconds_past_display->SetScreenSpace(true);
   m_model->Add(m_avatar_seconds_past_display);
 }
 
 //------------------------------------------------------------------------------
 void Debug_Data_Display_Controller::UpdateAvatarSecondsPastDisplay() {
-  float top_left_window_x = m_camera->GetPosition().x -
-                            m_game_settings->GetResolution().x / 2;
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
   std::ostringstream seconds;
   seconds << std::setprecision(2) << std::fixed << m_game_metrics->GetSecondsPast();
   std::string seconds_text = "Seconds Past: " + seconds.str();
-  if (seconds_text.compare(m_avatar_seconds_past_display->GetText()->text) != 0) {
-    m_avatar_seconds_past_display->GetText()->text = seconds_text;
-    m_avatar_seconds_past_display->GetFrame()->index_buffer = 0;
-    m_avatar_seconds_past_display->GetTexture()->texture = 0;
-    m_avatar_seconds_past_display->GetFrame()->vertex_buffer = 0;
-    m_avatar_seconds_past_display->Init();
-  }
+  m_avatar_seconds_past_display->SetText(seconds_text);
   float m_avatar_display_x = top_left_window_x +
                              m_avatar_seconds_past_display->GetSize().x / 2 +
                              10;  // This is the offset from the top
   float m_avatar_display_y = m_avatar_distance_traveled_display->GetBottomRightPostion().y -
                              m_avatar_seconds_past_display->GetSize().y / 2;
 
-  m_avatar_seconds_past_display->SetPosition(D3DXVECTOR3(m_avatar_display_x,
-                                                     m_avatar_display_y,
-                                                     m_text_z_position));
+  SetScreenPosition(m_avatar_seconds_past_display, D3DXVECTOR3(m_avatar_display_x,
+                                                               m_avatar_display_y,
+                                                               m_text_z_position));
+}
+
+//------------------------------------------------------------------------------
+void Debug_Data_Display_Controller::CreateCollisionCacheDisplay() {
+  m_collision_cache_display = new Text_Component();
+  m_collision_cache_display->GetText()->font_csv_file = m_font_path;
+  m_collision_cache_display->GetTexture()->transparency = 0.0f;
+  m_collision_cache_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_collision_cache_display->SetScreenSpace(true);
+  m_model->Add(m_collision_cache_display);
+}
+
+//------------------------------------------------------------------------------
+void Debug_Data_Display_Controller::UpdateCollisionCacheDisplay() {
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
+  Collision_Cache::Statistics statistics = Collision_Cache::GetInstance()->GetStatistics();
+  std::string cache_text = "Collision Cache: " + to_string(statistics.hits) + " hits, " +
+                           to_string(statistics.misses) + " misses";
+  m_collision_cache_display->SetText(cache_text);
+  float m_avatar_display_x = top_left_window_x +
+                             m_collision_cache_display->GetSize().x / 2 +
+                             10;  // This is the offset from the top
+  float m_avatar_display_y = m_avatar_seconds_past_display->GetBottomRightPostion().y -
+                             m_collision_cache_display->GetSize().y / 2;
+
+  SetScreenPosition(m_collision_cache_display, D3DXVECTOR3(m_avatar_display_x,
+                                                           m_avatar_display_y,
+                                                           m_text_z_position));
+}
+
+//------------------------------------------------------------------------------
+void Debug_Data_Display_Controller::CreateStateResolutionDisplay() {
+  m_state_resolution_display = new Text_Component();
+  m_state_resolution_display->GetText()->font_csv_file = m_font_path;
+  m_state_resolution_display->GetTexture()->transparency = 0.0f;
+  m_state_resolution_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_state_resolution_display->SetScreenSpace(true);
+  m_model->Add(m_state_resolution_display);
+}
+
+//------------------------------------------------------------------------------
+void Debug_Data_Display_Controller::UpdateStateResolutionDisplay() {
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
+  Game_Metrics_Component::State_Resolution_Data state_resolution_data = m_game_metrics->GetStateResolutionData();
+  std::ostringstream resolve_time;
+  resolve_time << std::setprecision(3) << std::fixed << state_resolution_data.resolve_time_ms;
+  std::string state_resolution_text = "State Transitions: " + to_string(state_resolution_data.transitions) +
+                                      " in " + resolve_time.str() + "ms, max " +
+                                      to_string(state_resolution_data.max_transitions) + ", " +
+                                      to_string(state_resolution_data.cut_short_ticks) + " cut short";
+  m_state_resolution_display->SetText(state_resolution_text);
+  float m_avatar_display_x = top_left_window_x +
+                             m_state_resolution_display->GetSize().x / 2 +
+                             10;  // This is the offset from the top
+  float m_avatar_display_y = m_collision_cache_display->GetBottomRightPostion().y -
+                             m_state_resolution_display->GetSize().y / 2;
+
+  SetScreenPosition(m_state_resolution_display, D3DXVECTOR3(m_avatar_display_x,
+                                                            m_avatar_display_y,
+                                                            m_text_z_position));
+}
+
+//------------------------------------------------------------------------------
+void Debug_Data_Display_Controller::CreateCrowdDisplay() {
+  m_crowd_display = new Text_Component();
+  m_crowd_display->GetText()->font_csv_file = m_font_path;
+  m_crowd_display->GetTexture()->transparency = 0.0f;
+  m_crowd_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_crowd_display->SetScreenSpace(true);
+  m_model->Add(m_crowd_display);
+}
+
+//------------------------------------------------------------------------------
+void Debug_Data_Display_Controller::UpdateCrowdDisplay() {
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
+  Game_Metrics_Component::Crowd_Data crowd_data = m_game_metrics->GetCrowdData();
+  std::ostringstream update_time;
+  update_time << std::setprecision(3) << std::fixed << crowd_data.update_time_ms;
+  std::ostringstream avatars_per_ms;
+  avatars_per_ms << std::setprecision(1) << std::fixed << crowd_data.avatars_per_ms;
+  std::string crowd_text = "Crowd: " + to_string(crowd_data.avatars) +
+                           " avatars in " + update_time.str() + "ms on " +
+                           to_string(crowd_data.threads) + " threads, " +
+                           avatars_per_ms.str() + " avatars/ms";
+  m_crowd_display->SetText(crowd_text);
+  float m_avatar_display_x = top_left_window_x +
+                             m_crowd_display->GetSize().x / 2 +
+                             10;  // This is the offset from the top
+  float m_avatar_display_y = m_state_resolution_display->GetBottomRightPostion().y -
+                             m_crowd_display->GetSize().y / 2;
+
+  SetScreenPosition(m_crowd_display, D3DXVECTOR3(m_avatar_display_x,
+                                                 m_avatar_display_y,
+                                                 m_text_z_position));
+}
+
+//------------------------------------------------------------------------------
+void Debug_Data_Display_Controller::CreateLevelLoadDisplay() {
+  m_level_load_display = new Text_Component();
+  m_level_load_display->GetText()->font_csv_file = m_font_path;
+  m_level_load_display->GetTexture()->transparency = 0.0f;
+  m_level_load_display->SetPosition(D3DXVECTOR3(0, 0, m_text_z_position));
+  m_level_load_display->SetScreenSpace(true);
+  m_model->Add(m_level_load_display);
+}
+
+//------------------------------------------------------------------------------
+void Debug_Data_Display_Controller::UpdateLevelLoadDisplay() {
+  float top_left_window_x = -m_game_settings->GetResolution().x / 2;
+  Game_Metrics_Component::Level_Load_Data level_load_data = m_game_metrics->GetLevelLoadData();
+  std::ostringstream full_load_time;
+  full_load_time << std::setprecision(3) << std::fixed << level_load_data.full_load_time_ms;
+  std::ostringstream reset_time;
+  reset_time << std::setprecision(3) << std::fixed << level_load_data.reset_time_ms;
+  std::string level_load_text = "Level Load: " + full_load_time.str() + "ms full (" +
+                                to_string(level_load_data.full_loads) + "), " +
+                                reset_time.str() + "ms reset (" +
+                                to_string(level_load_data.resets) + ")";
+  m_level_load_display->SetText(level_load_text);
+  float m_avatar_display_x = top_left_window_x +
+                             m_level_load_display->GetSize().x / 2 +
+                             10;  // This is the offset from the top
+  float m_avatar_display_y = m_crowd_display->GetBottomRightPostion().y -
+                             m_level_load_display->GetSize().y / 2;
+
+  SetScreenPosition(m_level_load_display, D3DXVECTOR3(m_avatar_display_x,
+                                                      m_avatar_display_y,
+                                                      m_text_z_position));
+}
+
+//------------------------------------------------------------------------------
+void Debug_Data_Display_Controller::SetScreenPosition(Text_Component *text,
+                                                      D3DXVECTOR3 position) {
+  // Screen space text only needs moving when its size has changed.
+  if (*(text->GetPosition()) != position) {
+    text->SetPosition(position);
+  }
 }
 
 }  // namespace Tunnelour
@@ -51,6 +51,11 @@ Direct3D11_View::Direct3D11_View() {
   m_game_settings = 0;
   m_game_metrics = 0;
   m_avatar = 0;
+
+  m_texture_pump = 0;
+  m_upload_time_ms = 0;
+  m_upload_time_budget_ms = 4;
+  m_frequency = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -146,6 +151,18 @@ Direct3D11_View::~Direct3D11_View() {
     }
   }
 
+  if (m_texture_pump != 0) {
+    m_texture_pump->PurgeAllItems();
+    m_texture_pump->Release();
+    m_texture_pump = 0;
+  }
+  for (std::map<std::wstring, Pending_Texture>::iterator pending_texture = m_pending_textures.begin(); pending_texture != m_pending_textures.end(); pending_texture++) {
+    if (pending_texture->second.texture != 0) {
+      pending_texture->second.texture->Release();
+    }
+  }
+  m_pending_textures.clear();
+
   if (!m_texture_map.empty()) {
     for (std::map<std::wstring, ID3D11ShaderResourceView*>::iterator texture = m_texture_map.begin(); texture != m_texture_map.end(); texture++) {
       texture->second->Release();
@@ -156,6 +173,7 @@ Direct3D11_View::~Direct3D11_View() {
   m_model->IgnoreType(this, "Bitmap_Component");
   m_model->IgnoreType(this, "Text_Component");
   m_model->IgnoreType(this, "Avatar_Component");
+  m_model->IgnoreType(this, "Crowd_Avatar_Component");
 
   
   while (!m_renderables.Layer_00.empty()) {
@@ -200,6 +218,24 @@ Direct3D11_View::~Direct3D11_View() {
   }
   m_renderables.Layer_05.clear();
 
+  while (!m_renderables.HUD_Layer_03.empty()) {
+    delete m_renderables.HUD_Layer_03.back();
+    m_renderables.HUD_Layer_03.pop_back();
+  }
+  m_renderables.HUD_Layer_03.clear();
+
+  while (!m_renderables.HUD_Layer_04.empty()) {
+    delete m_renderables.HUD_Layer_04.back();
+    m_renderables.HUD_Layer_04.pop_back();
+  }
+  m_renderables.HUD_Layer_04.clear();
+
+  while (!m_renderables.HUD_Layer_05.empty()) {
+    delete m_renderables.HUD_Layer_05.back();
+    m_renderables.HUD_Layer_05.pop_back();
+  }
+  m_renderables.HUD_Layer_05.clear();
+
   m_camera = 0;
   m_game_settings = 0;
   m_game_metrics = 0;
@@ -213,6 +249,7 @@ void Direct3D11_View::Init(Component_Composite * const model) {
   m_model->ObserveType(this, "Bitmap_Component");
   m_model->ObserveType(this, "Text_Component");
   m_model->ObserveType(this, "Avatar_Component");
+  m_model->ObserveType(this, "Crowd_Avatar_Component");
 
   Direct3D11_View_Mutator mutator;
   m_model->Apply(&mutator);
@@ -262,6 +299,8 @@ void Direct3D11_View::Run() {
       m_debug_shader->Init(m_device, &(m_game_settings->GetHWnd()));
     }
 
+    Process_Texture_Uploads();
+
     // <BeginScene>
     D3DXMATRIX *viewmatrix = new D3DXMATRIX();
 
@@ -280,20 +319,30 @@ void Direct3D11_View::Run() {
       m_camera->SetLastPosition(m_camera->GetPosition());
     }
 
+    // Draw the opaque tiles first, front to back with blending off, so the
+    // depth test throws away whatever they cover before it is shaded.
+    TurnZBufferOn();
+    TurnOffAlphaBlending();
+    Render_Bitmaps(m_renderables.Layer_01, viewmatrix, OPAQUE_BITMAPS);
+    Render_Bitmaps(m_renderables.Layer_00, viewmatrix, OPAQUE_BITMAPS);
+
     TurnOnAlphaBlending();
     
     // Sort the Renderables by Z order.
-    Render_Bitmaps(m_renderables.Layer_00, viewmatrix);
-    Render_Bitmaps(m_renderables.Layer_01, viewmatrix);
+    Render_Bitmaps(m_renderables.Layer_00, viewmatrix, BLENDED_BITMAPS);
+    Render_Bitmaps(m_renderables.Layer_01, viewmatrix, BLENDED_BITMAPS);
     Render_Bitmaps(m_renderables.Avatars, viewmatrix);
     if (m_avatar != 0) {
-      m_avatar->SetLastRenderedPosition(*(m_avatar->GetPosition()));
-      m_avatar->SetLastRenderedState(m_avatar->GetState());
+      m_avatar->SetPositionRendered();
+      m_avatar->SetLastRenderedState();
     }
     Render_Bitmaps(m_renderables.Layer_02, viewmatrix);
     Render_Texts(m_renderables.Layer_03, viewmatrix);
+    Render_Texts(m_renderables.HUD_Layer_03, &m_hud_view);
     Render_Bitmaps(m_renderables.Layer_04, viewmatrix);
+    Render_Bitmaps(m_renderables.HUD_Layer_04, &m_hud_view);
     Render_Texts(m_renderables.Layer_05, viewmatrix);
+    Render_Texts(m_renderables.HUD_Layer_05, &m_hud_view);
 
     TurnOffAlphaBlending();
 
@@ -357,7 +406,11 @@ void Direct3D11_View::HandleEventAdd(Tunnelour::Component * const component) {
       m_renderables.Layer_02.push_back(bitmap_renderable);
     }
     if (bitmap->GetPosition()->z == -4) {
-      m_renderables.Layer_04.push_back(bitmap_renderable);
+      if (bitmap->IsScreenSpace()) {
+        m_renderables.HUD_Layer_04.push_back(bitmap_renderable);
+      } else {
+        m_renderables.Layer_04.push_back(bitmap_renderable);
+      }
     }
   }
 
@@ -373,12 +426,19 @@ void Direct3D11_View::HandleEventAdd(Tunnelour::Component * const component) {
     text_renderable->frame_centre = text->GetFrameCentre();
     text_renderable->scale = text->GetScale();
     text_renderable->position = text->GetPosition();
-    text_renderable->font = text->GetFont();
 
     if (text->GetPosition()->z == -3) {
-      m_renderables.Layer_03.push_back(text_renderable);
+      if (text->IsScreenSpace()) {
+        m_renderables.HUD_Layer_03.push_back(text_renderable);
+      } else {
+        m_renderables.Layer_03.push_back(text_renderable);
+      }
     } else if (text->GetPosition()->z == -5) {
-      m_renderables.Layer_05.push_back(text_renderable);
+      if (text->IsScreenSpace()) {
+        m_renderables.HUD_Layer_05.push_back(text_renderable);
+      } else {
+        m_renderables.Layer_05.push_back(text_renderable);
+      }
     }
   }
 
@@ -397,6 +457,20 @@ void Direct3D11_View::HandleEventAdd(Tunnelour::Component * const component) {
       m_renderables.Avatars.push_back(bitmap_renderable);
     }
   }
+  if (component->GetType().compare("Crowd_Avatar_Component") == 0) {
+    // Found one of the crowd's avatars, drawn with the player's avatar
+    Tunnelour::Avatar_Component *crowd_avatar = 0;
+    crowd_avatar = static_cast<Tunnelour::Avatar_Component*>(component);
+    Bitmap_Renderable *bitmap_renderable = new Bitmap_Renderable();
+    bitmap_renderable->bitmap = crowd_avatar;
+    bitmap_renderable->frame = crowd_avatar->GetFrame();
+    bitmap_renderable->texture = crowd_avatar->GetTexture();
+    bitmap_renderable->frame_centre = crowd_avatar->GetFrameCentre();
+    bitmap_renderable->scale = crowd_avatar->GetScale();
+    bitmap_renderable->position = crowd_avatar->GetPosition();
+
+    m_renderables.Avatars.push_back(bitmap_renderable);
+  }
   if (component->GetType().compare("Game_Metrics_Component") == 0) {
     m_game_metrics = static_cast<Tunnelour::Game_Metrics_Component*>(component);
   }
@@ -444,15 +518,19 @@ void Direct3D11_View::HandleEventRemove(Tunnelour::Component * const component){
         m_renderables.Layer_02.erase(found_bitmap_renderable);
       }
     } else  if (bitmap_component->GetPosition()->z == -4) {
+      std::vector<Bitmap_Renderable*> *layer = &m_renderables.Layer_04;
+      if (bitmap_component->IsScreenSpace()) {
+        layer = &m_renderables.HUD_Layer_04;
+      }
       std::vector<Bitmap_Renderable*>::iterator bitmap_renderable;
-      for (bitmap_renderable = m_renderables.Layer_04.begin(); bitmap_renderable != m_renderables.Layer_04.end(); bitmap_renderable++) {
+      for (bitmap_renderable = layer->begin(); bitmap_renderable != layer->end(); bitmap_renderable++) {
         if ((*bitmap_renderable)->bitmap->GetID() == bitmap_component->GetID()) {
           found_bitmap_renderable = bitmap_renderable;
           found_renderable = true;
         }
       }
       if (found_renderable) {
-        m_renderables.Layer_04.erase(found_bitmap_renderable);
+        layer->erase(found_bitmap_renderable);
       }
     }
 
@@ -466,31 +544,43 @@ void Direct3D11_View::HandleEventRemove(Tunnelour::Component * const component){
     std::vector<Text_Renderable*>::iterator found_text_renderable;
     std::vector<Text_Renderable*>::iterator text_renderable;
     bool found_renderable = false;
+    std::vector<Text_Renderable*> *layer = 0;
     if (text_component->GetPosition()->z == -3) {
-      for (text_renderable = m_renderables.Layer_03.begin(); text_renderable != m_renderables.Layer_03.end(); text_renderable++) {
-        if ((*text_renderable)->text->GetID() == text_component->GetID()) {
-          found_text_renderable = text_renderable;
-          found_renderable = true;
-        }
-      }
-      if (found_renderable) {
-        m_renderables.Layer_03.erase(found_text_renderable);
+      layer = &m_renderables.Layer_03;
+      if (text_component->IsScreenSpace()) {
+        layer = &m_renderables.HUD_Layer_03;
       }
     } else if (text_component->GetPosition()->z == -5) {
-      for (text_renderable = m_renderables.Layer_05.begin(); text_renderable != m_renderables.Layer_05.end(); text_renderable++) {
+      layer = &m_renderables.Layer_05;
+      if (text_component->IsScreenSpace()) {
+        layer = &m_renderables.HUD_Layer_05;
+      }
+    }
+    if (layer != 0) {
+      for (text_renderable = layer->begin(); text_renderable != layer->end(); text_renderable++) {
         if ((*text_renderable)->text->GetID() == text_component->GetID()) {
           found_text_renderable = text_renderable;
           found_renderable = true;
         }
       }
       if (found_renderable) {
-        m_renderables.Layer_05.erase(found_text_renderable);
+        layer->erase(found_text_renderable);
       }
     }
 
     if (!found_renderable) {
       throw Exceptions::run_error("View Could not find Text Renderable to Delete!");
     }
+  } else if (component->GetType().compare("Crowd_Avatar_Component") == 0) {
+    std::vector<Bitmap_Renderable*>::iterator bitmap_renderable;
+    for (bitmap_renderable = m_renderables.Avatars.begin(); bitmap_renderable != m_renderables.Avatars.end(); bitmap_renderable++) {
+      if ((*bitmap_renderable)->bitmap->GetID() == component->GetID()) {
+        delete (*bitmap_renderable);
+        m_renderables.Avatars.erase(bitmap_renderable);
+        return;
+      }
+    }
+    throw Exceptions::run_error("View Could not find Crowd Avatar Renderable to Delete!");
   }
 }
 
@@ -904,6 +994,9 @@ void Direct3D11_View::Init_D3D11() {
   // Initialize the world matrix to the identity matrix.
   D3DXMatrixIdentity(&m_world);
 
+  // The HUD is drawn as if the camera were at the origin.
+  D3DXMatrixIdentity(&m_hud_view);
+
   // Create an orthographic projection matrix for 2D rendering.
   D3DXMatrixOrthoLH(&m_ortho,
                     static_cast<float>(m_game_settings->GetResolution().x),
@@ -969,20 +1062,38 @@ void Direct3D11_View::Init_D3D11() {
     throw Exceptions::init_error("CreateBlendState Failed!");
   }
 
+  // Bitmap textures are read and decoded on the pump's threads, only
+  // creating them on the device is left to the main thread
+  if (FAILED(D3DX11CreateThreadPump(0, 0, &m_texture_pump))) {
+    throw Exceptions::init_error("D3DX11CreateThreadPump Failed!");
+  }
+  QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&m_frequency));
+
   m_is_d3d11_init = true;
 }
 
 //------------------------------------------------------------------------------
-void Direct3D11_View::Render_Bitmaps(std::vector<Direct3D11_View::Bitmap_Renderable*> renderables, D3DXMATRIX *viewmatrix) {
+void Direct3D11_View::Render_Bitmaps(std::vector<Direct3D11_View::Bitmap_Renderable*> const &renderables, D3DXMATRIX *viewmatrix, Bitmap_Pass pass) {
   std::vector<Bitmap_Renderable*>::size_type layer_size = renderables.size();
   for (unsigned int i = 0; i < layer_size; i++) {
+    // A bitmap whose buffers would go over this frame's upload budget isn't
+    // drawn until a later frame has room to create them
+    bool is_uploading = (renderables[i]->frame->vertex_buffer == 0 ||
+                         renderables[i]->frame->index_buffer == 0);
+    if (is_uploading && m_upload_time_ms >= m_upload_time_budget_ms) {
+      continue;
+    }
+    INT64 upload_start_time = 0;
+    if (is_uploading) {
+      QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&upload_start_time));
+    }
     if (renderables[i]->frame->vertex_buffer == 0) {
       D3D11_BUFFER_DESC vertexBufferDesc;
       D3D11_SUBRESOURCE_DATA vertexData;
 
       // Set up the description of the static vertex buffer.
       vertexBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-      vertexBufferDesc.ByteWidth = sizeof(Frame_Component::Vertex_Type) * renderables[i]->frame->vertex_count;
+      vertexBufferDesc.ByteWidth = sizeof(Frame_Component::Vertex_Type) * Get_Vertex_Capacity(renderables[i]->frame);
       vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
       vertexBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
       vertexBufferDesc.MiscFlags = 0;
@@ -999,6 +1110,9 @@ void Direct3D11_View::Render_Bitmaps(std::vector<Direct3D11_View::Bitmap_Rendera
                                         &(renderables[i]->frame->vertex_buffer)))) {
         throw Exceptions::init_error("CreateBuffer (vertex_buffer) Failed!");
       }
+      renderables[i]->frame->is_dirty = false;
+    } else if (renderables[i]->frame->is_dirty) {
+      Update_Vertex_Buffer(renderables[i]->frame);
     }
     if (renderables[i]->frame->index_buffer == 0) {
       D3D11_BUFFER_DESC indexBufferDesc;
@@ -1006,7 +1120,7 @@ void Direct3D11_View::Render_Bitmaps(std::vector<Direct3D11_View::Bitmap_Rendera
 
       // Set up the description of the static index buffer.
       indexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-      indexBufferDesc.ByteWidth = sizeof(unsigned int) * renderables[i]->frame->index_count;
+      indexBufferDesc.ByteWidth = sizeof(unsigned int) * Get_Vertex_Capacity(renderables[i]->frame);
       indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
       indexBufferDesc.CPUAccessFlags = 0;
       indexBufferDesc.MiscFlags = 0;
@@ -1024,23 +1138,17 @@ void Direct3D11_View::Render_Bitmaps(std::vector<Direct3D11_View::Bitmap_Rendera
         throw Exceptions::init_error("CreateBuffer (index_buffer) Failed!");
       }
     }
-    if (renderables[i]->texture->texture == 0) { 
-      std::map<std::wstring, ID3D11ShaderResourceView*>::iterator stored_texture;
-      stored_texture = m_texture_map.find(renderables[i]->texture->texture_path);
-      if (stored_texture == m_texture_map.end()) {
-        ID3D11ShaderResourceView* texture;
-        if (FAILED(D3DX11CreateShaderResourceViewFromFile(m_device,
-                                                          renderables[i]->texture->texture_path.c_str(),
-                                                          NULL,
-                                                          NULL,
-                                                          &texture,
-                                                          NULL)))  {
-          throw Exceptions::init_error("Loading font file failed!");
-        }
-        m_texture_map[renderables[i]->texture->texture_path] = texture;
-        renderables[i]->texture->texture = texture;
-      } else {
-        renderables[i]->texture->texture = (*stored_texture).second;
+    if (is_uploading) {
+      m_upload_time_ms += Get_Milliseconds_Since(upload_start_time);
+    }
+    if (renderables[i]->texture->texture == 0) {
+      if (!Find_Texture(renderables[i]->texture->texture_path, &(renderables[i]->texture->texture))) {
+        continue;
+      }
+    }
+    if (pass != ALL_BITMAPS) {
+      if ((pass == OPAQUE_BITMAPS) != IsThisBitmapComponentOpaque(renderables[i])) {
+        continue;
       }
     }
     if (IsThisBitmapComponentVisable(renderables[i])) {
@@ -1059,7 +1167,7 @@ void Direct3D11_View::Render_Texts(std::vector<Direct3D11_View::Text_Renderable*
 
       // Set up the description of the static vertex buffer.
       vertexBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-      vertexBufferDesc.ByteWidth = sizeof(Text_Component::Vertex_Type) * renderables[i]->frame->vertex_count;
+      vertexBufferDesc.ByteWidth = sizeof(Text_Component::Vertex_Type) * Get_Vertex_Capacity(renderables[i]->frame);
       vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
       vertexBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
       vertexBufferDesc.MiscFlags = 0;
@@ -1077,13 +1185,16 @@ void Direct3D11_View::Render_Texts(std::vector<Direct3D11_View::Text_Renderable*
                                         &(renderables[i]->frame->vertex_buffer)))) {
         throw Exceptions::init_error("CreateBuffer (vertex_buffer) Failed!");
       }
+      renderables[i]->frame->is_dirty = false;
+    } else if (renderables[i]->frame->is_dirty) {
+      Update_Vertex_Buffer(renderables[i]->frame);
     }
     if (renderables[i]->frame->index_buffer == 0) {
       D3D11_BUFFER_DESC indexBufferDesc;
       D3D11_SUBRESOURCE_DATA indexData;
       // Set up the description of the static index buffer.
       indexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-      indexBufferDesc.ByteWidth = sizeof(unsigned int) * renderables[i]->frame->index_count;
+      indexBufferDesc.ByteWidth = sizeof(unsigned int) * Get_Vertex_Capacity(renderables[i]->frame);
       indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
       indexBufferDesc.CPUAccessFlags = 0;
       indexBufferDesc.MiscFlags = 0;
@@ -1218,7 +1329,8 @@ void Direct3D11_View::Render_Bitmap(Bitmap_Renderable* bitmap,
                            *viewmatrix,
                            m_ortho,
                            bitmap->texture->texture,
-                           bitmap->texture->transparency);
+                           bitmap->texture->transparency,
+                           bitmap->bitmap->GetUVRect());
   } else {
     // Render the model using the color shader.
     m_transparent_shader->Render(m_device_context,
@@ -1227,7 +1339,8 @@ void Direct3D11_View::Render_Bitmap(Bitmap_Renderable* bitmap,
                                  *viewmatrix,
                                  m_ortho,
                                  bitmap->texture->texture,
-                                 bitmap->texture->transparency);
+                                 bitmap->texture->transparency,
+                                 bitmap->bitmap->GetUVRect());
   }
 }
 
@@ -1285,7 +1398,7 @@ void Direct3D11_View::Render_Text(Text_Renderable *text,
   m_device_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
   // Create a pixel color vector with the input sentence color.
-  pixelColor = text->font->font_color;
+  pixelColor = text->text->GetFontColor();
 
   // Render the text using the font shader.
   m_font_shader->Render(m_device_context,
@@ -1298,6 +1411,106 @@ void Direct3D11_View::Render_Text(Text_Renderable *text,
                         text->texture->transparency);
 }
 
+//------------------------------------------------------------------------------
+int Direct3D11_View::Get_Vertex_Capacity(Frame_Component::Frame *frame) {
+  if (frame->vertex_capacity > frame->vertex_count) {
+    return frame->vertex_capacity;
+  }
+  return frame->vertex_count;
+}
+
+//------------------------------------------------------------------------------
+void Direct3D11_View::Update_Vertex_Buffer(Frame_Component::Frame *frame) {
+  D3D11_MAPPED_SUBRESOURCE mapped_resource;
+
+  // Discard the old contents so the GPU never waits on the buffer.
+  if (FAILED(m_device_context->Map(frame->vertex_buffer,
+                                   0,
+                                   D3D11_MAP_WRITE_DISCARD,
+                                   0,
+                                   &mapped_resource))) {
+    throw Exceptions::run_error("Map (vertex_buffer) Failed!");
+  }
+
+  memcpy(mapped_resource.pData,
+         frame->vertices,
+         sizeof(Frame_Component::Vertex_Type) * frame->vertex_count);
+
+  m_device_context->Unmap(frame->vertex_buffer, 0);
+
+  frame->is_dirty = false;
+}
+
+//------------------------------------------------------------------------------
+bool Direct3D11_View::Find_Texture(std::wstring const &texture_path, ID3D11ShaderResourceView **out_texture) {
+  std::map<std::wstring, ID3D11ShaderResourceView*>::iterator stored_texture;
+  stored_texture = m_texture_map.find(texture_path);
+  if (stored_texture != m_texture_map.end()) {
+    *out_texture = (*stored_texture).second;
+    return true;
+  }
+
+  if (m_pending_textures.find(texture_path) == m_pending_textures.end()) {
+    Pending_Texture &pending_texture = m_pending_textures[texture_path];
+    pending_texture.texture = 0;
+    pending_texture.result = S_OK;
+    if (FAILED(D3DX11CreateShaderResourceViewFromFile(m_device,
+                                                      texture_path.c_str(),
+                                                      NULL,
+                                                      m_texture_pump,
+                                                      &(pending_texture.texture),
+                                                      &(pending_texture.result)))) {
+      throw Exceptions::init_error("Loading texture file failed!");
+    }
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+void Direct3D11_View::Process_Texture_Uploads() {
+  INT64 start_time;
+  QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&start_time));
+
+  UINT io_queue = 0;
+  UINT process_queue = 0;
+  UINT device_queue = 0;
+  m_texture_pump->GetQueueStatus(&io_queue, &process_queue, &device_queue);
+  while (device_queue != 0 && Get_Milliseconds_Since(start_time) < m_upload_time_budget_ms) {
+    if (FAILED(m_texture_pump->ProcessDeviceWorkItems(1))) {
+      throw Exceptions::init_error("ProcessDeviceWorkItems Failed!");
+    }
+    m_texture_pump->GetQueueStatus(&io_queue, &process_queue, &device_queue);
+  }
+
+  std::map<std::wstring, Pending_Texture>::iterator pending_texture = m_pending_textures.begin();
+  while (pending_texture != m_pending_textures.end()) {
+    if (FAILED(pending_texture->second.result)) {
+      throw Exceptions::init_error("Loading texture file failed!");
+    }
+    if (pending_texture->second.texture == 0) {
+      pending_texture++;
+      continue;
+    }
+    // A text may have loaded the same file itself in the meantime
+    if (m_texture_map.find(pending_texture->first) == m_texture_map.end()) {
+      m_texture_map[pending_texture->first] = pending_texture->second.texture;
+    } else {
+      pending_texture->second.texture->Release();
+    }
+    pending_texture = m_pending_textures.erase(pending_texture);
+  }
+
+  m_upload_time_ms = Get_Milliseconds_Since(start_time);
+}
+
+//------------------------------------------------------------------------------
+float Direct3D11_View::Get_Milliseconds_Since(INT64 start_time) {
+  INT64 current_time;
+  QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&current_time));
+  return static_cast<float>(current_time - start_time) * 1000.0f / static_cast<float>(m_frequency);
+}
+
+//------------------------------------------------------------------------------
 void Direct3D11_View::TurnOnAlphaBlending() {
   float blendFactor[4];
 
@@ -1403,4 +1616,13 @@ bool Direct3D11_View::IsThisBitmapComponentVisable(Bitmap_Renderable *bitmap) {
   */
 }
 
+//------------------------------------------------------------------------------
+bool Direct3D11_View::IsThisBitmapComponentOpaque(Bitmap_Renderable *bitmap) {
+  if (bitmap->texture->transparency != 1.0f) {
+    return false;
+  }
+
+  return bitmap->bitmap->IsOpaque();
+}
+
 }  // namespace Tunnelour
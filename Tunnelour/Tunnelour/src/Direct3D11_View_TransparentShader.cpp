@@ -286,7 +286,8 @@ void Direct3D11_View_TransparentShader::Render(ID3D11DeviceContext* devicecontex
                                                D3DXMATRIX view,
                                                D3DXMATRIX projection,
                                                ID3D11ShaderResourceView* texture,
-                                               float blend) {
+                                               float blend,
+                                               D3DXVECTOR4 uv_rect) {
   // Set the shader parameters that it will use for rendering.
   D3D11_MAPPED_SUBRESOURCE mappedresource;
   MatrixBufferType* dataptr;
@@ -314,6 +315,7 @@ void Direct3D11_View_TransparentShader::Render(ID3D11DeviceContext* devicecontex
   dataptr->world = world;
   dataptr->view = view;
   dataptr->projection = projection;
+  dataptr->uv_rect = uv_rect;
 
   // Unlock the constant buffer.
   devicecontext->Unmap(m_matrixbuffer, 0);
@@ -0,0 +1,299 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Font_Cache.h"
+#include <stdio.h>
+#include "Exceptions.h"
+#include "String_Helper.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Font_Cache::~Font_Cache() {
+  std::map<std::string, Font*>::iterator font;
+  for (font = m_fonts.begin(); font != m_fonts.end(); font++) {
+    delete font->second;
+    font->second = 0;
+  }
+  m_fonts.clear();
+}
+
+//------------------------------------------------------------------------------
+Font_Cache* Font_Cache::GetInstance() {
+  if (m_instance == 0) {
+    m_instance = new Font_Cache();
+  }
+  return m_instance;
+}
+
+//------------------------------------------------------------------------------
+Font_Cache::Font const * Font_Cache::GetFont(std::string const &font_file) {
+  std::map<std::string, Font*>::iterator found_font = m_fonts.find(font_file);
+  if (found_font != m_fonts.end()) {
+    return found_font->second;
+  }
+
+  Font *font = new Font();
+  font->image_width = 0;
+  font->image_height = 0;
+  font->line_height = 0;
+  try {
+    Load_Font_Struct(font_file, font);
+  } catch (...) {
+    delete font;
+    throw;
+  }
+  Load_Character_Frames(font);
+
+  m_fonts[font_file] = font;
+  return font;
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+Font_Cache::Font_Cache() {
+}
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void Font_Cache::Load_Font_Struct(std::string const &font_file, Font *out_font) {
+  FILE * pFile;
+  int lSize;
+
+  // Open Font File as a text file
+  if (fopen_s(&pFile, font_file.c_str(), "r") != 0) {
+    throw Tunnelour::Exceptions::init_error("Open font CSV file Failed!");
+  }
+
+  // obtain file size:
+  fseek(pFile , 0 , SEEK_END);
+  lSize = ftell(pFile);
+  rewind(pFile);
+
+  char * token;
+  char * next_token;
+
+  // Get the first line
+  // Example line: "info face="Ariel" size=32 bold=0 italic=0 charset="" unicode=1 stretchH=100 smooth=1 aa=2 padding=0,0,0,0 spacing=1,1 outline=0"
+  char line[225];
+  fgets(line, 225, pFile);
+  if (line != NULL) {
+  token = strtok_s(line, " ", &next_token);
+  if (strcmp(token, "info") == 0) {
+      while (token != NULL) {
+        if (strcmp(token, "face") == 0) {
+            token = strtok_s(NULL, " =\"", &next_token);
+            out_font->font_name = token;
+        }
+        token = strtok_s(NULL, " =\"", &next_token);
+      }
+    }
+  } else {
+    throw Tunnelour::Exceptions::init_error("Unexpected end of file!");
+  }
+
+  // Get the second line
+  // Example line: "common lineHeight=32 base=26 scaleW=512 scaleH=512 pages=1 packed=0 alphaChnl=1 redChnl=0 greenChnl=0 blueChnl=0"
+  fgets(line, 225, pFile);
+  if (line != NULL) {
+    token = strtok_s(line, " ", &next_token);
+    if (strcmp(token, "common") == 0) {
+      while (token != NULL) {
+        if (strcmp(token, "lineHeight") == 0) {
+            token = strtok_s(NULL, " =\"", &next_token);
+            out_font->line_height = atof(token);
+        }
+        if (strcmp(token, "scaleW") == 0) {
+            token = strtok_s(NULL, " =\"", &next_token);
+            out_font->image_width = atoi(token);
+        }
+        if (strcmp(token, "scaleH") == 0) {
+            token = strtok_s(NULL, " =\"", &next_token);
+            out_font->image_height = atoi(token);
+        }
+        token = strtok_s(NULL, " =\"", &next_token);
+      }
+    }
+  } else {
+    throw Tunnelour::Exceptions::init_error("Unexpected end of file!");
+  }
+
+  // Get the Third Line
+  // Example line: "page id=0 file="Arial_0.dds""
+  fgets(line, 225, pFile);
+  if (line != NULL) {
+    token = strtok_s(line, " ", &next_token);
+    if (strcmp(token, "page") == 0) {
+        while (token != NULL) {
+        if (strcmp(token, "file") == 0) {
+            token = strtok_s(NULL, " =\"", &next_token);
+            out_font->font_texture_name = String_Helper::CharToWChar(token);
+        }
+        token = strtok_s(NULL, " =\"", &next_token);
+        }
+    }
+  } else {
+    throw Tunnelour::Exceptions::init_error("Unexpected end of file!");
+  }
+
+  // Get the fourth line
+  // Example line: chars count=95
+  fgets(line, 225, pFile);
+  int number_of_chars = 0;
+  if (line != NULL) {
+    token = strtok_s(line, " ", &next_token);
+    if (strcmp(token, "chars") == 0) {
+        while (token != NULL) {
+        if (strcmp(token, "count") == 0) {
+            token = strtok_s(NULL, " =\"", &next_token);
+            number_of_chars = atoi(token);
+        }
+        token = strtok_s(NULL, " =\"", &next_token);
+        }
+    }
+  } else {
+    throw Tunnelour::Exceptions::init_error("Unexpected end of file!");
+  }
+
+  // Get all character lines
+  // Example line: char id=32   x=88    y=25    width=1     height=1     xoffset=0     yoffset=0     xadvance=7     page=0  chnl=15
+  for (int line_count = 0; line_count <= number_of_chars; line_count++) {
+    fgets(line, 225, pFile);
+    if (line != NULL) {
+      token = strtok_s(line, " ", &next_token);
+      if (strcmp(token, "char") == 0) {
+        int id = 0;
+         while (token != NULL) {
+          if (strcmp(token, "id") == 0) {
+              token = strtok_s(NULL, " =\"", &next_token);
+              id = atoi(token);
+              out_font->raw_char_frames[id].id = id;
+          }
+          if (strcmp(token, "x") == 0) {
+              token = strtok_s(NULL, " =\"", &next_token);
+              out_font->raw_char_frames[id].x = atoi(token);
+          }
+          if (strcmp(token, "y") == 0) {
+              token = strtok_s(NULL, " =\"", &next_token);
+              out_font->raw_char_frames[id].y = atoi(token);
+          }
+          if (strcmp(token, "width") == 0) {
+              token = strtok_s(NULL, " =\"", &next_token);
+              out_font->raw_char_frames[id].width = atoi(token);
+          }
+          if (strcmp(token, "height") == 0) {
+              token = strtok_s(NULL, " =\"", &next_token);
+              out_font->raw_char_frames[id].height = atoi(token);
+          }
+          if (strcmp(token, "xoffset") == 0) {
+              token = strtok_s(NULL, " =\"", &next_token);
+              out_font->raw_char_frames[id].xoffset = atoi(token);
+          }
+          if (strcmp(token, "yoffset") == 0) {
+              token = strtok_s(NULL, " =\"", &next_token);
+              out_font->raw_char_frames[id].yoffset = atoi(token);
+          }
+          if (strcmp(token, "xadvance") == 0) {
+              token = strtok_s(NULL, " =\"", &next_token);
+              out_font->raw_char_frames[id].xadvance = atoi(token);
+          }
+          token = strtok_s(NULL, " =\"", &next_token);
+         }
+      }
+
+    } else {
+      throw Tunnelour::Exceptions::init_error("Unexpected end of file!");
+    }
+  }
+
+  fclose(pFile);
+}
+
+//------------------------------------------------------------------------------
+void Font_Cache::Load_Character_Frames(Font *font) {
+  double position_left, position_right, position_top, position_bottom;
+  double texture_left, texture_right, texture_top, texture_bottom;
+
+  // Load the Character Frame Struct Array from the
+  // Raw Character Frame Struct Array
+  for (int index = 0; index < 256; index++) {
+    if (font->raw_char_frames[index].id != -1) {
+      D3DXVECTOR2 size = D3DXVECTOR2(static_cast<float>(font->raw_char_frames[index].width),
+                                     static_cast<float>(font->raw_char_frames[index].height));
+      D3DXVECTOR2 position = D3DXVECTOR2(0, 0);
+
+      // Calculate the screen coordinates of the left side of the bitmap
+      position_left = position.x;
+      texture_left = font->raw_char_frames[index].x / font->image_width;
+
+      // Calculate the screen coordinates of the right side of the bitmap
+      position_right = position.x + size.x;
+      texture_right = (font->raw_char_frames[index].x + size.x) / font->image_width;
+
+      // Calculate the screen coordinates of the top of the bitmap
+      position_top = position.y;
+      texture_top = font->raw_char_frames[index].y / font->image_height;
+
+      // Calculate the screen coordinates of the bottom of the bitmap
+      position_bottom = position.y - size.y;
+      texture_bottom = (font->raw_char_frames[index].y + size.y) / font->image_height;
+
+      // First triangle in quad.
+      // Top left
+      font->character_frames[index][0].position = D3DXVECTOR3(static_cast<float>(position_left),
+                                                               static_cast<float>(position_top),
+                                                               0.0f);
+      font->character_frames[index][0].texture = D3DXVECTOR2(static_cast<float>(texture_left),
+                                                              static_cast<float>(texture_top));
+      // Bottom right
+      font->character_frames[index][1].position = D3DXVECTOR3(static_cast<float>(position_right),
+                                                               static_cast<float>(position_bottom),
+                                                               0.0f);
+      font->character_frames[index][1].texture = D3DXVECTOR2(static_cast<float>(texture_right),
+                                                              static_cast<float>(texture_bottom));
+      // Bottom left
+      font->character_frames[index][2].position = D3DXVECTOR3(static_cast<float>(position_left),
+                                                               static_cast<float>(position_bottom),
+                                                               0.0f);
+      font->character_frames[index][2].texture = D3DXVECTOR2(static_cast<float>(texture_left),
+                                                              static_cast<float>(texture_bottom));
+
+      // Second triangle in quad.
+      // Top left
+      font->character_frames[index][3].position = font->character_frames[index][0].position;
+      font->character_frames[index][3].texture = font->character_frames[index][0].texture;
+      // Top right
+      font->character_frames[index][4].position = D3DXVECTOR3(static_cast<float>(position_right),
+                                                               static_cast<float>(position_top),
+                                                               0.0f);
+      font->character_frames[index][4].texture = D3DXVECTOR2(static_cast<float>(texture_right),
+                                                              static_cast<float>(texture_top));
+      // Bottom right
+      font->character_frames[index][5].position = font->character_frames[index][1].position;
+      font->character_frames[index][5].texture = font->character_frames[index][1].texture;
+    }
+  }
+}
+
+
+
+//------------------------------------------------------------------------------
+Font_Cache* Font_Cache::m_instance = 0;
+
+}  // namespace Tunnelour
@@ -25,6 +25,8 @@ Frame_Component::Frame_Component(): Component() {
   m_frame = new Tunnelour::Frame_Component::Frame();
   m_frame->vertex_buffer = 0;
   m_frame->vertex_count = 0;
+  m_frame->vertex_capacity = 0;
+  m_frame->is_dirty = false;
   m_frame->vertices = 0;
   m_frame->index_buffer = 0;
   m_frame->index_count = 0;
@@ -91,9 +93,27 @@ D3DXVECTOR3 * const Frame_Component::GetPosition() {
   return &m_position;
 }
 
+//---------------------------------------------------------------------------
+Fixed_Point Frame_Component::GetFixedPosition() {
+  return m_fixed_position;
+}
+
+//---------------------------------------------------------------------------
+void Frame_Component::SetFixedPosition(Fixed_Point position) {
+  m_fixed_position = position;
+  m_position = Fixed_Pixel_Helper::ToPixels(m_fixed_position, m_position.z);
+  Notify();
+}
+
+//---------------------------------------------------------------------------
+void Frame_Component::MoveFixedPosition(Fixed_Point offset) {
+  SetFixedPosition(m_fixed_position + offset);
+}
+
 //---------------------------------------------------------------------------
 void Frame_Component::SetLastRenderedPosition(D3DXVECTOR3 position) {
-  m_last_position = position;
+  m_fixed_last_position = Fixed_Pixel_Helper::FromPixels(position);
+  m_last_position = Fixed_Pixel_Helper::ToPixels(m_fixed_last_position, position.z);
 }
 
 //---------------------------------------------------------------------------
@@ -101,15 +121,28 @@ D3DXVECTOR3 const Frame_Component::GetLastRenderedPosition() {
   return m_last_position;
 }
 
+//---------------------------------------------------------------------------
+void Frame_Component::SetPositionRendered() {
+  m_fixed_last_position = m_fixed_position;
+  m_last_position = m_position;
+}
+
+//---------------------------------------------------------------------------
+Fixed_Point Frame_Component::GetLastRenderedFixedPosition() {
+  return m_fixed_last_position;
+}
+
 //---------------------------------------------------------------------------
 void Frame_Component::SetPosition(D3DXVECTOR3 position) {
-  m_position = position;
+  m_fixed_position = Fixed_Pixel_Helper::FromPixels(position);
+  m_position = Fixed_Pixel_Helper::ToPixels(m_fixed_position, Fixed_Pixel_Helper::Snap(position.z));
   Notify();
 }
 
 //---------------------------------------------------------------------------
 void Frame_Component::SetPosition(float x, float y, float z) {
-  m_position = D3DXVECTOR3(x, y, z);
+  m_fixed_position = Fixed_Pixel_Helper::FromPixels(D3DXVECTOR3(x, y, z));
+  m_position = Fixed_Pixel_Helper::ToPixels(m_fixed_position, Fixed_Pixel_Helper::Snap(z));
 }
 
 //---------------------------------------------------------------------------
@@ -26,6 +26,18 @@ Game_Metrics_Component::Game_Metrics_Component(): Component() {
   m_fps_data.startTime = 0;
   m_distance_traveled = 0;
   m_seconds_past = 0.0;
+  m_state_resolution_data.transitions = 0;
+  m_state_resolution_data.resolve_time_ms = 0;
+  m_state_resolution_data.max_transitions = 0;
+  m_state_resolution_data.cut_short_ticks = 0;
+  m_crowd_data.avatars = 0;
+  m_crowd_data.threads = 0;
+  m_crowd_data.update_time_ms = 0;
+  m_crowd_data.avatars_per_ms = 0;
+  m_level_load_data.full_load_time_ms = 0;
+  m_level_load_data.reset_time_ms = 0;
+  m_level_load_data.full_loads = 0;
+  m_level_load_data.resets = 0;
   m_type = "Game_Metrics_Component";
 }
 
@@ -36,6 +48,18 @@ Game_Metrics_Component::~Game_Metrics_Component() {
   m_fps_data.startTime = 0;
   m_distance_traveled = 0;
   m_seconds_past = 0.0;
+  m_state_resolution_data.transitions = 0;
+  m_state_resolution_data.resolve_time_ms = 0;
+  m_state_resolution_data.max_transitions = 0;
+  m_state_resolution_data.cut_short_ticks = 0;
+  m_crowd_data.avatars = 0;
+  m_crowd_data.threads = 0;
+  m_crowd_data.update_time_ms = 0;
+  m_crowd_data.avatars_per_ms = 0;
+  m_level_load_data.full_load_time_ms = 0;
+  m_level_load_data.reset_time_ms = 0;
+  m_level_load_data.full_loads = 0;
+  m_level_load_data.resets = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -45,6 +69,18 @@ void Game_Metrics_Component::Init() {
   m_fps_data.startTime = 0;
   m_distance_traveled = 0;
   m_seconds_past = 0.0;
+  m_state_resolution_data.transitions = 0;
+  m_state_resolution_data.resolve_time_ms = 0;
+  m_state_resolution_data.max_transitions = 0;
+  m_state_resolution_data.cut_short_ticks = 0;
+  m_crowd_data.avatars = 0;
+  m_crowd_data.threads = 0;
+  m_crowd_data.update_time_ms = 0;
+  m_crowd_data.avatars_per_ms = 0;
+  m_level_load_data.full_load_time_ms = 0;
+  m_level_load_data.reset_time_ms = 0;
+  m_level_load_data.full_loads = 0;
+  m_level_load_data.resets = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -77,6 +113,36 @@ void Game_Metrics_Component::SetSecondsPast(long double seconds_past) {
   m_seconds_past = seconds_past;
 }
 
+//------------------------------------------------------------------------------
+Game_Metrics_Component::State_Resolution_Data Game_Metrics_Component::GetStateResolutionData() {
+  return m_state_resolution_data;
+}
+
+//------------------------------------------------------------------------------
+void Game_Metrics_Component::SetStateResolutionData(Game_Metrics_Component::State_Resolution_Data state_resolution_data) {
+  m_state_resolution_data = state_resolution_data;
+}
+
+//------------------------------------------------------------------------------
+Game_Metrics_Component::Crowd_Data Game_Metrics_Component::GetCrowdData() {
+  return m_crowd_data;
+}
+
+//------------------------------------------------------------------------------
+void Game_Metrics_Component::SetCrowdData(Game_Metrics_Component::Crowd_Data crowd_data) {
+  m_crowd_data = crowd_data;
+}
+
+//------------------------------------------------------------------------------
+Game_Metrics_Component::Level_Load_Data Game_Metrics_Component::GetLevelLoadData() {
+  return m_level_load_data;
+}
+
+//------------------------------------------------------------------------------
+void Game_Metrics_Component::SetLevelLoadData(Game_Metrics_Component::Level_Load_Data level_load_data) {
+  m_level_load_data = level_load_data;
+}
+
 //------------------------------------------------------------------------------
 // protected:
 //------------------------------------------------------------------------------
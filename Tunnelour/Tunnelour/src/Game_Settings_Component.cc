@@ -33,6 +33,7 @@ Game_Settings_Component::Game_Settings_Component(): Component() {
   m_hwnd = 0;
   m_is_camera_following = false;
   m_is_using_level_file = false;
+  m_crowd_size = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -54,6 +55,7 @@ void Game_Settings_Component::Init() {
   m_is_debug_mode = false;
   m_is_camera_following = true;
   m_is_using_level_file = false;
+  m_crowd_size = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -181,6 +183,16 @@ bool Game_Settings_Component::IsUsingLevelFile() {
   return m_is_using_level_file;
 }
 
+//------------------------------------------------------------------------------
+unsigned int Game_Settings_Component::GetCrowdSize() {
+  return m_crowd_size;
+}
+
+//------------------------------------------------------------------------------
+void Game_Settings_Component::SetCrowdSize(unsigned int crowd_size) {
+  m_crowd_size = crowd_size;
+}
+
 //------------------------------------------------------------------------------
 // protected:
 //------------------------------------------------------------------------------
@@ -14,6 +14,7 @@
 //
 
 #include "Geometry_Helper.h"
+#include <limits>
 
 namespace Tunnelour {
 
@@ -81,4 +82,85 @@ double Geometry_Helper::WhatsTheDistanceBetweenThesePoints(D3DXVECTOR2 point_1,
     return dist;
 }
 
+//------------------------------------------------------------------------------
+bool Geometry_Helper::DoesThisAABBSweepIntoThatAABB(AABB const &moving, D3DXVECTOR2 displacement, AABB const &target, float *out_time_of_impact, D3DXVECTOR2 *out_contact_normal) {
+  // Boxes which already overlap hit straight away, pushed out of the target
+  // across the side they are least far into. This also covers a box which
+  // is not moving at all.
+  if (moving.right > target.left && moving.left < target.right &&
+      moving.top > target.bottom && moving.bottom < target.top) {
+    Fixed_Pixel left_penetration = moving.right - target.left;
+    Fixed_Pixel right_penetration = target.right - moving.left;
+    Fixed_Pixel bottom_penetration = moving.top - target.bottom;
+    Fixed_Pixel top_penetration = target.top - moving.bottom;
+    Fixed_Pixel x_penetration = (left_penetration < right_penetration) ? left_penetration : right_penetration;
+    Fixed_Pixel y_penetration = (bottom_penetration < top_penetration) ? bottom_penetration : top_penetration;
+
+    *out_time_of_impact = 0.0f;
+    if (x_penetration < y_penetration) {
+      out_contact_normal->x = (left_penetration < right_penetration) ? -1.0f : 1.0f;
+      out_contact_normal->y = 0.0f;
+    } else {
+      out_contact_normal->x = 0.0f;
+      out_contact_normal->y = (bottom_penetration < top_penetration) ? -1.0f : 1.0f;
+    }
+    return true;
+  }
+
+  float infinity = std::numeric_limits<float>::infinity();
+
+  // The times the moving box starts and stops overlapping the target on
+  // each axis, as fractions of the displacement.
+  float x_entry, x_exit;
+  if (displacement.x > 0) {
+    x_entry = Fixed_Pixel_Helper::ToPixels(target.left - moving.right) / displacement.x;
+    x_exit = Fixed_Pixel_Helper::ToPixels(target.right - moving.left) / displacement.x;
+  } else if (displacement.x < 0) {
+    x_entry = Fixed_Pixel_Helper::ToPixels(target.right - moving.left) / displacement.x;
+    x_exit = Fixed_Pixel_Helper::ToPixels(target.left - moving.right) / displacement.x;
+  } else if (moving.right > target.left && moving.left < target.right) {
+    x_entry = -infinity;
+    x_exit = infinity;
+  } else {
+    return false;
+  }
+
+  float y_entry, y_exit;
+  if (displacement.y > 0) {
+    y_entry = Fixed_Pixel_Helper::ToPixels(target.bottom - moving.top) / displacement.y;
+    y_exit = Fixed_Pixel_Helper::ToPixels(target.top - moving.bottom) / displacement.y;
+  } else if (displacement.y < 0) {
+    y_entry = Fixed_Pixel_Helper::ToPixels(target.top - moving.bottom) / displacement.y;
+    y_exit = Fixed_Pixel_Helper::ToPixels(target.bottom - moving.top) / displacement.y;
+  } else if (moving.top > target.bottom && moving.bottom < target.top) {
+    y_entry = -infinity;
+    y_exit = infinity;
+  } else {
+    return false;
+  }
+
+  float entry = x_entry;
+  if (y_entry > entry) { entry = y_entry; }
+  float exit = x_exit;
+  if (y_exit < exit) { exit = y_exit; }
+
+  // The boxes must overlap for a while, starting during this move. They
+  // did not overlap at the start, so an earlier entry is a box which only
+  // touched the target and is sliding along or away from it.
+  if (entry >= exit || entry < 0.0f || entry > 1.0f) {
+    return false;
+  }
+
+  *out_time_of_impact = entry;
+  if (x_entry > y_entry) {
+    out_contact_normal->x = (displacement.x > 0) ? -1.0f : 1.0f;
+    out_contact_normal->y = 0.0f;
+  } else {
+    out_contact_normal->x = 0.0f;
+    out_contact_normal->y = (displacement.y > 0) ? -1.0f : 1.0f;
+  }
+
+  return true;
+}
+
 } // Tunnelour
\ No newline at end of file
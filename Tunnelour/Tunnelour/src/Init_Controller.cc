@@ -16,6 +16,7 @@
 #include "Init_Controller.h"
 #include "Camera_Component.h"
 #include "Game_Settings_Component.h"
+#include "Tile_Class_Index_Component.h"
 #include "World_Settings_Component.h"
 
 namespace Tunnelour {
@@ -48,6 +49,12 @@ bool Init_Controller::Run() {
   world_settings = m_model->Add(new World_Settings_Component());
   world_settings->Init();
 
+  // Added before any tiles so it indexes every one of them
+  Tile_Class_Index_Component *tile_class_index = new Tile_Class_Index_Component();
+  m_model->Add(tile_class_index);
+  tile_class_index->Init();
+  tile_class_index->ObserveModel(m_model);
+
   m_is_finished = true;
   return true;
 }
@@ -264,26 +264,26 @@ void Input_Controller::ProcessInput() {
     Avatar_Component::Avatar_State command;
 
     if (m_keyboardState[DIK_RIGHT] & 0x80)  {
-      command.direction = "Right";
-      command.state = "Running";
+      command.direction = Avatar_Component::RIGHT;
+      command.state = Avatar_Component::RUNNING;
     }
 
     if (m_keyboardState[DIK_LEFT] & 0x80)  {
-      command.direction = "Left";
-      command.state = "Running";
+      command.direction = Avatar_Component::LEFT;
+      command.state = Avatar_Component::RUNNING;
     }
 
     if (m_keyboardState[DIK_DOWN] & 0x80)  {
-      command.direction = "";
-      command.state = "Down";
+      command.direction = Avatar_Component::NO_DIRECTION;
+      command.state = Avatar_Component::DOWN;
     }
 
     if (m_keyboardState[DIK_LSHIFT] & 0x80)  {
-      command.state = "Looking";
+      command.state = Avatar_Component::LOOKING;
     }
 
     if (m_keyboardState[DIK_LMENU] & 0x80)  {
-      command.state = "Jumping";
+      command.state = Avatar_Component::JUMPING;
     }
 
     #ifdef _DEBUG
@@ -344,6 +344,12 @@ void Input_Controller::ProcessInput() {
     key_input.IsUp = false;
   }
 
+  if (m_keyboardState[DIK_BACK] & 0x80)  {
+    key_input.IsBackspace = true;
+  } else {
+    key_input.IsBackspace = false;
+  }
+
   m_input_component->SetCurrentKeyInput(key_input);
 
   return;
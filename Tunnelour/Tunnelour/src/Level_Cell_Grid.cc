@@ -0,0 +1,256 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Level_Cell_Grid.h"
+#include <math.h>
+#include "Tile_Bitmap.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Level_Cell_Grid::Level_Cell_Grid() {
+  m_cell_size = 128;
+  m_rows = 0;
+  m_columns = 0;
+}
+
+//------------------------------------------------------------------------------
+Level_Cell_Grid::~Level_Cell_Grid() {
+}
+
+//------------------------------------------------------------------------------
+void Level_Cell_Grid::Build(Level_Component::Level_Metadata const &level_metadata) {
+  m_tiles.clear();
+  m_cells.clear();
+  m_rows = 0;
+  m_columns = 0;
+  m_cell_size = GetSmallestTileSize(level_metadata);
+
+  std::vector<std::vector<Level_Component::Tile_Metadata>>::const_iterator line;
+  float offset_y = 0.0f;
+  for (line = level_metadata.level.begin(); line != level_metadata.level.end(); line++) {
+    std::vector<Level_Component::Tile_Metadata>::const_iterator tile;
+    float current_block_x = 0.0f;
+    float current_block_y = 0.0f;
+    float offset_x = 0.0f;
+    for (tile = line->begin(); tile != line->end(); tile++) {
+      float left = offset_x + current_block_x;
+      float top = offset_y + current_block_y;
+
+      Tile_Placement placement;
+      placement.size = tile->size;
+      placement.position = D3DXVECTOR2(left + (tile->size / 2), -(top + (tile->size / 2)));
+      placement.is_middleground = (tile->type.compare("Middleground") == 0);
+      placement.is_exit = (tile->type.compare("Exit") == 0);
+      placement.row = static_cast<int>(floor(top / m_cell_size));
+      placement.column = static_cast<int>(floor(left / m_cell_size));
+      placement.span = static_cast<int>(floor(tile->size / m_cell_size));
+      if (placement.span < 1) {
+        placement.span = 1;
+      }
+
+      placement.edge_mask = 0;
+      if (tile == line->begin()) {
+        placement.edge_mask |= Tile_Bitmap::LEFT_EDGE;
+      }
+      if (tile == line->end() - 1) {
+        placement.edge_mask |= Tile_Bitmap::RIGHT_EDGE;
+      }
+      if (line == level_metadata.level.begin()) {
+        placement.edge_mask |= Tile_Bitmap::TOP_EDGE;
+      }
+      if (line == level_metadata.level.end() - 1) {
+        placement.edge_mask |= Tile_Bitmap::BOTTOM_EDGE;
+      }
+
+      m_tiles.push_back(placement);
+      if (placement.row + placement.span > m_rows) {
+        m_rows = placement.row + placement.span;
+      }
+      if (placement.column + placement.span > m_columns) {
+        m_columns = placement.column + placement.span;
+      }
+
+      if (tile->size == 128) {
+        offset_x += tile->size;
+      } else {
+        current_block_x += tile->size;
+        if (current_block_x == 128) {
+          current_block_x = 0;
+          current_block_y += tile->size;
+          if (current_block_y == 128) {
+            current_block_y = 0;
+            offset_x += 128;
+          }
+        }
+      }
+    }
+    offset_y += 128;
+  }
+
+  m_cells.assign(static_cast<unsigned int>(m_rows * m_columns), EMPTY);
+  std::vector<Tile_Placement>::iterator placement;
+  for (placement = m_tiles.begin(); placement != m_tiles.end(); placement++) {
+    unsigned char kind = static_cast<unsigned char>(placement->is_middleground ? ROCK : TUNNEL);
+    for (int row = placement->row; row < placement->row + placement->span; row++) {
+      for (int column = placement->column; column < placement->column + placement->span; column++) {
+        if (row >= 0 && column >= 0) {
+          m_cells[(row * m_columns) + column] = kind;
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+unsigned int Level_Cell_Grid::GetTileCount() {
+  return static_cast<unsigned int>(m_tiles.size());
+}
+
+//------------------------------------------------------------------------------
+Level_Cell_Grid::Tile_Placement const & Level_Cell_Grid::GetTilePlacement(unsigned int index) {
+  return m_tiles[index];
+}
+
+//------------------------------------------------------------------------------
+unsigned int Level_Cell_Grid::GetTileClassMask(unsigned int index) {
+  Tile_Placement const &tile = m_tiles[index];
+  unsigned int class_mask = tile.edge_mask;
+
+  Cell_Kind above = GetNeighbourKind(tile, -1, 0);
+  Cell_Kind below = GetNeighbourKind(tile, 1, 0);
+  Cell_Kind left = GetNeighbourKind(tile, 0, -1);
+  Cell_Kind right = GetNeighbourKind(tile, 0, 1);
+  Cell_Kind above_left = GetNeighbourKind(tile, -1, -1);
+  Cell_Kind above_right = GetNeighbourKind(tile, -1, 1);
+  Cell_Kind below_left = GetNeighbourKind(tile, 1, -1);
+  Cell_Kind below_right = GetNeighbourKind(tile, 1, 1);
+  // The first line and the first tile of each line are never floors
+  bool has_left = (tile.column > 0);
+  bool has_above = (tile.row > 0);
+  bool is_floor = false;
+
+  if (tile.is_middleground) {
+    if (has_left && left == TUNNEL) {
+      class_mask |= Tile_Bitmap::RIGHT_WALL;
+    }
+    if (right == TUNNEL) {
+      class_mask |= Tile_Bitmap::LEFT_WALL;
+    }
+    if (has_left && has_above && above == TUNNEL) {
+      class_mask |= Tile_Bitmap::FLOOR;
+      is_floor = true;
+    }
+    if (below == TUNNEL) {
+      class_mask |= Tile_Bitmap::ROOF;
+    }
+
+    // The roof over the tunnel below and to the side stops at this tile
+    if (has_left && left == ROCK && below_left == TUNNEL) {
+      class_mask |= Tile_Bitmap::RIGHT_ROOF_END;
+    }
+    if (right == ROCK && below_right == TUNNEL && below != TUNNEL) {
+      class_mask |= Tile_Bitmap::LEFT_ROOF_END;
+    }
+
+    // The wall below this tile stops at this tile
+    if (has_left && left != TUNNEL && below == ROCK && below_left == TUNNEL) {
+      class_mask |= Tile_Bitmap::TOP_RIGHT_WALL_END;
+    }
+    if (right != TUNNEL && below == ROCK && below_right == TUNNEL) {
+      class_mask |= Tile_Bitmap::TOP_LEFT_WALL_END;
+    }
+
+    // The floor to the left stops at this tile
+    bool is_left_floor = (left == ROCK && tile.column - tile.span > 0 && above_left == TUNNEL);
+    if (has_left && has_above && above != TUNNEL && is_left_floor) {
+      class_mask |= Tile_Bitmap::RIGHT_FLOOR_END;
+      if (above == ROCK) {
+        class_mask |= Tile_Bitmap::BOT_RIGHT_WALL_END;
+      }
+    }
+  } else if (tile.is_exit) {
+    if (has_left && left == ROCK) {
+      class_mask |= Tile_Bitmap::LEFT_EXIT;
+    } else {
+      class_mask |= Tile_Bitmap::RIGHT_EXIT;
+    }
+  }
+
+  // The floor to the right stops at this tile, tunnel tiles are marked too
+  if (has_above && !is_floor && right == ROCK && above_right == TUNNEL) {
+    class_mask |= Tile_Bitmap::LEFT_FLOOR_END;
+    if (above == ROCK) {
+      class_mask |= Tile_Bitmap::BOT_LEFT_WALL_END;
+    }
+  }
+
+  return class_mask;
+}
+
+//------------------------------------------------------------------------------
+Level_Cell_Grid::Cell_Kind Level_Cell_Grid::GetCellKind(int row, int column) {
+  if (row < 0 || row >= m_rows || column < 0 || column >= m_columns) {
+    return EMPTY;
+  }
+  return static_cast<Cell_Kind>(m_cells[(row * m_columns) + column]);
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+Level_Cell_Grid::Cell_Kind Level_Cell_Grid::GetNeighbourKind(Tile_Placement const &tile, int row_offset, int column_offset) {
+  // The cell just outside the tile's top left corner, or its bottom right
+  // corner when looking down or right.
+  int row = tile.row;
+  if (row_offset < 0) {
+    row -= 1;
+  } else if (row_offset > 0) {
+    row += tile.span;
+  }
+  int column = tile.column;
+  if (column_offset < 0) {
+    column -= 1;
+  } else if (column_offset > 0) {
+    column += tile.span;
+  }
+  return GetCellKind(row, column);
+}
+
+//------------------------------------------------------------------------------
+float Level_Cell_Grid::GetSmallestTileSize(Level_Component::Level_Metadata const &level_metadata) {
+  float smallest_size = 0.0f;
+  std::vector<std::vector<Level_Component::Tile_Metadata>>::const_iterator line;
+  for (line = level_metadata.level.begin(); line != level_metadata.level.end(); line++) {
+    std::vector<Level_Component::Tile_Metadata>::const_iterator tile;
+    for (tile = line->begin(); tile != line->end(); tile++) {
+      if (tile->size > 0 && (smallest_size == 0 || tile->size < smallest_size)) {
+        smallest_size = tile->size;
+      }
+    }
+  }
+  if (smallest_size == 0) {
+    return 128;
+  }
+  return smallest_size;
+}
+
+}  // namespace Tunnelour
@@ -14,9 +14,11 @@
 //
 
 #include "Level_Controller.h"
+#include "Avatar_State_Names.h"
 #include "String_Helper.h"
 #include "Exceptions.h"
 #include "Get_Avatar_Mutator.h"
+#include "Get_Game_Metrics_Component_Mutator.h"
 #include "Bitmap_Helper.h"
 #include "Score_Display_Controller.h"
 #include "File_Level_Tile_Controller.h"
@@ -58,6 +60,11 @@ Level_Controller::Level_Controller() : Controller(),
   m_has_splash_screen_faded = false;
 
   m_has_avatar_been_reset = false;
+  m_is_resetting_level = false;
+  m_load_time_ms = 0;
+  m_load_time_budget_ms = 4;
+
+  m_end_conditions_watch.Reset();
 }
 
 //------------------------------------------------------------------------------
@@ -111,6 +118,11 @@ Level_Controller::~Level_Controller() {
   m_has_splash_screen_faded = false;
 
   m_has_avatar_been_reset = false;
+  m_is_resetting_level = false;
+  m_load_time_ms = 0;
+  m_load_time_budget_ms = 4;
+
+  m_end_conditions_watch.Reset();
 }
 
 //------------------------------------------------------------------------------
@@ -229,27 +241,41 @@ bool Level_Controller::Run() {
       }
     } else if (m_level_transition_controller != 0) {
       if (m_level_transition_controller->IsLoading()) {
+        INT64 load_step_start_time = 0;
+        QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&load_step_start_time));
+        bool has_level_loaded = false;
         if (!m_has_transition_been_initalised) {
          if (m_current_level.level_name.compare(m_next_level.level_name) != 0) {
            m_level->SetCurrentLevel(m_next_level);
          }
+          // Restarting the level being played keeps the tiles already built
+          // and only resets what moves
+          m_is_resetting_level = (m_avatar_controller != 0 &&
+                                  m_current_level.level_name.compare(m_next_level.level_name) == 0);
+          m_load_time_ms = 0;
           m_has_transition_been_initalised = true;
         } else if (!m_has_level_been_destroyed) {
-//          if (m_current_level.level_name.compare(m_next_level.level_name) != 0) {
+          if (!m_is_resetting_level) {
             m_level_tile_controller->DestroyLevel();
-//          }
+            // The tilesets are parsed and the level laid out on another
+            // thread while the transition carries on animating
+            m_level_tile_controller->StartLoadingLevel();
+          }
           m_has_level_been_destroyed = true;
         } else if (!m_has_level_been_created) {
-//          if (m_current_level.level_name.compare(m_next_level.level_name) != 0) {
-            m_level_tile_controller->CreateLevel();
-            m_exit_tiles = m_level_tile_controller->GetExitTiles();
-//          }
-          m_has_level_been_created = true;
+          if (m_is_resetting_level || m_level_tile_controller->IsLevelLoaded()) {
+            if (!m_is_resetting_level) {
+              m_level_tile_controller->CreateLevel();
+            }
+            // Made again either way so the avatar starts outside every exit
+            CreateExitVolumes();
+            m_has_level_been_created = true;
+          }
         } else if (!m_has_level_been_added) {
-//          if (m_current_level.level_name.compare(m_next_level.level_name) != 0) {
-            m_level_tile_controller->AddLevelToModel();
-//          }
-          m_has_level_been_added = true;
+          // The tiles are added a frame's budget at a time
+          if (m_is_resetting_level || m_level_tile_controller->AddLevelToModel(m_load_time_budget_ms)) {
+            m_has_level_been_added = true;
+          }
         } else if (!m_has_level_been_shown) {
           //m_level_tile_controller->Run();
           m_level_tile_controller->ShowLevel();
@@ -263,13 +289,25 @@ bool Level_Controller::Run() {
           m_has_level_been_added = false;
           m_has_level_been_shown = false;
           m_level->SetIsComplete(false);
+          m_end_conditions_watch.Reset();
           if (m_avatar_controller == 0) {
             m_avatar_controller = new Tunnelour::Avatar_Controller();
             m_avatar_controller->Init(m_model);
           } else {
-            m_avatar_controller->ResetAvatarToDefaults();
-            m_game_metrics_controller->ResetGameMetrics();
+            ResetDynamicState();
           }
+          has_level_loaded = true;
+        }
+
+        INT64 load_step_end_time = 0;
+        QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&load_step_end_time));
+        INT64 frequency = 0;
+        QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&frequency));
+        if (frequency != 0) {
+          m_load_time_ms += static_cast<float>(load_step_end_time - load_step_start_time) * 1000 / frequency;
+        }
+        if (has_level_loaded) {
+          RecordLevelLoadTime(m_load_time_ms);
         }
       } else {
         if (m_level_tile_controller != 0) {
@@ -285,11 +323,12 @@ bool Level_Controller::Run() {
         delete m_level_transition_controller;
         m_level_transition_controller = 0;
       } else if (m_level_transition_controller->IsFading() && !m_has_avatar_been_reset) {
-        m_avatar_controller->ResetAvatarToDefaults();
-        m_game_metrics_controller->ResetGameMetrics();
+        ResetDynamicState();
         m_has_avatar_been_reset = true;
       }
     } else if (m_avatar_controller != 0) {
+      // Holding backspace plays the avatar backwards through its snapshots
+      m_avatar_controller->SetIsRewinding(m_input_component->GetCurrentKeyInput().IsBackspace);
       m_avatar_controller->Run();
       if (m_avatar == 0) {
         Get_Avatar_Mutator mutator;
@@ -306,7 +345,7 @@ bool Level_Controller::Run() {
             m_screen_wipeout_controller->Init(m_model);
             m_screen_wipeout_controller->Run();
           }
-        } else if (m_level->GetCurrentLevel().end_conditions.size() != 0) {
+        } else if (m_end_conditions_watch.HasChanged(m_avatar)) {
           std::vector<Level_Component::End_Condition*> end_conditions = m_level->GetCurrentLevel().end_conditions;
           std::vector<Level_Component::End_Condition*>::iterator end_condition;
           for (end_condition = end_conditions.begin(); end_condition != end_conditions.end(); end_condition++) {
@@ -317,8 +356,8 @@ bool Level_Controller::Run() {
               if ((*end_condition)->is_and) {
                 if ((*condition)->type.compare("State") == 0) {
                   Level_Component::End_Condition_Avatar_State *state_end_condition = static_cast<Level_Component::End_Condition_Avatar_State*>((*condition));
-                  if ((m_avatar->GetLastRenderedState().state.compare(state_end_condition->avatar_state) == 0 && m_avatar->GetLastRenderedState().direction.compare(state_end_condition->avatar_direction) != 0) || (*condition)->has_been_met == true) {
-                    if (m_avatar->GetLastRenderedState().state.compare(m_avatar->GetState().state) != 0 || m_avatar->GetLastRenderedState().direction.compare(m_avatar->GetState().direction) != 0) {
+                  if ((m_avatar->GetLastRenderedState().state == state_end_condition->avatar_state && m_avatar->GetLastRenderedState().direction != state_end_condition->avatar_direction) || (*condition)->has_been_met == true) {
+                    if (m_avatar->GetLastRenderedState().state != m_avatar->GetState().state || m_avatar->GetLastRenderedState().direction != m_avatar->GetState().direction) {
                       (*condition)->has_been_met = true;
                     } else {
                       is_and = false;
@@ -332,8 +371,8 @@ bool Level_Controller::Run() {
               } else if ((*end_condition)->is_or) {
                 if ((*condition)->type.compare("State") == 0) {
                   Level_Component::End_Condition_Avatar_State *state_end_condition = static_cast<Level_Component::End_Condition_Avatar_State*>((*condition));
-                  if (m_avatar->GetLastRenderedState().state.compare(state_end_condition->avatar_state) == 0) {
-                    if (m_avatar->GetLastRenderedState().direction.compare(state_end_condition->avatar_direction) == 0 || (*condition)->has_been_met == true) {
+                  if (m_avatar->GetLastRenderedState().state == state_end_condition->avatar_state) {
+                    if (m_avatar->GetLastRenderedState().direction == state_end_condition->avatar_direction || (*condition)->has_been_met == true) {
                       (*condition)->has_been_met = true;
                       is_or = true;
                     }
@@ -384,9 +423,10 @@ bool Level_Controller::Run() {
             }
           }
         }
-        std::vector<Tile_Bitmap*>::iterator exit_tile;
-        for (exit_tile = m_exit_tiles.begin(); exit_tile != m_exit_tiles.end(); exit_tile++) {
-          if (Bitmap_Helper::DoTheseTilesIntersect(m_avatar, (*exit_tile))) {
+        std::vector<Trigger_Volumes::Trigger_Event> const &exit_events = m_exit_volumes.Update(Bitmap_Helper::GetAABB(m_avatar));
+        std::vector<Trigger_Volumes::Trigger_Event>::const_iterator exit_event;
+        for (exit_event = exit_events.begin(); exit_event != exit_events.end(); exit_event++) {
+          if (exit_event->is_entering) {
             m_level->SetIsComplete(true);
             m_next_level = GetNamedLevel("QUIT");
             if (m_screen_wipeout_controller == 0) {
@@ -608,7 +648,7 @@ Level_Component::Level_Metadata Level_Controller::LoadLevelMetadataIntoStruct(st
         token = strtok_s(line, " ", &next_token);
         if (strcmp(token, "Level_EndCondition_WhenAvatarState") == 0)   {
           token = strtok_s(NULL, " =\"", &next_token);
-          static_cast<Level_Component::End_Condition_Avatar_State*>(condition)->avatar_state = token;
+          static_cast<Level_Component::End_Condition_Avatar_State*>(condition)->avatar_state = Avatar_State_Names::GetInstance()->GetStateID(token);
         } else {
           throw Tunnelour::Exceptions::init_error("Parse Metadata Failed! (" + metadata_path + ") Expected: Level_EndCondition_WhenAvatarState");
         }
@@ -632,7 +672,7 @@ Level_Component::Level_Metadata Level_Controller::LoadLevelMetadataIntoStruct(st
         token = strtok_s(line, " ", &next_token);
         if (strcmp(token, "Level_EndCondition_WhenAvatarDirection") == 0)   {
           token = strtok_s(NULL, " =\"", &next_token);
-          static_cast<Level_Component::End_Condition_Avatar_State*>(condition)->avatar_direction = token;
+          static_cast<Level_Component::End_Condition_Avatar_State*>(condition)->avatar_direction = Avatar_State_Names::GetDirection(token);
         } else {
           throw Tunnelour::Exceptions::init_error("Parse Metadata Failed! (" + metadata_path + ") Expected: Level_EndCondition_WhenAvatarDirection");
         }
@@ -709,20 +749,6 @@ void Level_Controller::LoadLevelCSVIntoStruct(std::string metadata_path, Level_C
   fclose (pFile);
 }
 
-//---------------------------------------------------------------------------
-Avatar_Component::Avatar_Collision_Block Level_Controller::GetNamedCollisionBlock(std::string id, std::list<Avatar_Component::Avatar_Collision_Block> avatar_collision_blocks) {
-  Avatar_Component::Avatar_Collision_Block found_avatar_collision_block;
-
-  std::list<Avatar_Component::Avatar_Collision_Block>::iterator avatar_collision_block;
-  for (avatar_collision_block = avatar_collision_blocks.begin(); avatar_collision_block != avatar_collision_blocks.end(); avatar_collision_block++) {
-    if (avatar_collision_block->id.compare(id) == 0) {
-      found_avatar_collision_block = (*avatar_collision_block);
-    }
-  }
-
-  return found_avatar_collision_block;
-}
-
 //---------------------------------------------------------------------------
 Level_Component::Level_Metadata Level_Controller::GetNamedLevel(std::string level_name) {
   Level_Component::Level_Metadata found_level;
@@ -741,6 +767,46 @@ Level_Component::Level_Metadata Level_Controller::GetNamedLevel(std::string leve
   return found_level;
 }
 
+//---------------------------------------------------------------------------
+void Level_Controller::CreateExitVolumes() {
+  m_exit_volumes.Clear();
+  std::vector<Tile_Bitmap*> exit_tiles = m_level_tile_controller->GetExitTiles();
+  std::vector<Tile_Bitmap*>::iterator exit_tile;
+  for (exit_tile = exit_tiles.begin(); exit_tile != exit_tiles.end(); exit_tile++) {
+    m_exit_volumes.Add(Bitmap_Helper::GetAABB(*exit_tile));
+  }
+}
+
+//------------------------------------------------------------------------------
+void Level_Controller::ResetDynamicState() {
+  // The metrics are reset first so the avatar's checkpoint has them
+  m_game_metrics_controller->ResetGameMetrics();
+  if (m_is_resetting_level) {
+    m_avatar_controller->RestartFromCheckpoint();
+  } else {
+    m_avatar_controller->ResetAvatarToDefaults();
+  }
+}
+
+//------------------------------------------------------------------------------
+void Level_Controller::RecordLevelLoadTime(float load_time_ms) {
+  Get_Game_Metrics_Component_Mutator mutator;
+  m_model->Apply(&mutator);
+  if (!mutator.WasSuccessful()) {
+    return;
+  }
+  Game_Metrics_Component *game_metrics = mutator.GetGameMetrics();
+  Game_Metrics_Component::Level_Load_Data level_load_data = game_metrics->GetLevelLoadData();
+  if (m_is_resetting_level) {
+    level_load_data.reset_time_ms = load_time_ms;
+    level_load_data.resets++;
+  } else {
+    level_load_data.full_load_time_ms = load_time_ms;
+    level_load_data.full_loads++;
+  }
+  game_metrics->SetLevelLoadData(level_load_data);
+}
+
 //------------------------------------------------------------------------------
 // protected:
 //------------------------------------------------------------------------------
@@ -0,0 +1,111 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include "Level_Loader.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Level_Loader::Level_Loader() {
+  m_is_finished = true;
+  m_is_started = false;
+}
+
+//------------------------------------------------------------------------------
+Level_Loader::~Level_Loader() {
+  Join();
+}
+
+//------------------------------------------------------------------------------
+void Level_Loader::Start(Level_Component::Level_Metadata const &level_metadata, std::vector<std::string> const &tileset_paths) {
+  Clear();
+  m_level_metadata = level_metadata;
+  m_tileset_paths = tileset_paths;
+  m_is_finished = false;
+  m_is_started = true;
+  m_thread = std::thread(&Level_Loader::Load, this);
+}
+
+//------------------------------------------------------------------------------
+bool Level_Loader::IsStarted() {
+  return m_is_started;
+}
+
+//------------------------------------------------------------------------------
+bool Level_Loader::IsFinished() {
+  return m_is_finished;
+}
+
+//------------------------------------------------------------------------------
+Level_Loader::Level_Layout & Level_Loader::Wait() {
+  Join();
+  if (m_error) {
+    std::exception_ptr error = m_error;
+    m_error = std::exception_ptr();
+    m_is_started = false;
+    std::rethrow_exception(error);
+  }
+  return m_layout;
+}
+
+//------------------------------------------------------------------------------
+void Level_Loader::Clear() {
+  Join();
+  m_is_started = false;
+  m_error = std::exception_ptr();
+  m_layout.tilesets.clear();
+  m_layout.class_masks.clear();
+  m_layout.grid = Level_Cell_Grid();
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void Level_Loader::Load() {
+  try {
+    std::vector<std::string>::iterator tileset_path;
+    for (tileset_path = m_tileset_paths.begin(); tileset_path != m_tileset_paths.end(); tileset_path++) {
+      Tileset_Helper::Tileset_Metadata tileset_metadata;
+      Tileset_Helper::LoadTilesetMetadataIntoStruct(*tileset_path, &tileset_metadata);
+      m_layout.tilesets.push_back(tileset_metadata);
+    }
+
+    m_layout.grid.Build(m_level_metadata);
+    m_layout.class_masks.resize(m_layout.grid.GetTileCount());
+    for (unsigned int index = 0; index < m_layout.grid.GetTileCount(); index++) {
+      m_layout.class_masks[index] = m_layout.grid.GetTileClassMask(index);
+    }
+  } catch (...) {
+    // Thrown again on the main thread when the layout is asked for
+    m_error = std::current_exception();
+  }
+  m_is_finished = true;
+}
+
+//------------------------------------------------------------------------------
+void Level_Loader::Join() {
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+}  // namespace Tunnelour
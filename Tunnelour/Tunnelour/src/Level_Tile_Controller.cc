@@ -17,11 +17,12 @@
 #include <math.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <windows.h>
 #include <ctime>
 #include <string>
 #include "Exceptions.h"
 #include "String_Helper.h"
-#include "Bitmap_Helper.h"
+#include "Level_Cell_Grid.h"
 
 namespace Tunnelour {
 
@@ -36,8 +37,7 @@ Level_Tile_Controller::Level_Tile_Controller() : Controller() {
   m_is_debug_mode = false;
   m_debug_metadata_file_path = "";
   m_dirt_metadata_file_path = "";
-  m_blocksize_x = 0;
-  m_blocksize_y = 0;
+  m_tiles_added_to_model = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -50,6 +50,7 @@ Level_Tile_Controller::~Level_Tile_Controller() {
   m_is_debug_mode = false;
   m_debug_metadata_file_path = "";
   m_dirt_metadata_file_path = "";
+  m_tiles_added_to_model = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -141,18 +142,44 @@ bool Level_Tile_Controller::Run() {
   return true;
 }
 
+//------------------------------------------------------------------------------
+void Level_Tile_Controller::StartLoadingLevel() {
+  m_level_loader.Start(m_level->GetCurrentLevel(), GetTilesetPaths());
+}
+
+//------------------------------------------------------------------------------
+bool Level_Tile_Controller::IsLevelLoaded() {
+  return m_level_loader.IsFinished();
+}
+
 //------------------------------------------------------------------------------
 void Level_Tile_Controller::CreateLevel() {
   m_current_level_name = m_level->GetCurrentLevel().level_name;
   m_level_tiles = GenerateTunnelFromMetadata(m_level->GetCurrentLevel());
   SwitchTileset();
+  m_level_loader.Clear();
+  m_tiles_added_to_model = 0;
 }
 
 //------------------------------------------------------------------------------
-void Level_Tile_Controller::AddLevelToModel() {
-  for (std::vector<Tile_Bitmap*>::iterator tile = m_level_tiles.begin(); tile != m_level_tiles.end(); ++tile) {
-    m_model->Add(*tile);
+bool Level_Tile_Controller::AddLevelToModel(float time_budget_ms) {
+  INT64 frequency = 0;
+  QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&frequency));
+  INT64 start_time = 0;
+  QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&start_time));
+
+  // At least one tile is added each time so the level always gets there
+  while (m_tiles_added_to_model < m_level_tiles.size()) {
+    m_model->Add(m_level_tiles[m_tiles_added_to_model]);
+    m_tiles_added_to_model++;
+
+    INT64 current_time = 0;
+    QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&current_time));
+    if (frequency != 0 && static_cast<float>(current_time - start_time) * 1000 / frequency >= time_budget_ms) {
+      break;
+    }
   }
+  return (m_tiles_added_to_model == m_level_tiles.size());
 }
 
 //------------------------------------------------------------------------------
@@ -176,6 +203,7 @@ void Level_Tile_Controller::DestroyLevel() {
     m_model->Remove(*tile);
   }
   m_level_tiles.clear();
+  m_tiles_added_to_model = 0;
   m_middleground_tiles.clear();
   m_background_tiles.clear();
   m_top_edge_tiles.clear();
@@ -208,372 +236,61 @@ void Level_Tile_Controller::HandleEvent(Tunnelour::Component * const component)
 
 //------------------------------------------------------------------------------
 std::vector<Tile_Bitmap*> Level_Tile_Controller::GenerateTunnelFromMetadata(Level_Component::Level_Metadata level_metadata) {
+  if (!m_level_loader.IsStarted()) {
+    m_level_loader.Start(level_metadata, GetTilesetPaths());
+  }
   LoadTilesetMetadata();
 
+  // The level loader laid the whole level out and classified each tile from
+  // the cells around it, only the tiles themselves are made here.
+  Level_Loader::Level_Layout &level_layout = m_level_loader.Wait();
+  Level_Cell_Grid &level_grid = level_layout.grid;
+
   std::vector<Tile_Bitmap*> tiles;
-  std::vector<std::vector<Tile_Bitmap*>> tile_lines;
-  
-  std::vector<std::vector<Level_Component::Tile_Metadata>>::iterator line;
-  unsigned int offset_y = 0;
-  for (line = level_metadata.level.begin(); line != level_metadata.level.end(); line++) {
-    std::vector<Level_Component::Tile_Metadata>::iterator tile;
-    std::vector<Tile_Bitmap*> tile_line;
-    float current_block_x = 0;
-    float current_block_y = 0;
-    float offset_x = 0.0f;
-    for (tile = (*line).begin(); tile != (*line).end(); tile++) {
-      Tile_Bitmap* new_tile = 0;
-      float position_x = 0;
-      float position_y = 0;
-      float position_z = 0;
-      if ((*tile).type.compare("Middleground") == 0) {
-        new_tile = CreateMiddlegroundTile((*tile).size);
-        position_z = -1;
-      } else {
-        new_tile = CreateBackgroundTile((*tile).size);
-        position_z = 0;
-      }
-      if (tile == (*line).begin()) {
-        new_tile->SetIsLeftEdge(true);
-        m_left_edge_tiles.push_back(new_tile);
-      }
-      if (tile == (*line).end() - 1) {
-        new_tile->SetIsRightEdge(true);
-        m_right_edge_tiles.push_back(new_tile);
-      }
-      if (line == level_metadata.level.begin()) {
-        new_tile->SetIsTopEdge(true);
-        m_top_edge_tiles.push_back(new_tile);
-      }
-      if (line == level_metadata.level.end() - 1) {
-        new_tile->SetIsBottomEdge(true);
-        m_bottom_edge_tiles.push_back(new_tile);
-      }
+  tiles.reserve(level_grid.GetTileCount());
+  for (unsigned int index = 0; index < level_grid.GetTileCount(); index++) {
+    Level_Cell_Grid::Tile_Placement const &placement = level_grid.GetTilePlacement(index);
+    Tile_Bitmap* new_tile = 0;
+    float position_z = 0;
+    if (placement.is_middleground) {
+      new_tile = CreateMiddlegroundTile(placement.size);
+      position_z = -1;
+      m_middleground_tiles.push_back(new_tile);
+    } else {
+      new_tile = CreateBackgroundTile(placement.size);
+      position_z = 0;
+      m_background_tiles.push_back(new_tile);
+    }
+    new_tile->SetPosition(D3DXVECTOR3(placement.position.x, placement.position.y, position_z));
+    new_tile->GetTexture()->transparency = 0.0f;
+    new_tile->SetClass(level_layout.class_masks[index], true);
 
-      position_x += ((*tile).size / 2) + offset_x + current_block_x;
-      position_y -= ((*tile).size / 2) + offset_y + current_block_y;
-
-      if ((*tile).size == 128) {
-        offset_x += (*tile).size;
-      } else {
-        current_block_x += (*tile).size;
-        if (current_block_x == 128) {
-          current_block_x = 0;
-          current_block_y += (*tile).size;
-          if (current_block_y == 128) {
-            current_block_y = 0;
-            offset_x += 128;
-          }
-        }
-      }
-      // I'm setting the position here so I can use DoTheseTilesXCollide
-      new_tile->SetPosition(D3DXVECTOR3(position_x, position_y, position_z));
-
-      if ((*tile).type.compare("Middleground") == 0) {
-        m_middleground_tiles.push_back(new_tile);
-        new_tile->GetTexture()->transparency = 0.0f;
-        if (!tile_line.empty()) {
-          if (new_tile->GetSize().x == 128) {
-            if (tile_line.back()->GetPosition()->z == 0) {
-              new_tile->SetIsRightWall(true);
-              m_tunnel_edge_tiles.push_back(new_tile);
-              std::vector<Tile_Bitmap*>::iterator above_tile;
-              for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
-                if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                  if ((*above_tile)->GetPosition()->z != 0) {
-                    if (!(*above_tile)->IsRightWall()) {
-                      (*above_tile)->SetIsTopRightWallEnd(true);
-                      if ((*std::prev(above_tile))->IsRoof()) {
-                        (*above_tile)->SetIsRightRoofEnd(true);
-                      }
-                      if (std::next(above_tile) != tile_lines.back().end()) {
-                        if ((*std::next(above_tile))->IsRoof()) {
-                          (*above_tile)->SetIsRightRoofEnd(true);
-                        }
-                      }
-                    }
-                  }
-                }
-              }
-            }
-            if (!tile_lines.empty()) {
-              std::vector<Tile_Bitmap*>::iterator above_tile;
-              for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
-                if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                  if ((*above_tile)->GetPosition()->z == 0) {
-                    new_tile->SetIsFloor(true);
-                    m_tunnel_edge_tiles.push_back(new_tile);
-                    if (!tile_line.back()->IsFloor()) {
-                      tile_line.back()->SetIsLeftFloorEnd(true);
-                      std::vector<Tile_Bitmap*>::iterator above_tile;
-                      for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
-                        if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), tile_line.back()) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), tile_line.back())) {
-                          if ((*above_tile)->GetPosition()->z != 0) {
-                            if ((*above_tile)->IsLeftWall()) {
-                              tile_line.back()->SetIsBotLeftWallEnd(true);
-                            }
-                          }
-                        }
-                      }
-                    }
-                  }
-                }
-              }
-              if (!new_tile->IsFloor() && tile_line.back()->IsFloor()) {
-                new_tile->SetIsRightFloorEnd(true);
-                std::vector<Tile_Bitmap*>::iterator above_tile;
-                for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
-                  if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                    if ((*above_tile)->GetPosition()->z != 0) {
-                      if ((*above_tile)->IsRightWall()) {
-                        new_tile->SetIsBotRightWallEnd(true);
-                      }
-                    }
-                  }
-                }
-              }
-            }
-          } else {
-            if (m_blocksize_y == 0 && m_blocksize_x == 0) {
-              m_back_block = tile_line.back();
-            }
-            if (m_blocksize_y == 0) {
-              if (tile_line.back()->GetPosition()->z == 0) {
-                new_tile->SetIsRightWall(true);
-                m_tunnel_edge_tiles.push_back(new_tile);
-              }
-              if (!tile_lines.empty()) {
-                std::vector<Tile_Bitmap*>::iterator above_tile;
-                for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
-                  if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                    if ((*above_tile)->GetPosition()->z == 0) {
-                      new_tile->SetIsFloor(true);
-                      m_tunnel_edge_tiles.push_back(new_tile);
-                    }
-                  }
-                }
-              }
-              m_block_tile_line.push_back(new_tile);
-            } else {
-              if (m_blocksize_x == 0) {
-                if (m_back_block->GetPosition()->z == 0) {
-                  new_tile->SetIsRightWall(true);
-                  m_tunnel_edge_tiles.push_back(new_tile);
-                }
-                if (!m_block_tile_lines.empty()) {
-                  std::vector<Tile_Bitmap*>::iterator above_tile;
-                  for (above_tile = m_block_tile_lines.back().begin(); above_tile != m_block_tile_lines.back().end(); above_tile++) {
-                    if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                      if ((*above_tile)->GetPosition()->z == 0) {
-                        new_tile->SetIsFloor(true);
-                        m_tunnel_edge_tiles.push_back(new_tile);
-                      }
-                    }
-                  }
-                }
-                m_block_tile_line.push_back(new_tile);
-              } else {
-                if (m_block_tile_line.back()->GetPosition()->z == 0) {
-                  new_tile->SetIsRightWall(true);
-                  m_tunnel_edge_tiles.push_back(new_tile);
-                }
-                if (!m_block_tile_lines.empty()) {
-                  std::vector<Tile_Bitmap*>::iterator above_tile;
-                  for (above_tile = m_block_tile_lines.back().begin(); above_tile != m_block_tile_lines.back().end(); above_tile++) {
-                    if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                      if ((*above_tile)->GetPosition()->z == 0) {
-                        new_tile->SetIsFloor(true);
-                        m_tunnel_edge_tiles.push_back(new_tile);
-                      }
-                    }
-                  }
-                }
-                m_block_tile_line.push_back(new_tile);
-              }
-            }
-            
-            m_blocksize_x += new_tile->GetSize().x;
-
-            if (m_blocksize_x == 128 && m_blocksize_y + new_tile->GetSize().y == 128) {
-              m_blocksize_x = 0;
-              m_blocksize_y = 0;
-              m_block_tile_lines.clear();
-              m_block_tile_line.clear();
-              m_back_block = 0;
-            } else if (m_blocksize_x == 128) {
-              m_blocksize_x = 0;
-              m_blocksize_y += new_tile->GetSize().y;
-              m_block_tile_lines.push_back(m_block_tile_line);
-              m_block_tile_line.clear();
-            }
-          }
-        }
-      } else { // TUNNEL
-        m_background_tiles.push_back(new_tile);
-        new_tile->GetTexture()->transparency = 0.0f; //TUNNEL
-        if (new_tile->GetSize().x == 128) {
-          if (tile_line.back()->GetPosition()->z != 0) {
-            tile_line.back()->SetIsLeftWall(true);
-            m_tunnel_edge_tiles.push_back(tile_line.back());
-            if (!tile_lines.empty()) {
-              std::vector<Tile_Bitmap*>::iterator above_tile;
-              for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
-                if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), tile_line.back()) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), tile_line.back())) {
-                  if ((*above_tile)->GetPosition()->z != 0) {
-                    if (!(*above_tile)->IsLeftWall()) {
-                      (*above_tile)->SetIsTopLeftWallEnd(true);
-                    }
-                  }
-                }
-              }
-            }
-          }
-          if (!tile_lines.empty()) {
-            std::vector<Tile_Bitmap*>::iterator above_tile;
-            for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
-              if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                if ((*above_tile)->GetPosition()->z != 0) {
-                  (*above_tile)->SetIsRoof(true);
-                  m_tunnel_edge_tiles.push_back((*above_tile));
-                  if ((*std::prev(above_tile))->GetPosition()->z != 0 && !(*std::prev(above_tile))->IsRoof() ) {
-                    (*std::prev(above_tile))->SetIsLeftRoofEnd(true);
-                  }
-                  if (std::next(above_tile) != tile_lines.back().end()) {
-                    if ((*std::next(above_tile))->GetPosition()->z != 0 && !(*std::next(above_tile))->IsRoof() ) {
-                      (*std::next(above_tile))->SetIsRightRoofEnd(true);
-                    }
-                  }
-                }
-              }
-            }
-          }
-        } else {
-            if (m_blocksize_y == 0 && m_blocksize_x == 0) {
-              m_back_block = tile_line.back();
-            }
-            if (m_blocksize_y == 0) {
-              if (tile_line.back()->GetPosition()->z != 0) {
-                tile_line.back()->SetIsLeftWall(true);
-                m_tunnel_edge_tiles.push_back(tile_line.back());
-                if (!tile_line.empty()) {
-                  std::vector<Tile_Bitmap*>::iterator above_tile;
-                  for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
-                    if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), tile_line.back()) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), tile_line.back())) {
-                      if ((*above_tile)->GetPosition()->z != 0) {
-                        if (!(*above_tile)->IsLeftWall()) {
-                          (*above_tile)->SetIsTopLeftWallEnd(true);
-                        }
-                      }
-                    }
-                  }
-                }
-              }
-              if (!tile_lines.empty()) {
-                std::vector<Tile_Bitmap*>::iterator above_tile;
-                for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
-                  if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                    if ((*above_tile)->GetPosition()->z != 0) {
-                      (*above_tile)->SetIsRoof(true);
-                      m_tunnel_edge_tiles.push_back((*above_tile));
-                    }
-                  }
-                }
-              }
-              m_block_tile_line.push_back(new_tile);
-            } else {
-              if (m_blocksize_x == 0) {
-                if (m_back_block->GetPosition()->z != 0) {
-                  m_back_block->SetIsLeftWall(true);
-                  m_tunnel_edge_tiles.push_back(tile_line.back());
-                  std::vector<Tile_Bitmap*>::iterator above_tile;
-                  for (above_tile = m_block_tile_lines.back().begin(); above_tile != m_block_tile_lines.back().end(); above_tile++) {
-                    if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                      if ((*above_tile)->GetPosition()->z != 0) {
-                        if (!(*above_tile)->IsLeftWall()) {
-                          (*above_tile)->SetIsTopLeftWallEnd(true);
-                        }
-                      }
-                    }
-                  }
-                }
-                if (!tile_lines.empty()) {
-                  std::vector<Tile_Bitmap*>::iterator above_tile;
-                  for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
-                    if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                      if ((*above_tile)->GetPosition()->z != 0) {
-                        (*above_tile)->SetIsRoof(true);
-                        m_tunnel_edge_tiles.push_back((*above_tile));
-                      }
-                    }
-                  }
-                }
-                m_block_tile_line.push_back(new_tile);
-              } else {
-                if (m_back_block->GetPosition()->z != 0) {
-                  m_back_block->SetIsLeftWall(true);
-                  m_tunnel_edge_tiles.push_back(tile_line.back());
-                  std::vector<Tile_Bitmap*>::iterator above_tile;
-                  for (above_tile = m_block_tile_lines.back().begin(); above_tile != m_block_tile_lines.back().end(); above_tile++) {
-                    if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                      if ((*above_tile)->GetPosition()->z != 0) {
-                        if (!(*above_tile)->IsLeftWall()) {
-                          (*above_tile)->SetIsTopLeftWallEnd(true);
-                        }
-                      }
-                    }
-                  }
-                }
-                if (!tile_lines.empty()) {
-                  std::vector<Tile_Bitmap*>::iterator above_tile;
-                  for (above_tile = m_block_tile_lines.back().begin(); above_tile != m_block_tile_lines.back().end(); above_tile++) {
-                    if (Bitmap_Helper::DoTheseTilesXCollide((*above_tile), new_tile) && Bitmap_Helper::AreTheseTilesYAdjacent((*above_tile), new_tile)) {
-                      if ((*above_tile)->GetPosition()->z != 0) {
-                        (*above_tile)->SetIsRoof(true);
-                        m_tunnel_edge_tiles.push_back((*above_tile));
-                      }
-                    }
-                  }
-                }
-                m_block_tile_line.push_back(new_tile);
-              }
-            }
-            
-            m_blocksize_x += new_tile->GetSize().x;
-            
-            if (m_blocksize_x == 128 && m_blocksize_y + new_tile->GetSize().y == 128) {
-              m_blocksize_x = 0;
-              m_blocksize_y = 0;
-              m_block_tile_lines.clear();
-              m_block_tile_line.clear();
-              m_back_block = 0;
-            } else if (m_blocksize_x == 128) {
-              m_blocksize_x = 0;
-              m_blocksize_y += new_tile->GetSize().y;
-              m_block_tile_lines.push_back(m_block_tile_line);
-              m_block_tile_line.clear();
-            }
-        }
-        if ((*tile).type.compare("Exit") == 0) {
-          if (tile_line.back()->IsLeftWall()) {
-            new_tile->SetIsLeftExit(true);
-          } else {
-            new_tile->SetIsRightExit(true);
-          }
-          m_exit_tiles.push_back(new_tile);
-        }
-      }
+    if (new_tile->IsLeftEdge()) {
+      m_left_edge_tiles.push_back(new_tile);
+    }
+    if (new_tile->IsRightEdge()) {
+      m_right_edge_tiles.push_back(new_tile);
+    }
+    if (new_tile->IsTopEdge()) {
+      m_top_edge_tiles.push_back(new_tile);
+    }
+    if (new_tile->IsBottomEdge()) {
+      m_bottom_edge_tiles.push_back(new_tile);
+    }
+    if (new_tile->IsAnyOf(Tile_Bitmap::WALL | Tile_Bitmap::FLOOR | Tile_Bitmap::ROOF)) {
+      m_tunnel_edge_tiles.push_back(new_tile);
+    }
+    if (new_tile->IsAnyOf(Tile_Bitmap::EXIT)) {
+      m_exit_tiles.push_back(new_tile);
+    }
 
-      if ((*tile).type.compare("Middleground") == 0) {
-        ResetMiddlegroundTileTexture(new_tile);
-      } else {
-        ResetBackgroundTileTexture(new_tile);
-      }
-      
-      tile_line.push_back(new_tile);
-      tiles.push_back(new_tile);
+    if (placement.is_middleground) {
+      ResetMiddlegroundTileTexture(new_tile);
+    } else {
+      ResetBackgroundTileTexture(new_tile);
     }
-    tile_lines.push_back(tile_line);
-    offset_y += 128;
+
+    tiles.push_back(new_tile);
   }
 
   return tiles;
@@ -581,15 +298,13 @@ std::vector<Tile_Bitmap*> Level_Tile_Controller::GenerateTunnelFromMetadata(Leve
 
 //---------------------------------------------------------------------------
 void Level_Tile_Controller::LoadTilesetMetadata() {
-  Tileset_Helper::Tileset_Metadata debug_tileset_metadata;
-  m_debug_metadata_file_path = String_Helper::WStringToString(m_game_settings->GetTilesetPath() + L"Debug_Tileset.txt");
-  Tileset_Helper::LoadTilesetMetadataIntoStruct(m_debug_metadata_file_path, &debug_tileset_metadata);
-  m_tilesets.push_back(debug_tileset_metadata);
-
-  Tileset_Helper::Tileset_Metadata blue_cave_tileset_metadata;
-  m_blue_cave_metadata_file_path = String_Helper::WStringToString(m_game_settings->GetTilesetPath() + L"Blue_Cave_Tileset_2.txt");
-  Tileset_Helper::LoadTilesetMetadataIntoStruct(m_blue_cave_metadata_file_path, &blue_cave_tileset_metadata);
-  m_tilesets.push_back(blue_cave_tileset_metadata);
+  // The tilesets are parsed on the level loader's thread, which is only
+  // started here if the level wasn't loaded ahead of time
+  if (!m_level_loader.IsStarted()) {
+    StartLoadingLevel();
+  }
+  std::vector<Tileset_Helper::Tileset_Metadata> const &tilesets = m_level_loader.Wait().tilesets;
+  m_tilesets.insert(m_tilesets.end(), tilesets.begin(), tilesets.end());
 
   if (m_game_settings->IsDebugMode()) {
     m_current_tileset = GetNamedTileset("Debug");
@@ -600,6 +315,17 @@ void Level_Tile_Controller::LoadTilesetMetadata() {
   m_current_background_subset = GetCurrentBackgroundSubset();
 }
 
+//---------------------------------------------------------------------------
+std::vector<std::string> Level_Tile_Controller::GetTilesetPaths() {
+  m_debug_metadata_file_path = String_Helper::WStringToString(m_game_settings->GetTilesetPath() + L"Debug_Tileset.txt");
+  m_blue_cave_metadata_file_path = String_Helper::WStringToString(m_game_settings->GetTilesetPath() + L"Blue_Cave_Tileset_2.txt");
+
+  std::vector<std::string> tileset_paths;
+  tileset_paths.push_back(m_debug_metadata_file_path);
+  tileset_paths.push_back(m_blue_cave_metadata_file_path);
+  return tileset_paths;
+}
+
 //---------------------------------------------------------------------------
 Tileset_Helper::Tileset_Metadata Level_Tile_Controller::GetNamedTileset(std::string name) {
   Tileset_Helper::Tileset_Metadata found_tileset_metadata;
@@ -980,8 +706,6 @@ void Level_Tile_Controller::ResetMiddlegroundTileTexture(Tile_Bitmap *out_tile)
   top += edge_subset.top_left_y_offset;
   out_tile->GetTexture()->top_left_position = D3DXVECTOR2(left, top);
   out_tile->GetTexture()->texture = 0;
-  out_tile->GetFrame()->vertex_buffer = 0;
-  out_tile->Init();
 }
 
 //---------------------------------------------------------------------------
@@ -1020,8 +744,6 @@ void Level_Tile_Controller::ResetBackgroundTileTexture(Tile_Bitmap *out_tile) {
   top += edge_subset.top_left_y_offset;
   out_tile->GetTexture()->top_left_position = D3DXVECTOR2(left, top);
   out_tile->GetTexture()->texture = 0;
-  out_tile->GetFrame()->vertex_buffer = 0;
-  out_tile->Init();
 }
 
 //---------------------------------------------------------------------------
@@ -31,7 +31,6 @@ namespace Tunnelour {
 //------------------------------------------------------------------------------
 Level_Transition_Controller::Level_Transition_Controller() : Controller() {
   m_game_settings = 0;
-  m_camera = 0;
   m_level = 0;
   m_tileset_filename = "";
   m_is_debug_mode = false;
@@ -68,10 +67,6 @@ Level_Transition_Controller::Level_Transition_Controller() : Controller() {
 //------------------------------------------------------------------------------
 Level_Transition_Controller::~Level_Transition_Controller() {
   m_game_settings = 0;
-  if (m_camera != 0) {
-    m_camera->Ignore(this);
-    m_camera = 0;
-  }
   m_level = 0;
   m_tileset_filename = "";
   m_is_debug_mode = false;
@@ -127,8 +122,6 @@ bool Level_Transition_Controller::Init(Component_Composite * const model) {
     m_looking_key_y_offset = -200.0f;
     m_loading_y_offset = -250.0f;
     m_game_settings = mutator.GetGameSettings();
-    m_camera = mutator.GetCamera();
-    m_camera->Observe(this);
     m_level = mutator.GetLevel();
     m_input = mutator.GetInput();
     LoadTilesetMetadata();
@@ -146,8 +139,9 @@ bool Level_Transition_Controller::Init(Component_Composite * const model) {
     if (m_background == 0) {
       // Create the Spash Black Tile
       m_background = CreateTile(128);
-      m_background->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y, m_z_bitmap_position);
+      m_background->SetPosition(0.0f, 0.0f, m_z_bitmap_position);
       m_background->SetScale(D3DXVECTOR3((m_game_settings->GetResolution().x/128), (m_game_settings->GetResolution().y/128), 1.0f));
+      m_background->SetScreenSpace(true);
       m_model->Add(m_background);        
     }
     if (m_level_complete_heading == 0) {
@@ -155,8 +149,9 @@ bool Level_Transition_Controller::Init(Component_Composite * const model) {
       m_level_complete_heading->GetText()->font_csv_file = m_heading_font_path;
       m_level_complete_heading->GetText()->text = m_level_complete_heading_text;
       m_level_complete_heading->GetTexture()->transparency = 1.0f;
-      m_level_complete_heading->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_level_complete_heading_y_offset, m_z_text_position);
-      m_level_complete_heading->GetFont()->font_color = Colours::Text_Blue;
+      m_level_complete_heading->SetPosition(0.0f, m_level_complete_heading_y_offset, m_z_text_position);
+      m_level_complete_heading->SetScreenSpace(true);
+      m_level_complete_heading->SetFontColor(Colours::Text_Blue);
       m_level_complete_heading->GetFrame()->index_buffer = 0;
       m_level_complete_heading->GetTexture()->texture = 0;
       m_level_complete_heading->GetFrame()->vertex_buffer = 0;
@@ -167,11 +162,12 @@ bool Level_Transition_Controller::Init(Component_Composite * const model) {
       m_next_level_heading->GetText()->font_csv_file = m_text_font_path;
       m_next_level_heading->GetText()->text = m_next_level_heading_text;
       m_next_level_heading->GetTexture()->transparency = 1.0f;
-      m_next_level_heading->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_next_level_heading_y_offset, m_z_text_position);
+      m_next_level_heading->SetPosition(0.0f, m_next_level_heading_y_offset, m_z_text_position);
+      m_next_level_heading->SetScreenSpace(true);
       m_next_level_heading->GetFrame()->index_buffer = 0;
       m_next_level_heading->GetTexture()->texture = 0;
       m_next_level_heading->GetFrame()->vertex_buffer = 0;
-      m_next_level_heading->GetFont()->font_color = Colours::Text_Light_Blue; 
+      m_next_level_heading->SetFontColor(Colours::Text_Light_Blue); 
       m_model->Add(m_next_level_heading);
     }
     if (m_next_level_name == 0) {
@@ -179,11 +175,12 @@ bool Level_Transition_Controller::Init(Component_Composite * const model) {
       m_next_level_name->GetText()->font_csv_file = m_text_font_path;
       m_next_level_name->GetText()->text = m_next_level_name_text;
       m_next_level_name->GetTexture()->transparency = 1.0f;
-      m_next_level_name->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_next_level_name_y_offset, m_z_text_position);
+      m_next_level_name->SetPosition(0.0f, m_next_level_name_y_offset, m_z_text_position);
+      m_next_level_name->SetScreenSpace(true);
       m_next_level_name->GetFrame()->index_buffer = 0;
       m_next_level_name->GetTexture()->texture = 0;
       m_next_level_name->GetFrame()->vertex_buffer = 0;
-      m_next_level_name->GetFont()->font_color = Colours::Text_Light_Blue; 
+      m_next_level_name->SetFontColor(Colours::Text_Light_Blue); 
       m_model->Add(m_next_level_name);
     }
     if (m_next_level_blurb == 0) {
@@ -191,11 +188,12 @@ bool Level_Transition_Controller::Init(Component_Composite * const model) {
       m_next_level_blurb->GetText()->font_csv_file = m_text_font_path;
       m_next_level_blurb->GetText()->text = m_next_level_blurb_text;
       m_next_level_blurb->GetTexture()->transparency = 1.0f;
-      m_next_level_blurb->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_next_level_blurb_y_offset, m_z_text_position);
+      m_next_level_blurb->SetPosition(0.0f, m_next_level_blurb_y_offset, m_z_text_position);
+      m_next_level_blurb->SetScreenSpace(true);
       m_next_level_blurb->GetFrame()->index_buffer = 0;
       m_next_level_blurb->GetTexture()->texture = 0;
       m_next_level_blurb->GetFrame()->vertex_buffer = 0;
-      m_next_level_blurb->GetFont()->font_color = Colours::Text_Light_Blue; 
+      m_next_level_blurb->SetFontColor(Colours::Text_Light_Blue); 
       m_model->Add(m_next_level_blurb);
     }
     if (m_looking_key == 0) {
@@ -204,11 +202,12 @@ bool Level_Transition_Controller::Init(Component_Composite * const model) {
       m_looking_key->GetText()->text = m_next_level_blurb_text;
       m_looking_key->GetText()->text = "Hold SHIFT and use the direction keys to look around!";
       m_looking_key->GetTexture()->transparency = 1.0f;
-      m_looking_key->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_looking_key_y_offset, m_z_text_position);
+      m_looking_key->SetPosition(0.0f, m_looking_key_y_offset, m_z_text_position);
+      m_looking_key->SetScreenSpace(true);
       m_looking_key->GetFrame()->index_buffer = 0;
       m_looking_key->GetTexture()->texture = 0;
       m_looking_key->GetFrame()->vertex_buffer = 0;
-      m_looking_key->GetFont()->font_color = Colours::Text_Light_Blue; 
+      m_looking_key->SetFontColor(Colours::Text_Light_Blue); 
       m_model->Add(m_looking_key);
     }
     if (m_loading == 0) {
@@ -216,11 +215,12 @@ bool Level_Transition_Controller::Init(Component_Composite * const model) {
       m_loading->GetText()->font_csv_file = m_text_font_path;
       m_loading->GetText()->text = "Loading!";
       m_loading->GetTexture()->transparency = 1.0f;
-      m_loading->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_loading_y_offset, m_z_text_position);
+      m_loading->SetPosition(0.0f, m_loading_y_offset, m_z_text_position);
+      m_loading->SetScreenSpace(true);
       m_loading->GetFrame()->index_buffer = 0;
       m_loading->GetTexture()->texture = 0;
       m_loading->GetFrame()->vertex_buffer = 0;
-      m_loading->GetFont()->font_color = Colours::Text_Light_Blue; 
+      m_loading->SetFontColor(Colours::Text_Light_Blue); 
       m_model->Add(m_loading);
       SetIsLoading(true);
     } 
@@ -237,57 +237,31 @@ bool Level_Transition_Controller::Run() {
     Init(m_model); 
   }
 
-  if (m_background != 0) {
-    m_background->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y, m_z_bitmap_position);
-  }
   
   if (m_level_complete_heading != 0) {
     if (m_level_complete_heading_text.compare(m_level_complete_heading->GetText()->text) != 0) {
-      m_level_complete_heading->GetText()->text = m_level_complete_heading_text;
-      m_level_complete_heading->GetFrame()->index_buffer = 0;
-      m_level_complete_heading->GetTexture()->texture = 0;
-      m_level_complete_heading->GetFrame()->vertex_buffer = 0;
-      m_level_complete_heading->Init();
-      m_level_complete_heading->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_level_complete_heading_y_offset, m_z_text_position);
+      m_level_complete_heading->SetText(m_level_complete_heading_text);
     }
   }
 
   if (m_next_level_heading != 0) {
     if (m_next_level_heading_text.compare(m_next_level_heading->GetText()->text) != 0) {
-      m_next_level_heading->GetText()->text = m_next_level_heading_text;
-      m_next_level_heading->GetFrame()->index_buffer = 0;
-      m_next_level_heading->GetTexture()->texture = 0;
-      m_next_level_heading->GetFrame()->vertex_buffer = 0;
-      m_next_level_heading->Init();
-      m_next_level_heading->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_next_level_heading_y_offset, m_z_text_position);
+      m_next_level_heading->SetText(m_next_level_heading_text);
     }
   }
   
   if (m_next_level_name != 0) {
     if (m_next_level_name_text.compare(m_next_level_name->GetText()->text) != 0) {
-      m_next_level_name->GetText()->text = m_next_level_name_text;
-      m_next_level_name->GetFrame()->index_buffer = 0;
-      m_next_level_name->GetTexture()->texture = 0;
-      m_next_level_name->GetFrame()->vertex_buffer = 0;
-      m_next_level_name->Init();
-      m_next_level_name->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_next_level_name_y_offset, m_z_text_position);
+      m_next_level_name->SetText(m_next_level_name_text);
     }
   }
   
   if (m_next_level_blurb != 0) {
     if (m_next_level_blurb_text.compare(m_next_level_blurb->GetText()->text) != 0) {
-      m_next_level_blurb->GetText()->text = m_next_level_blurb_text;
-      m_next_level_blurb->GetFrame()->index_buffer = 0;
-      m_next_level_blurb->GetTexture()->texture = 0;
-      m_next_level_blurb->GetFrame()->vertex_buffer = 0;
-      m_next_level_blurb->Init();
-      m_next_level_blurb->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_next_level_blurb_y_offset, m_z_text_position);
+      m_next_level_blurb->SetText(m_next_level_blurb_text);
     }
   }
 
-  if (m_looking_key != 0) {
-    m_looking_key->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_looking_key_y_offset, m_z_text_position);
-  }
 
 
   if (m_loading != 0) {
@@ -306,12 +280,7 @@ bool Level_Transition_Controller::Run() {
     if (m_loading->GetText()->text.compare("Loading!") == 0) {
       if (!m_is_loading) {
         m_loading->GetTexture()->transparency = 1.0f;
-        m_loading->GetText()->text = "Loading Complete Press Space to Continue";
-        m_loading->GetFrame()->index_buffer = 0;
-        m_loading->GetTexture()->texture = 0;
-        m_loading->GetFrame()->vertex_buffer = 0;
-        m_loading->Init();
-        m_loading->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_loading_y_offset, m_z_text_position);
+        m_loading->SetText("Loading Complete Press Space to Continue");
       }
     }
 
@@ -419,33 +388,6 @@ void Level_Transition_Controller::SetNextLevelBlurbText(std::string next_level_b
   }
 }
 
-//------------------------------------------------------------------------------
-void Level_Transition_Controller::HandleEvent(Tunnelour::Component * const component) {
-  if (component->GetType().compare("Camera_Component") == 0) {
-    if (m_background != 0) {
-      m_background->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y, m_z_bitmap_position);
-    }
-    if (m_level_complete_heading != 0) {
-      m_level_complete_heading->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_level_complete_heading_y_offset, m_z_text_position);
-    }
-    if (m_next_level_heading != 0) {
-      m_next_level_heading->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_next_level_heading_y_offset, m_z_text_position);
-    }
-    if (m_next_level_name != 0) {
-      m_next_level_name->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_next_level_name_y_offset, m_z_text_position);
-    }
-    if (m_next_level_blurb != 0) {
-      m_next_level_blurb->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_next_level_blurb_y_offset, m_z_text_position);
-    }
-    if (m_looking_key != 0) {
-      m_looking_key->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_looking_key_y_offset, m_z_text_position);
-    }
-    if (m_loading != 0) {
-      m_loading->SetPosition(m_camera->GetPosition().x, m_camera->GetPosition().y + m_loading_y_offset, m_z_text_position);
-    }
-  }
-}
-
 //------------------------------------------------------------------------------
 // protected:
 //------------------------------------------------------------------------------
@@ -114,6 +114,15 @@ bool Procedural_Level_Tile_Controller::Run() {
   return true;
 }
 
+//------------------------------------------------------------------------------
+void Procedural_Level_Tile_Controller::StartLoadingLevel() {
+}
+
+//------------------------------------------------------------------------------
+bool Procedural_Level_Tile_Controller::IsLevelLoaded() {
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void Procedural_Level_Tile_Controller::CreateLevel() {
   m_current_level_name = m_level->GetCurrentLevel().level_name;
@@ -159,10 +168,11 @@ void Procedural_Level_Tile_Controller::RemoveTilesFromModel(std::vector<Tile_Bit
 }
 
 //------------------------------------------------------------------------------
-void Procedural_Level_Tile_Controller::AddLevelToModel() {
+bool Procedural_Level_Tile_Controller::AddLevelToModel(float) {
   //for (std::vector<Tile_Bitmap*>::iterator tile = m_level_tiles.begin(); tile != m_level_tiles.end(); ++tile) {
   //  m_model->Add(*tile);
   //}
+  return true;
 }
 
 //------------------------------------------------------------------------------
@@ -579,8 +589,6 @@ void Procedural_Level_Tile_Controller::CloseTunnelBehindAvatar() {
   for (old_tile = (*(m_level_tile_lines.begin())).begin(); old_tile != (*(m_level_tile_lines.begin())).end(); old_tile++) {
     Tile_Bitmap* new_tile = CreateMiddlegroundTile(m_tile_size);
     new_tile->SetPosition((*old_tile)->GetPosition()->x , (*old_tile)->GetPosition()->y, (*old_tile)->GetPosition()->z);
-    (*old_tile)->GetTexture()->transparency = 0.0f;
-    ResetMiddlegroundTileTexture((*old_tile));
     if ((*old_tile)->IsRoof() ||
         (*old_tile)->IsLeftRoofEnd() ||
         (*old_tile)->IsTopLeftWallEnd()) {
@@ -634,7 +642,10 @@ void Procedural_Level_Tile_Controller::CloseTunnelBehindAvatar() {
     ResetMiddlegroundTileTexture(new_tile);
     new_line.push_back(new_tile);
  }
- (*(m_level_tile_lines.begin())).insert(((*m_level_tile_lines.begin())).begin(), new_line.begin(), new_line.end());
+ // The wall covers every tile of the old line, so replace them rather than
+ // keeping hidden tiles in the model behind it.
+ RemoveTilesFromModel((*m_level_tile_lines.begin()));
+ (*m_level_tile_lines.begin()) = new_line;
 }
 
 //------------------------------------------------------------------------------
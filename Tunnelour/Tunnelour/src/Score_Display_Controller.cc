@@ -35,7 +35,6 @@ Score_Display_Controller::Score_Display_Controller() : Controller(),
   m_z_bitmap_position(-4),
   m_z_text_position(-5) {
   m_game_settings = 0;
-  m_camera = 0;
   m_level = 0;
   m_input = 0;
   m_game_metrics = 0;
@@ -76,10 +75,6 @@ Score_Display_Controller::Score_Display_Controller() : Controller(),
 //------------------------------------------------------------------------------
 Score_Display_Controller::~Score_Display_Controller() {
   m_game_settings = 0;
-  if (m_camera != 0) {
-    m_camera->Ignore(this);
-    m_camera = 0;
-  }
   m_level = 0;
   m_input = 0;
   m_game_metrics = 0;
@@ -124,8 +119,6 @@ bool Score_Display_Controller::Init(Component_Composite * const model) {
     m_next_level_blurb_y_offset = -150.0f;
     m_loading_y_offset = -250.0f;
     m_game_settings = mutator.GetGameSettings();
-    m_camera = mutator.GetCamera();
-    m_camera->Observe(this);
     m_input = mutator.GetInput();
     LoadTilesetMetadata();
     m_current_tileset = Tileset_Helper::GetNamedTileset("Black", m_tilesets);
@@ -137,12 +130,11 @@ bool Score_Display_Controller::Init(Component_Composite * const model) {
     if (m_background == 0) {
       // Create the Spash Black Tile
       m_background = CreateTile(128);
-      m_background->SetPosition(m_camera->GetPosition().x,
-                                m_camera->GetPosition().y,
-                                m_z_bitmap_position);
+      m_background->SetPosition(0.0f, 0.0f, m_z_bitmap_position);
       m_background->SetScale(m_game_settings->GetResolution().x / 128.0f,
                              m_game_settings->GetResolution().y / 128.0f,
                              1.0f);
+      m_background->SetScreenSpace(true);
       m_model->Add(m_background);
     }
     if (m_level_complete_heading == 0) {
@@ -150,10 +142,9 @@ bool Score_Display_Controller::Init(Component_Composite * const model) {
       m_level_complete_heading->GetText()->font_csv_file = m_heading_font_path;
       m_level_complete_heading->GetText()->text = " COMPLETE!";
       m_level_complete_heading->GetTexture()->transparency = 1.0f;
-      m_level_complete_heading->SetPosition(m_camera->GetPosition().x,
-                                            m_camera->GetPosition().y + m_level_complete_heading_y_offset,
-                                            m_z_text_position);
-      m_level_complete_heading->GetFont()->font_color = Colours::Text_Blue;
+      m_level_complete_heading->SetPosition(0.0f, m_level_complete_heading_y_offset, m_z_text_position);
+      m_level_complete_heading->SetScreenSpace(true);
+      m_level_complete_heading->SetFontColor(Colours::Text_Blue);
       m_level_complete_heading->GetFrame()->index_buffer = 0;
       m_level_complete_heading->GetTexture()->texture = 0;
       m_level_complete_heading->GetFrame()->vertex_buffer = 0;
@@ -166,13 +157,12 @@ bool Score_Display_Controller::Init(Component_Composite * const model) {
       distance << std::setprecision(2) << std::fixed << m_game_metrics->GetDistanceTraveled();
       m_next_level_heading->GetText()->text = "Distance: " + distance.str() + " meters";
       m_next_level_heading->GetTexture()->transparency = 1.0f;
-      m_next_level_heading->SetPosition(m_camera->GetPosition().x,
-                                        m_camera->GetPosition().y + m_next_level_heading_y_offset,
-                                        m_z_text_position);
+      m_next_level_heading->SetPosition(0.0f, m_next_level_heading_y_offset, m_z_text_position);
+      m_next_level_heading->SetScreenSpace(true);
       m_next_level_heading->GetFrame()->index_buffer = 0;
       m_next_level_heading->GetTexture()->texture = 0;
       m_next_level_heading->GetFrame()->vertex_buffer = 0;
-      m_next_level_heading->GetFont()->font_color = Colours::Text_Light_Blue;
+      m_next_level_heading->SetFontColor(Colours::Text_Light_Blue);
       m_model->Add(m_next_level_heading);
     }
     if (m_next_level_name == 0) {
@@ -182,13 +172,12 @@ bool Score_Display_Controller::Init(Component_Composite * const model) {
       seconds << std::setprecision(2) << std::fixed << m_game_metrics->GetSecondsPast();
       m_next_level_name->GetText()->text = "Time: " + seconds.str() + " seconds";
       m_next_level_name->GetTexture()->transparency = 1.0f;
-      m_next_level_name->SetPosition(m_camera->GetPosition().x,
-                                     m_camera->GetPosition().y + m_next_level_name_y_offset,
-                                     m_z_text_position);
+      m_next_level_name->SetPosition(0.0f, m_next_level_name_y_offset, m_z_text_position);
+      m_next_level_name->SetScreenSpace(true);
       m_next_level_name->GetFrame()->index_buffer = 0;
       m_next_level_name->GetTexture()->texture = 0;
       m_next_level_name->GetFrame()->vertex_buffer = 0;
-      m_next_level_name->GetFont()->font_color = Colours::Text_Light_Blue;
+      m_next_level_name->SetFontColor(Colours::Text_Light_Blue);
       m_model->Add(m_next_level_name);
     }
     if (m_next_level_blurb == 0) {
@@ -198,13 +187,12 @@ bool Score_Display_Controller::Init(Component_Composite * const model) {
       speed << std::setprecision(2) << std::fixed << (m_game_metrics->GetDistanceTraveled()/m_game_metrics->GetSecondsPast());
       m_next_level_blurb->GetText()->text = "Average Speed: " + speed.str() + " metres per second";
       m_next_level_blurb->GetTexture()->transparency = 1.0f;
-      m_next_level_blurb->SetPosition(m_camera->GetPosition().x,
-                                      m_camera->GetPosition().y + m_next_level_blurb_y_offset,
-                                      m_z_text_position);
+      m_next_level_blurb->SetPosition(0.0f, m_next_level_blurb_y_offset, m_z_text_position);
+      m_next_level_blurb->SetScreenSpace(true);
       m_next_level_blurb->GetFrame()->index_buffer = 0;
       m_next_level_blurb->GetTexture()->texture = 0;
       m_next_level_blurb->GetFrame()->vertex_buffer = 0;
-      m_next_level_blurb->GetFont()->font_color = Colours::Text_Light_Blue;
+      m_next_level_blurb->SetFontColor(Colours::Text_Light_Blue);
       m_model->Add(m_next_level_blurb);
     }
     if (m_loading == 0) {
@@ -212,13 +200,12 @@ bool Score_Display_Controller::Init(Component_Composite * const model) {
       m_loading->GetText()->font_csv_file = m_text_font_path;
       m_loading->GetText()->text = "Press Space to Continue";
       m_loading->GetTexture()->transparency = 1.0f;
-      m_loading->SetPosition(m_camera->GetPosition().x,
-                             m_camera->GetPosition().y + m_loading_y_offset,
-                             m_z_text_position);
+      m_loading->SetPosition(0.0f, m_loading_y_offset, m_z_text_position);
+      m_loading->SetScreenSpace(true);
       m_loading->GetFrame()->index_buffer = 0;
       m_loading->GetTexture()->texture = 0;
       m_loading->GetFrame()->vertex_buffer = 0;
-      m_loading->GetFont()->font_color = Colours::Text_Light_Blue;
+      m_loading->SetFontColor(Colours::Text_Light_Blue);
       m_model->Add(m_loading);
     }
     m_has_been_initialised = true;
@@ -235,12 +222,6 @@ bool Score_Display_Controller::Run() {
     return false;
   }
 
-  if (m_background != 0) {
-    m_background->SetPosition(m_camera->GetPosition().x,
-                              m_camera->GetPosition().y,
-                              m_z_bitmap_position);
-  }
-
   IsItTimeToAnimateAFrame();
   if (m_animation_tick && m_background != 0) {
     if (m_loading->GetTexture()->transparency > 0.0f) {
@@ -312,13 +293,6 @@ bool Score_Display_Controller::IsFading() {
   return m_is_fading;
 }
 
-//------------------------------------------------------------------------------
-void Score_Display_Controller::HandleEvent(Tunnelour::Component * const component) {
-  if (component->GetType().compare("Camera_Component") == 0) {
-    Run();
-  }
-}
-
 //------------------------------------------------------------------------------
 // protected:
 //------------------------------------------------------------------------------
@@ -35,7 +35,6 @@ Screen_Wipeout_Controller::Screen_Wipeout_Controller() : Controller(),
   m_z_bitmap_position(-4.0f),
   m_z_text_position(-5.0f) {
   m_game_settings = 0;
-  m_camera = 0;
   m_tileset_filename = "";
   m_black_metadata_file_path = "";
   m_white_metadata_file_path = "";
@@ -48,10 +47,6 @@ Screen_Wipeout_Controller::Screen_Wipeout_Controller() : Controller(),
 //------------------------------------------------------------------------------
 Screen_Wipeout_Controller::~Screen_Wipeout_Controller() {
   m_game_settings = 0;
-  if (m_camera != 0) {
-    m_camera->Ignore(this);
-    m_camera = 0;
-  }
   m_tileset_filename = "";
   m_black_metadata_file_path = "";
   m_white_metadata_file_path = "";
@@ -82,8 +77,6 @@ bool Screen_Wipeout_Controller::Init(Component_Composite * const model) {
   m_model->Apply(&mutator);
   if (mutator.WasSuccessful()) {
     m_game_settings = mutator.GetGameSettings();
-    m_camera = mutator.GetCamera();
-    m_camera->Observe(this);
     LoadTilesetMetadata();
     m_current_tileset = Tileset_Helper::GetNamedTileset("Black", m_tilesets);
     m_current_tileset_subset = Tileset_Helper::GetForegroundSubset(m_current_tileset);
@@ -92,23 +85,25 @@ bool Screen_Wipeout_Controller::Init(Component_Composite * const model) {
     if (m_top_slash == 0) {
       // Create the Spash Black Tile
       m_top_slash = CreateTile(128);
-      m_top_slash->SetPosition(m_camera->GetPosition().x,
-                               m_camera->GetPosition().y + (m_game_settings->GetResolution().y / 1.5f),
+      m_top_slash->SetPosition(0.0f,
+                               m_game_settings->GetResolution().y / 1.5f,
                                m_z_bitmap_position);
       m_top_slash->SetScale((m_game_settings->GetResolution().x / 128.0f),
                            ((m_game_settings->GetResolution().y / 128.0f) / 4.0f),
                              1.0f);
+      m_top_slash->SetScreenSpace(true);
       m_model->Add(m_top_slash);
     }
     if (m_bottom_slash == 0) {
       // Create the Splash Black Tile
       m_bottom_slash = CreateTile(128);
-      m_bottom_slash->SetPosition(m_camera->GetPosition().x,
-                                  m_camera->GetPosition().y - (m_game_settings->GetResolution().y / 1.5f),
+      m_bottom_slash->SetPosition(0.0f,
+                                  -m_game_settings->GetResolution().y / 1.5f,
                                   m_z_bitmap_position);
       m_bottom_slash->SetScale((m_game_settings->GetResolution().x / 128.0f),
                                 ((m_game_settings->GetResolution().y / 128.0f) / 4.0f),
                                 1.0f);
+      m_bottom_slash->SetScreenSpace(true);
       m_model->Add(m_bottom_slash);
     }
   } else {
@@ -125,13 +120,6 @@ bool Screen_Wipeout_Controller::Run() {
   if (m_top_slash != 0 && m_bottom_slash != 0) {
     IsItTimeToAnimateAFrame();
     if (m_animation_tick) {
-      m_top_slash->SetPosition(m_camera->GetPosition().x,
-                               m_camera->GetPosition().y + (m_game_settings->GetResolution().y / 1.5f),
-                               m_z_bitmap_position);
-      m_bottom_slash->SetPosition(m_camera->GetPosition().x,
-                                  m_camera->GetPosition().y - (m_game_settings->GetResolution().y / 1.5f),
-                                  m_z_bitmap_position);
-
       float bottom = m_top_slash->GetBottomRightPostion().y;
       float top = m_bottom_slash->GetTopLeftPostion().y;
       if (bottom <= top) {
@@ -141,12 +129,11 @@ bool Screen_Wipeout_Controller::Run() {
         m_bottom_slash = 0;
         if (m_background == 0) {
           m_background = CreateTile(128);
-          m_background->SetPosition(m_camera->GetPosition().x,
-                                    m_camera->GetPosition().y,
-                                    m_z_bitmap_position);
+          m_background->SetPosition(0.0f, 0.0f, m_z_bitmap_position);
           m_background->SetScale((m_game_settings->GetResolution().x / 128.0f),
                                   (m_game_settings->GetResolution().y / 128.0f),
                                   1.0f);
+          m_background->SetScreenSpace(true);
           m_model->Add(m_background);
           m_is_finished = true;
         }
@@ -161,22 +148,9 @@ bool Screen_Wipeout_Controller::Run() {
     }
   }
 
-  if (m_background != 0) {
-    m_background->SetPosition(m_camera->GetPosition().x,
-                              m_camera->GetPosition().y,
-                              m_z_bitmap_position);
-  }
-
   return true;
 }
 
-//------------------------------------------------------------------------------
-void Screen_Wipeout_Controller::HandleEvent(Tunnelour::Component * const component) {
-  if (component->GetType().compare("Camera_Component") == 0) {
-    Run();
-  }
-}
-
 //------------------------------------------------------------------------------
 // protected:
 //------------------------------------------------------------------------------
@@ -0,0 +1,240 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include "Snapshot_Buffer.h"
+#include "Exceptions.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Snapshot_Buffer::Snapshot_Buffer(unsigned int field_count, unsigned int byte_capacity, unsigned int keyframe_interval) {
+  // Which fields changed is kept in the bits of one number
+  if (field_count == 0 || field_count > 32) {
+    throw Exceptions::init_error("Snapshot_Buffer needs from 1 to 32 fields");
+  }
+  if (keyframe_interval == 0) {
+    keyframe_interval = 1;
+  }
+  m_field_count = field_count;
+  m_keyframe_interval = keyframe_interval;
+  if (byte_capacity < 2 * m_keyframe_interval * GetMaxRecordSize()) {
+    throw Exceptions::init_error("Snapshot_Buffer is too small for two keyframes of snapshots");
+  }
+
+  m_bytes.assign(byte_capacity, 0);
+  // Every snapshot takes at least a byte so this many keyframes always fit
+  m_keyframes.resize((byte_capacity / m_keyframe_interval) + 2);
+  m_last_fields.assign(m_field_count, 0);
+  m_record.assign(GetMaxRecordSize(), 0);
+  Clear();
+}
+
+//------------------------------------------------------------------------------
+Snapshot_Buffer::~Snapshot_Buffer() {
+}
+
+//------------------------------------------------------------------------------
+void Snapshot_Buffer::Push(int const *fields) {
+  bool is_keyframe = (m_keyframe_count == 0 ||
+                      m_next_sequence - GetKeyframe(m_keyframe_count - 1).sequence >= m_keyframe_interval);
+
+  // A keyframe is stored as the changes from all zeros
+  unsigned int changed_mask = 0;
+  for (unsigned int field = 0; field < m_field_count; field++) {
+    int base = is_keyframe ? 0 : m_last_fields[field];
+    if (fields[field] != base) {
+      changed_mask |= (1u << field);
+    }
+  }
+  unsigned int record_size = WriteVarint(changed_mask, &m_record[0]);
+  for (unsigned int field = 0; field < m_field_count; field++) {
+    if ((changed_mask & (1u << field)) == 0) {
+      continue;
+    }
+    int base = is_keyframe ? 0 : m_last_fields[field];
+    unsigned int delta = static_cast<unsigned int>(fields[field]) - static_cast<unsigned int>(base);
+    // Small changes either way are small numbers
+    unsigned int zigzag = (delta << 1) ^ static_cast<unsigned int>(static_cast<int>(delta) >> 31);
+    record_size += WriteVarint(zigzag, &m_record[record_size]);
+  }
+
+  while (m_keyframe_count != 0 &&
+         (m_bytes_used + record_size > m_bytes.size() ||
+          (is_keyframe && m_keyframe_count == m_keyframes.size()))) {
+    DropOldestKeyframe();
+  }
+
+  if (is_keyframe) {
+    Keyframe &keyframe = m_keyframes[(m_first_keyframe + m_keyframe_count) % m_keyframes.size()];
+    keyframe.sequence = m_next_sequence;
+    keyframe.offset = m_write_offset;
+    m_keyframe_count++;
+  }
+  unsigned int capacity = static_cast<unsigned int>(m_bytes.size());
+  for (unsigned int index = 0; index < record_size; index++) {
+    m_bytes[(m_write_offset + index) % capacity] = m_record[index];
+  }
+  m_write_offset = (m_write_offset + record_size) % capacity;
+  m_bytes_used += record_size;
+  m_next_sequence++;
+  for (unsigned int field = 0; field < m_field_count; field++) {
+    m_last_fields[field] = fields[field];
+  }
+}
+
+//------------------------------------------------------------------------------
+bool Snapshot_Buffer::Get(unsigned int ticks_ago, int *out_fields) {
+  if (ticks_ago >= GetSize()) {
+    return false;
+  }
+  Decode(m_next_sequence - 1 - ticks_ago, out_fields);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool Snapshot_Buffer::Rewind(unsigned int ticks_ago, int *out_fields) {
+  if (ticks_ago >= GetSize()) {
+    return false;
+  }
+  unsigned int sequence = m_next_sequence - 1 - ticks_ago;
+  unsigned int next_offset = Decode(sequence, out_fields);
+  if (ticks_ago != 0) {
+    // The dropped snapshots took at least a byte each, so the newest kept
+    // one cannot end where the oldest keyframe starts
+    unsigned int capacity = static_cast<unsigned int>(m_bytes.size());
+    m_bytes_used = (next_offset + capacity - GetKeyframe(0).offset) % capacity;
+    m_write_offset = next_offset;
+    while (GetKeyframe(m_keyframe_count - 1).sequence > sequence) {
+      m_keyframe_count--;
+    }
+    m_next_sequence = sequence + 1;
+  }
+  for (unsigned int field = 0; field < m_field_count; field++) {
+    m_last_fields[field] = out_fields[field];
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void Snapshot_Buffer::Clear() {
+  m_write_offset = 0;
+  m_bytes_used = 0;
+  m_first_keyframe = 0;
+  m_keyframe_count = 0;
+  m_next_sequence = 0;
+  m_last_fields.assign(m_field_count, 0);
+}
+
+//------------------------------------------------------------------------------
+unsigned int Snapshot_Buffer::GetSize() {
+  if (m_keyframe_count == 0) {
+    return 0;
+  }
+  return m_next_sequence - GetKeyframe(0).sequence;
+}
+
+//------------------------------------------------------------------------------
+unsigned int Snapshot_Buffer::GetBytesUsed() {
+  return m_bytes_used;
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+unsigned int Snapshot_Buffer::GetMaxRecordSize() {
+  // A varint of a 32 bit number takes up to 5 bytes
+  return 5 + (5 * m_field_count);
+}
+
+//------------------------------------------------------------------------------
+Snapshot_Buffer::Keyframe & Snapshot_Buffer::GetKeyframe(unsigned int index) {
+  return m_keyframes[(m_first_keyframe + index) % m_keyframes.size()];
+}
+
+//------------------------------------------------------------------------------
+void Snapshot_Buffer::DropOldestKeyframe() {
+  if (m_keyframe_count > 1) {
+    unsigned int capacity = static_cast<unsigned int>(m_bytes.size());
+    m_bytes_used -= (GetKeyframe(1).offset + capacity - GetKeyframe(0).offset) % capacity;
+  } else {
+    m_bytes_used = 0;
+  }
+  m_first_keyframe = (m_first_keyframe + 1) % m_keyframes.size();
+  m_keyframe_count--;
+}
+
+//------------------------------------------------------------------------------
+unsigned int Snapshot_Buffer::Decode(unsigned int sequence, int *out_fields) {
+  unsigned int keyframe_index = m_keyframe_count - 1;
+  while (GetKeyframe(keyframe_index).sequence > sequence) {
+    keyframe_index--;
+  }
+  Keyframe const &keyframe = GetKeyframe(keyframe_index);
+
+  for (unsigned int field = 0; field < m_field_count; field++) {
+    out_fields[field] = 0;
+  }
+  unsigned int offset = keyframe.offset;
+  for (unsigned int current = keyframe.sequence; current <= sequence; current++) {
+    unsigned int changed_mask = 0;
+    offset = ReadVarint(offset, &changed_mask);
+    for (unsigned int field = 0; field < m_field_count; field++) {
+      if ((changed_mask & (1u << field)) == 0) {
+        continue;
+      }
+      unsigned int zigzag = 0;
+      offset = ReadVarint(offset, &zigzag);
+      unsigned int delta = (zigzag >> 1) ^ (0u - (zigzag & 1));
+      out_fields[field] = static_cast<int>(static_cast<unsigned int>(out_fields[field]) + delta);
+    }
+  }
+  return offset;
+}
+
+//------------------------------------------------------------------------------
+unsigned int Snapshot_Buffer::WriteVarint(unsigned int value, unsigned char *out_bytes) {
+  unsigned int size = 0;
+  while (value >= 0x80) {
+    out_bytes[size++] = static_cast<unsigned char>(value | 0x80);
+    value >>= 7;
+  }
+  out_bytes[size++] = static_cast<unsigned char>(value);
+  return size;
+}
+
+//------------------------------------------------------------------------------
+unsigned int Snapshot_Buffer::ReadVarint(unsigned int offset, unsigned int *out_value) {
+  unsigned int capacity = static_cast<unsigned int>(m_bytes.size());
+  unsigned int value = 0;
+  unsigned int shift = 0;
+  unsigned char byte = 0;
+  do {
+    byte = m_bytes[offset];
+    offset = (offset + 1) % capacity;
+    value |= static_cast<unsigned int>(byte & 0x7F) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  *out_value = value;
+  return offset;
+}
+
+}  // namespace Tunnelour
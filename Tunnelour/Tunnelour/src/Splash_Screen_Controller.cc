@@ -105,7 +105,7 @@ bool Splash_Screen_Controller::Init(Component_Composite * const model) {
       m_game_name_heading = new Text_Component();
       m_game_name_heading->GetText()->font_csv_file = m_heading_font_path;
       m_game_name_heading->GetText()->text = "TUNNELOR";
-      m_game_name_heading->GetFont()->font_color = Colours::Text_Blue;
+      m_game_name_heading->SetFontColor(Colours::Text_Blue);
       m_game_name_heading->GetTexture()->transparency = 1.0f;
       m_game_name_heading->SetPosition(0, 0, m_z_text_position);
       m_game_name_heading->GetFrame()->index_buffer = 0;
@@ -118,7 +118,7 @@ bool Splash_Screen_Controller::Init(Component_Composite * const model) {
       m_version = new Text_Component();
       m_version->GetText()->font_csv_file = m_text_font_path;
       m_version->GetText()->text = "ALPHA";
-      m_version->GetFont()->font_color = Colours::Text_Red;
+      m_version->SetFontColor(Colours::Text_Red);
       m_version->GetTexture()->transparency = 1.0f;
       m_version->SetPosition(0, 0, m_z_text_position);
       m_version->GetFrame()->index_buffer = 0;
@@ -131,7 +131,7 @@ bool Splash_Screen_Controller::Init(Component_Composite * const model) {
       m_author = new Text_Component();
       m_author->GetText()->font_csv_file = m_text_font_path;
       m_author->GetText()->text = "SEAN.MACDONNELL@GMAIL.COM";
-      m_author->GetFont()->font_color = Colours::Text_Light_Blue;
+      m_author->SetFontColor(Colours::Text_Light_Blue);
       m_author->GetTexture()->transparency = 1.0f;
       m_author->SetPosition(0, 0, m_z_text_position);
       m_author->GetFrame()->index_buffer = 0;
@@ -22,46 +22,12 @@ namespace Tunnelour {
 // public:
 //------------------------------------------------------------------------------
 Tile_Bitmap::Tile_Bitmap(): Bitmap_Component() {
-  m_is_floor = false;
-  m_is_right_wall = false;
-  m_is_left_wall = false;
-  m_is_roof = false;
-  m_is_top_edge = false;
-  m_is_bottom_edge = false;
-  m_is_right_edge = false;
-  m_is_left_edge = false;
-  m_is_collidable = false;
-
-  m_is_right_floor_end = false;
-  m_is_left_floor_end = false;
-  m_is_right_roof_end = false;
-  m_is_left_roof_end = false;
-  m_is_top_right_wall_end = false;
-  m_is_bot_right_wall_end = false;
-  m_is_top_left_wall_end = false;
-  m_is_bot_left_wall_end = false;
-
-  m_is_left_exit = false;
-  m_is_right_exit = false;
-
-  m_is_middleground = false;
-  m_is_background = false;
+  m_class_mask = 0;
 }
 
 //------------------------------------------------------------------------------
 Tile_Bitmap::~Tile_Bitmap() {
-  m_is_floor = false;
-  m_is_right_wall = false;
-  m_is_left_wall = false;
-  m_is_roof = false;
-  m_is_top_edge = false;
-  m_is_bottom_edge = false;
-  m_is_right_edge = false;
-  m_is_left_edge = false;
-  m_is_collidable = false;
-
-  m_is_middleground = false;
-  m_is_background = false;
+  m_class_mask = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -70,6 +36,30 @@ void Tile_Bitmap::Init() {
   m_is_initialised = true;
 }
 
+//------------------------------------------------------------------------------
+unsigned int Tile_Bitmap::GetClassMask() {
+  return m_class_mask;
+}
+
+//------------------------------------------------------------------------------
+bool Tile_Bitmap::IsAnyOf(unsigned int class_mask) {
+  return (m_class_mask & class_mask) != 0;
+}
+
+//------------------------------------------------------------------------------
+bool Tile_Bitmap::IsAllOf(unsigned int class_mask) {
+  return (m_class_mask & class_mask) == class_mask;
+}
+
+//------------------------------------------------------------------------------
+void Tile_Bitmap::SetClass(unsigned int class_mask, bool is_in_class) {
+  if (is_in_class) {
+    m_class_mask |= class_mask;
+  } else {
+    m_class_mask &= ~class_mask;
+  }
+}
+
 //------------------------------------------------------------------------------
 // protected:
 //------------------------------------------------------------------------------
@@ -120,20 +110,19 @@ void Tile_Bitmap::Init_Frame() {
 
   // Load the vertex array with data
   // First triangle
+  // The texture coordinates cover the whole quad, GetUVRect() selects the
+  // tile on the texture at draw time.
   // Top left
   m_frame->vertices[0].position = D3DXVECTOR3(left, top, 0.0f);
-  m_frame->vertices[0].texture =  D3DXVECTOR2((m_texture->top_left_position.x / m_texture->texture_size.x),
-                                              m_texture->top_left_position.y / m_texture->texture_size.y);
+  m_frame->vertices[0].texture = D3DXVECTOR2(0.0f, 0.0f);
 
   // Bottom right
   m_frame->vertices[1].position = D3DXVECTOR3(right, bottom, 0.0f);
-  m_frame->vertices[1].texture = D3DXVECTOR2((m_texture->tile_size.x + m_texture->top_left_position.x) / m_texture->texture_size.x,
-                                             (m_texture->tile_size.y + m_texture->top_left_position.y) / m_texture->texture_size.y);
+  m_frame->vertices[1].texture = D3DXVECTOR2(1.0f, 1.0f);
 
   // Bottom left
   m_frame->vertices[2].position = D3DXVECTOR3(left, bottom, 0.0f);
-  m_frame->vertices[2].texture = D3DXVECTOR2(m_texture->top_left_position.x / m_texture->texture_size.x,
-                                            (m_texture->tile_size.y + m_texture->top_left_position.y) / m_texture->texture_size.y);
+  m_frame->vertices[2].texture = D3DXVECTOR2(0.0f, 1.0f);
 
   // Second triangle.
   // Top left
@@ -141,8 +130,7 @@ void Tile_Bitmap::Init_Frame() {
   m_frame->vertices[3].texture = m_frame->vertices[0].texture;
   // Top right
   m_frame->vertices[4].position = D3DXVECTOR3(right, top, 0.0f);
-  m_frame->vertices[4].texture = D3DXVECTOR2((m_texture->tile_size.x + m_texture->top_left_position.x) / m_texture->texture_size.x,
-                                              m_texture->top_left_position.y / m_texture->texture_size.y);
+  m_frame->vertices[4].texture = D3DXVECTOR2(1.0f, 0.0f);
   // Bottom right
   m_frame->vertices[5].position = D3DXVECTOR3(right, bottom, 0.0f);
   m_frame->vertices[5].texture = m_frame->vertices[1].texture;
@@ -162,231 +150,236 @@ void Tile_Bitmap::Init_Frame() {
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsFloor() {
-  return m_is_floor;
+  return IsAnyOf(FLOOR);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsFloor(bool is_floor) {
-  m_is_floor = is_floor;
+  SetClass(FLOOR, is_floor);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsRightFloorEnd() {
-  return m_is_right_floor_end;
+  return IsAnyOf(RIGHT_FLOOR_END);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsRightFloorEnd(bool is_right_floor_end) {
-  m_is_right_floor_end = is_right_floor_end;
+  SetClass(RIGHT_FLOOR_END, is_right_floor_end);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsLeftFloorEnd() {
-  return m_is_left_floor_end;
+  return IsAnyOf(LEFT_FLOOR_END);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsLeftFloorEnd(bool is_left_floor_end) {
-  m_is_left_floor_end = is_left_floor_end;
+  SetClass(LEFT_FLOOR_END, is_left_floor_end);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsRoof() {
-  return m_is_roof;
+  return IsAnyOf(ROOF);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsRoof(bool is_roof) {
-  m_is_roof = is_roof;
+  SetClass(ROOF, is_roof);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsRightRoofEnd() {
-  return m_is_right_roof_end;
+  return IsAnyOf(RIGHT_ROOF_END);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsRightRoofEnd(bool is_right_roof_end) {
-  m_is_right_roof_end = is_right_roof_end;
+  SetClass(RIGHT_ROOF_END, is_right_roof_end);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsLeftRoofEnd() {
-  return m_is_left_roof_end;
+  return IsAnyOf(LEFT_ROOF_END);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsLeftRoofEnd(bool is_left_roof_end) {
-  m_is_left_roof_end = is_left_roof_end;
+  SetClass(LEFT_ROOF_END, is_left_roof_end);
 }
 
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsWall() {
-  if (m_is_right_wall) {
-    return true;
-  } else if (m_is_left_wall) {
-    return true;
-  }
-
-  return false;
+  return IsAnyOf(WALL);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsRightWall() {
-  return m_is_right_wall;
+  return IsAnyOf(RIGHT_WALL);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsRightWall(bool is_wall) {
-  m_is_right_wall = is_wall;
+  SetClass(RIGHT_WALL, is_wall);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsTopRightWallEnd() {
-  return m_is_top_right_wall_end;
+  return IsAnyOf(TOP_RIGHT_WALL_END);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsTopRightWallEnd(bool is_top_right_wall_end) {
-  m_is_top_right_wall_end = is_top_right_wall_end;
+  SetClass(TOP_RIGHT_WALL_END, is_top_right_wall_end);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsBotRightWallEnd() {
-  return m_is_bot_right_wall_end;
+  return IsAnyOf(BOT_RIGHT_WALL_END);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsBotRightWallEnd(bool is_bot_right_wall_end) {
-  m_is_bot_right_wall_end = is_bot_right_wall_end;
+  SetClass(BOT_RIGHT_WALL_END, is_bot_right_wall_end);
 }
 
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsLeftWall() {
-  return m_is_left_wall;
+  return IsAnyOf(LEFT_WALL);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsLeftWall(bool is_wall) {
-  m_is_left_wall = is_wall;
+  SetClass(LEFT_WALL, is_wall);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsTopLeftWallEnd() {
-  return m_is_top_left_wall_end;
+  return IsAnyOf(TOP_LEFT_WALL_END);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsTopLeftWallEnd(bool is_top_left_wall_end) {
-  m_is_top_left_wall_end = is_top_left_wall_end;
+  SetClass(TOP_LEFT_WALL_END, is_top_left_wall_end);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsBotLeftWallEnd() {
-  return m_is_bot_left_wall_end;
+  return IsAnyOf(BOT_LEFT_WALL_END);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsBotLeftWallEnd(bool is_bot_left_wall_end) {
-  m_is_bot_left_wall_end = is_bot_left_wall_end;
+  SetClass(BOT_LEFT_WALL_END, is_bot_left_wall_end);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsTopEdge() {
-  return m_is_top_edge;
+  return IsAnyOf(TOP_EDGE);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsTopEdge(bool is_top_edge) {
-  m_is_top_edge = is_top_edge;
+  SetClass(TOP_EDGE, is_top_edge);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsBottomEdge() {
-  return m_is_bottom_edge;
+  return IsAnyOf(BOTTOM_EDGE);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsBottomEdge(bool is_bottom_edge) {
-  m_is_bottom_edge = is_bottom_edge;
+  SetClass(BOTTOM_EDGE, is_bottom_edge);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsRightEdge() {
-  return m_is_right_edge;
+  return IsAnyOf(RIGHT_EDGE);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsRightEdge(bool is_right_edge) {
-  m_is_right_edge = is_right_edge;
+  SetClass(RIGHT_EDGE, is_right_edge);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsLeftEdge() {
-  return m_is_left_edge;
+  return IsAnyOf(LEFT_EDGE);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsLeftEdge(bool is_left_edge) {
-  m_is_left_edge = is_left_edge;
+  SetClass(LEFT_EDGE, is_left_edge);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsCollidable() {
-  return m_is_collidable;
+  return IsAnyOf(COLLIDABLE);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsCollidable(bool is_collidable) {
-  m_is_collidable = is_collidable;
+  SetClass(COLLIDABLE, is_collidable);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsEdge() {
-  return IsTopEdge() || IsBottomEdge() || IsRightEdge() || IsLeftEdge() ||
-         IsFloor() || IsRoof() || IsWall();
+  return IsAnyOf(TOP_EDGE | BOTTOM_EDGE | RIGHT_EDGE | LEFT_EDGE | FLOOR | ROOF | WALL);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsLeftExit() {
-  return m_is_left_exit;
+  return IsAnyOf(LEFT_EXIT);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsLeftExit(bool is_left_exit) {
-  m_is_left_exit = is_left_exit;
+  SetClass(LEFT_EXIT, is_left_exit);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsRightExit() {
-  return m_is_right_exit;
+  return IsAnyOf(RIGHT_EXIT);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsRightExit(bool is_right_exit) {
-  m_is_right_exit = is_right_exit;
+  SetClass(RIGHT_EXIT, is_right_exit);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsMiddleground() {
-  return m_is_middleground;
+  return IsAnyOf(MIDDLEGROUND);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsMiddleground(bool is_middleground) {
-  m_is_middleground = is_middleground;
+  SetClass(MIDDLEGROUND, is_middleground);
 }
 
 //------------------------------------------------------------------------------
 bool Tile_Bitmap::IsBackground() {
-  return m_is_background;
+  return IsAnyOf(BACKGROUND);
 }
 
 //------------------------------------------------------------------------------
 void Tile_Bitmap::SetIsBackground(bool is_background) {
-  m_is_background = is_background;
+  SetClass(BACKGROUND, is_background);
+}
+
+//------------------------------------------------------------------------------
+bool Tile_Bitmap::IsOpaque() {
+  if (IsBackground()) {
+    return !IsAnyOf(EXIT);
+  }
+  if (IsMiddleground()) {
+    // Only the tunnel edges of the middleground are cut out.
+    return !IsAnyOf(FLOOR | ROOF | WALL | FLOOR_END | ROOF_END | WALL_END);
+  }
+  return false;
 }
 
 }  // namespace Tunnelour
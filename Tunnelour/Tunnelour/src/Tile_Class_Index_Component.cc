@@ -0,0 +1,90 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Tile_Class_Index_Component.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Tile_Class_Index_Component::Tile_Class_Index_Component(): Component() {
+  m_type = "Tile_Class_Index_Component";
+  m_model = 0;
+}
+
+//------------------------------------------------------------------------------
+Tile_Class_Index_Component::~Tile_Class_Index_Component() {
+  if (m_model != 0) {
+    m_model->IgnoreType(this, "Bitmap_Component");
+    m_model = 0;
+  }
+  m_tiles.Clear();
+}
+
+//------------------------------------------------------------------------------
+void Tile_Class_Index_Component::Init() {
+  m_tiles.Clear();
+  m_is_initialised = true;
+}
+
+//------------------------------------------------------------------------------
+void Tile_Class_Index_Component::ObserveModel(Component_Composite *model) {
+  if (m_model != 0) {
+    m_model->IgnoreType(this, "Bitmap_Component");
+  }
+  m_model = model;
+  m_model->ObserveType(this, "Bitmap_Component");
+}
+
+//------------------------------------------------------------------------------
+Tile_Grid* Tile_Class_Index_Component::GetTiles() {
+  return &m_tiles;
+}
+
+//------------------------------------------------------------------------------
+unsigned int Tile_Class_Index_Component::GetVersion() {
+  return m_tiles.GetVersion();
+}
+
+//------------------------------------------------------------------------------
+void Tile_Class_Index_Component::HandleEventAdd(Tunnelour::Component * const component) {
+  Tile_Bitmap *tile = static_cast<Tile_Bitmap*>(component);
+  if (tile->IsAnyOf(INDEXED_CLASSES)) {
+    m_tiles.Add(tile);
+  }
+}
+
+//------------------------------------------------------------------------------
+void Tile_Class_Index_Component::HandleEventRemove(Tunnelour::Component * const component) {
+  m_tiles.Remove(static_cast<Tile_Bitmap*>(component));
+}
+
+//------------------------------------------------------------------------------
+void Tile_Class_Index_Component::HandleEventUpdate(Tunnelour::Component * const component) {
+  // The tile may no longer be a wall or floor
+  HandleEventRemove(component);
+  HandleEventAdd(component);
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+
+}  // namespace Tunnelour
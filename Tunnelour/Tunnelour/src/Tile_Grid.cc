@@ -0,0 +1,257 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Tile_Grid.h"
+#include <algorithm>
+#include <math.h>
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Tile_Grid::Tile_Grid() {
+  m_cell_size = 128;
+  m_next_order = 0;
+  m_version = 0;
+}
+
+//------------------------------------------------------------------------------
+Tile_Grid::Tile_Grid(float cell_size) {
+  m_cell_size = cell_size;
+  m_next_order = 0;
+  m_version = 0;
+}
+
+//------------------------------------------------------------------------------
+Tile_Grid::~Tile_Grid() {
+  Clear();
+}
+
+//------------------------------------------------------------------------------
+void Tile_Grid::Add(Tile_Bitmap *tile) {
+  Remove(tile);
+
+  AABB bounds = AABB::FromCentre(tile->GetFixedPosition(), tile->GetSize());
+  Cell_Range range = GetCellRange(bounds, m_cell_size);
+
+  Cell_Entry entry;
+  entry.tile = tile;
+  entry.order = m_next_order++;
+  entry.class_mask = tile->GetClassMask();
+  for (int x = range.left; x <= range.right; x++) {
+    for (int y = range.bottom; y <= range.top; y++) {
+      Cell &cell = m_cells[GetCellKey(x, y)];
+      cell.entries.push_back(entry);
+      cell.bounds.Add(bounds);
+      cell.class_mask |= entry.class_mask;
+    }
+  }
+
+  m_tile_cells[tile] = range;
+  m_version++;
+}
+
+//------------------------------------------------------------------------------
+void Tile_Grid::Add(std::vector<Tile_Bitmap*> const &tiles) {
+  std::vector<Tile_Bitmap*>::const_iterator tile;
+  for (tile = tiles.begin(); tile != tiles.end(); tile++) {
+    Add(*tile);
+  }
+}
+
+//------------------------------------------------------------------------------
+void Tile_Grid::Remove(Tile_Bitmap *tile) {
+  std::unordered_map<Tile_Bitmap*, Cell_Range>::iterator found_tile = m_tile_cells.find(tile);
+  if (found_tile == m_tile_cells.end()) {
+    return;
+  }
+
+  Cell_Range range = found_tile->second;
+  for (int x = range.left; x <= range.right; x++) {
+    for (int y = range.bottom; y <= range.top; y++) {
+      std::unordered_map<long long, Cell>::iterator cell = m_cells.find(GetCellKey(x, y));
+      if (cell == m_cells.end()) {
+        continue;
+      }
+      std::vector<Cell_Entry> &entries = cell->second.entries;
+      for (unsigned int index = 0; index < entries.size(); index++) {
+        if (entries[index].tile == tile) {
+          entries.erase(entries.begin() + index);
+          cell->second.bounds.Remove(index);
+          break;
+        }
+      }
+      cell->second.class_mask = 0;
+      std::vector<Cell_Entry>::iterator entry;
+      for (entry = entries.begin(); entry != entries.end(); entry++) {
+        cell->second.class_mask |= entry->class_mask;
+      }
+      if (entries.empty()) {
+        m_cells.erase(cell);
+      }
+    }
+  }
+
+  m_tile_cells.erase(found_tile);
+  m_version++;
+}
+
+//------------------------------------------------------------------------------
+void Tile_Grid::Clear() {
+  m_cells.clear();
+  m_tile_cells.clear();
+  m_query_entries.clear();
+  m_query_tiles.clear();
+  m_query_hit_mask.clear();
+  m_next_order = 0;
+  m_version++;
+}
+
+//------------------------------------------------------------------------------
+bool Tile_Grid::Contains(Tile_Bitmap *tile) {
+  return m_tile_cells.find(tile) != m_tile_cells.end();
+}
+
+//------------------------------------------------------------------------------
+bool Tile_Grid::IsEmpty() {
+  return m_tile_cells.empty();
+}
+
+//------------------------------------------------------------------------------
+unsigned int Tile_Grid::GetSize() {
+  return static_cast<unsigned int>(m_tile_cells.size());
+}
+
+//------------------------------------------------------------------------------
+unsigned int Tile_Grid::GetVersion() {
+  return m_version;
+}
+
+//------------------------------------------------------------------------------
+std::vector<Tile_Bitmap*> const & Tile_Grid::Query(AABB const &area) {
+  return QueryCells(area, 0, false);
+}
+
+//------------------------------------------------------------------------------
+std::vector<Tile_Bitmap*> const & Tile_Grid::Query(AABB const &area, unsigned int class_mask) {
+  return QueryCells(area, class_mask, true);
+}
+
+//------------------------------------------------------------------------------
+bool Tile_Grid::FindTouchingBounds(AABB const &area, unsigned int class_mask, AABB *out_bounds) {
+  bool is_touching = false;
+  Cell_Range range = GetCellRange(area, m_cell_size);
+  for (int x = range.left; x <= range.right; x++) {
+    for (int y = range.bottom; y <= range.top; y++) {
+      std::unordered_map<long long, Cell>::iterator cell = m_cells.find(GetCellKey(x, y));
+      if (cell == m_cells.end() || (cell->second.class_mask & class_mask) == 0) {
+        continue;
+      }
+      // A tile in several cells is unioned more than once, which is harmless
+      std::vector<Cell_Entry> const &entries = cell->second.entries;
+      for (unsigned int index = 0; index < entries.size(); index++) {
+        if ((entries[index].class_mask & class_mask) == 0) {
+          continue;
+        }
+        AABB bounds = cell->second.bounds.GetAABB(index);
+        if (!bounds.IsTouching(area)) {
+          continue;
+        }
+        if (is_touching) {
+          *out_bounds = out_bounds->Union(bounds);
+        } else {
+          *out_bounds = bounds;
+          is_touching = true;
+        }
+      }
+    }
+  }
+  return is_touching;
+}
+
+//------------------------------------------------------------------------------
+Tile_Grid::Cell_Range Tile_Grid::GetCellRange(AABB const &area, float cell_size) {
+  // The bounds are inclusive so tiles which only touch the area are found,
+  // the avatar standing on a floor only touches it.
+  Cell_Range range;
+  range.left = static_cast<int>(floor(area.GetLeft() / cell_size));
+  range.right = static_cast<int>(floor(area.GetRight() / cell_size));
+  range.bottom = static_cast<int>(floor(area.GetBottom() / cell_size));
+  range.top = static_cast<int>(floor(area.GetTop() / cell_size));
+  return range;
+}
+
+//------------------------------------------------------------------------------
+long long Tile_Grid::GetCellKey(int x, int y) {
+  return (static_cast<long long>(x) << 32) | static_cast<unsigned int>(y);
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+std::vector<Tile_Bitmap*> const & Tile_Grid::QueryCells(AABB const &area, unsigned int class_mask, bool is_class_filtered) {
+  m_query_tiles.clear();
+  m_query_entries.clear();
+
+  Cell_Range range = GetCellRange(area, m_cell_size);
+  for (int x = range.left; x <= range.right; x++) {
+    for (int y = range.bottom; y <= range.top; y++) {
+      std::unordered_map<long long, Cell>::iterator cell = m_cells.find(GetCellKey(x, y));
+      if (cell == m_cells.end()) {
+        continue;
+      }
+      if (is_class_filtered && (cell->second.class_mask & class_mask) == 0) {
+        continue;
+      }
+      // Only the tiles in the cell which touch the area are kept
+      std::vector<Cell_Entry> &entries = cell->second.entries;
+      cell->second.bounds.GetTouchingMask(area, &m_query_hit_mask);
+      for (unsigned int index = 0; index < entries.size(); index++) {
+        if (is_class_filtered && (entries[index].class_mask & class_mask) == 0) {
+          continue;
+        }
+        if (AABB_Batch::IsHit(m_query_hit_mask, index)) {
+          m_query_entries.push_back(entries[index]);
+        }
+      }
+    }
+  }
+
+  // A tile spanning several of the queried cells is only returned once, and
+  // in the order it was added so callers see the same order as a full scan.
+  std::sort(m_query_entries.begin(), m_query_entries.end(), IsEntryOlder);
+  unsigned int last_order = 0;
+  std::vector<Cell_Entry>::iterator entry;
+  for (entry = m_query_entries.begin(); entry != m_query_entries.end(); entry++) {
+    if (m_query_tiles.empty() || entry->order != last_order) {
+      m_query_tiles.push_back(entry->tile);
+      last_order = entry->order;
+    }
+  }
+
+  return m_query_tiles;
+}
+
+//------------------------------------------------------------------------------
+bool Tile_Grid::IsEntryOlder(Cell_Entry const &a, Cell_Entry const &b) {
+  return a.order < b.order;
+}
+
+}  // namespace Tunnelour
@@ -0,0 +1,150 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Trigger_Volumes.h"
+#include <algorithm>
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+Trigger_Volumes::Trigger_Volumes() {
+  m_cell_size = 128;
+  m_has_range = false;
+}
+
+//------------------------------------------------------------------------------
+Trigger_Volumes::Trigger_Volumes(float cell_size) {
+  m_cell_size = cell_size;
+  m_has_range = false;
+}
+
+//------------------------------------------------------------------------------
+Trigger_Volumes::~Trigger_Volumes() {
+  Clear();
+}
+
+//------------------------------------------------------------------------------
+unsigned int Trigger_Volumes::Add(AABB const &bounds) {
+  unsigned int volume = static_cast<unsigned int>(m_volumes.size());
+  m_volumes.push_back(bounds);
+  m_is_inside.push_back(false);
+
+  Tile_Grid::Cell_Range range = Tile_Grid::GetCellRange(bounds, m_cell_size);
+  for (int x = range.left; x <= range.right; x++) {
+    for (int y = range.bottom; y <= range.top; y++) {
+      m_cells[Tile_Grid::GetCellKey(x, y)].push_back(volume);
+    }
+  }
+
+  // The tracked area may already be in the new volume's cells
+  m_has_range = false;
+  return volume;
+}
+
+//------------------------------------------------------------------------------
+void Trigger_Volumes::Clear() {
+  m_volumes.clear();
+  m_is_inside.clear();
+  m_cells.clear();
+  m_has_range = false;
+  m_nearby_volumes.clear();
+  m_inside_volumes.clear();
+  m_events.clear();
+}
+
+//------------------------------------------------------------------------------
+unsigned int Trigger_Volumes::GetSize() {
+  return static_cast<unsigned int>(m_volumes.size());
+}
+
+//------------------------------------------------------------------------------
+std::vector<Trigger_Volumes::Trigger_Event> const & Trigger_Volumes::Update(AABB const &bounds) {
+  m_events.clear();
+
+  Tile_Grid::Cell_Range range = Tile_Grid::GetCellRange(bounds, m_cell_size);
+  if (!m_has_range || !(range == m_range)) {
+    FindNearbyVolumes(range);
+    m_range = range;
+    m_has_range = true;
+
+    // Volumes no longer nearby can no longer be overlapped
+    for (unsigned int index = 0; index < m_inside_volumes.size(); ) {
+      unsigned int volume = m_inside_volumes[index];
+      if (std::find(m_nearby_volumes.begin(), m_nearby_volumes.end(), volume) == m_nearby_volumes.end()) {
+        SetIsInside(volume, false);
+      } else {
+        index++;
+      }
+    }
+  }
+
+  std::vector<unsigned int>::iterator volume;
+  for (volume = m_nearby_volumes.begin(); volume != m_nearby_volumes.end(); volume++) {
+    bool is_inside = m_volumes[*volume].IsIntersecting(bounds);
+    if (is_inside != m_is_inside[*volume]) {
+      SetIsInside(*volume, is_inside);
+    }
+  }
+
+  return m_events;
+}
+
+//------------------------------------------------------------------------------
+bool Trigger_Volumes::IsInside(unsigned int volume) {
+  return m_is_inside[volume];
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void Trigger_Volumes::FindNearbyVolumes(Tile_Grid::Cell_Range const &range) {
+  m_nearby_volumes.clear();
+  for (int x = range.left; x <= range.right; x++) {
+    for (int y = range.bottom; y <= range.top; y++) {
+      std::unordered_map<long long, std::vector<unsigned int>>::iterator cell = m_cells.find(Tile_Grid::GetCellKey(x, y));
+      if (cell == m_cells.end()) {
+        continue;
+      }
+      m_nearby_volumes.insert(m_nearby_volumes.end(), cell->second.begin(), cell->second.end());
+    }
+  }
+
+  // A volume spanning several cells is only tested once
+  std::sort(m_nearby_volumes.begin(), m_nearby_volumes.end());
+  m_nearby_volumes.erase(std::unique(m_nearby_volumes.begin(), m_nearby_volumes.end()), m_nearby_volumes.end());
+}
+
+//------------------------------------------------------------------------------
+void Trigger_Volumes::SetIsInside(unsigned int volume, bool is_inside) {
+  m_is_inside[volume] = is_inside;
+  if (is_inside) {
+    m_inside_volumes.push_back(volume);
+  } else {
+    m_inside_volumes.erase(std::find(m_inside_volumes.begin(), m_inside_volumes.end(), volume));
+  }
+
+  Trigger_Event trigger_event;
+  trigger_event.volume = volume;
+  trigger_event.is_entering = is_inside;
+  m_events.push_back(trigger_event);
+}
+
+}  // namespace Tunnelour
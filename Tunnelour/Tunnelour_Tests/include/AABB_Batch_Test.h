@@ -0,0 +1,71 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_AABB_BATCH_TEST_H_
+#define TUNNELOUR_AABB_BATCH_TEST_H_
+
+#include <vector>
+#include "AABB.h"
+#include "AABB_Batch.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : AABB_Batch_Test checks the SSE2 GetTouchingMask against
+//                GetTouchingMaskScalar on batches of every size up to a few
+//                mask words, and times the two against each other.
+//-----------------------------------------------------------------------------
+class AABB_Batch_Test {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Runs the checks then the benchmark
+  //---------------------------------------------------------------------------
+  static void Run();
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Checks both masks agree on batches of 0 to 100 bounds, so
+  //               sizes which are not a multiple of four and masks of more
+  //               than one word are covered.
+  //---------------------------------------------------------------------------
+  static void TestMasksMatchScalar();
+
+  //---------------------------------------------------------------------------
+  // Description : Checks Remove keeps the masks in order with the bounds
+  //---------------------------------------------------------------------------
+  static void TestRemoveKeepsOrder();
+
+  //---------------------------------------------------------------------------
+  // Description : Times the masks on a batch of the given size, reporting
+  //               how much faster the SSE2 mask is.
+  //---------------------------------------------------------------------------
+  static void BenchmarkBatch(unsigned int size);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns a random box, some of which only touch an edge of
+  //               one of the bounds
+  //---------------------------------------------------------------------------
+  static AABB GetRandomBox(std::vector<AABB> const &bounds);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns whether the mask has exactly the bits of the
+  //               bounds which touch the box, and no bits past the end
+  //---------------------------------------------------------------------------
+  static bool IsMaskMatchingScan(std::vector<unsigned int> const &hit_mask, std::vector<AABB> const &bounds, AABB const &box);
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_AABB_BATCH_TEST_H_
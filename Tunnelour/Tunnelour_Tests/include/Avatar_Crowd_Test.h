@@ -0,0 +1,89 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#ifndef TUNNELOUR_AVATAR_CROWD_TEST_H_
+#define TUNNELOUR_AVATAR_CROWD_TEST_H_
+
+#include <vector>
+#include "Animation_Library.h"
+#include "Avatar_Crowd.h"
+#include "Tile_Bitmap.h"
+#include "Tile_Grid.h"
+#include "World_Settings_Component.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Avatar_Crowd_Test steps crowds of avatars through a
+//                generated level without a view. It checks the crowd split
+//                across threads ends every tick where stepping it in one
+//                range does, and times the crowd on one thread and on many.
+//-----------------------------------------------------------------------------
+class Avatar_Crowd_Test {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Runs the checks then the benchmark
+  //---------------------------------------------------------------------------
+  static void Run();
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Checks the positions and states of a crowd stepped by
+  //               Update on several threads match a crowd stepped by
+  //               Update(0, size) after every tick.
+  //---------------------------------------------------------------------------
+  static void TestThreadedUpdateMatchesOneRange(Animation_Library *animation_library,
+                                                Tile_Grid *tiles,
+                                                std::vector<Tile_Bitmap*> const &tunnel_tiles,
+                                                World_Settings_Component *world_settings);
+
+  //---------------------------------------------------------------------------
+  // Description : Times avatar_count avatars on one thread and on as many
+  //               as Update will use, in avatars stepped per millisecond
+  //---------------------------------------------------------------------------
+  static void BenchmarkCrowd(unsigned int avatar_count,
+                             Animation_Library *animation_library,
+                             Tile_Grid *tiles,
+                             std::vector<Tile_Bitmap*> const &tunnel_tiles,
+                             World_Settings_Component *world_settings);
+
+  //---------------------------------------------------------------------------
+  // Description : Steps the crowd one tick in thread_count ranges, each on a
+  //               thread of its own whatever the hardware has
+  //---------------------------------------------------------------------------
+  static void UpdateOnThreads(Avatar_Crowd *crowd, unsigned int thread_count);
+
+  //---------------------------------------------------------------------------
+  // Description : Loads the running and falling animations the crowd uses
+  //---------------------------------------------------------------------------
+  static void LoadAnimations(Animation_Library *out_animation_library);
+
+  //---------------------------------------------------------------------------
+  // Description : Adds avatar_count avatars to the crowd, each starting in
+  //               a random tunnel tile and facing a random way.
+  //---------------------------------------------------------------------------
+  static void AddAvatars(Avatar_Crowd *crowd, unsigned int avatar_count, std::vector<Tile_Bitmap*> const &tunnel_tiles, unsigned int seed);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of avatars whose position, state or
+  //               direction differ between the two crowds
+  //---------------------------------------------------------------------------
+  static unsigned int CountMismatchedAvatars(Avatar_Crowd *crowd, Avatar_Crowd *expected_crowd);
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_AVATAR_CROWD_TEST_H_
@@ -0,0 +1,67 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_AVATAR_STATE_WATCH_TEST_H_
+#define TUNNELOUR_AVATAR_STATE_WATCH_TEST_H_
+
+#include "Avatar_Component.h"
+#include "Avatar_State_Watch.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Avatar_State_Watch_Test plays an avatar's frames the way
+//                input, the state controllers and the view do, and checks
+//                the level's end conditions would be skipped while it is
+//                idle but checked again when its state changes.
+//-----------------------------------------------------------------------------
+class Avatar_State_Watch_Test {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Runs the checks
+  //---------------------------------------------------------------------------
+  static void Run();
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Checks an idle avatar, whose command and state are set
+  //               and rendered every frame without changing, is not seen to
+  //               change and its state version stays put.
+  //---------------------------------------------------------------------------
+  static void TestIdleAvatarIsSkipped();
+
+  //---------------------------------------------------------------------------
+  // Description : Checks a new state is seen once it is set and again once
+  //               it is rendered, and a new command alone is not seen.
+  //---------------------------------------------------------------------------
+  static void TestStateChangeIsSeen();
+
+  //---------------------------------------------------------------------------
+  // Description : Plays one frame, returns true if the watch saw a change
+  //---------------------------------------------------------------------------
+  static bool PlayFrame(Avatar_Component *avatar,
+                        Avatar_State_Watch *watch,
+                        Avatar_Component::Avatar_State const &command,
+                        Avatar_Component::Avatar_State const &state);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns a running state facing the direction
+  //---------------------------------------------------------------------------
+  static Avatar_Component::Avatar_State GetState(unsigned int state_index, Avatar_Component::Direction direction);
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_AVATAR_STATE_WATCH_TEST_H_
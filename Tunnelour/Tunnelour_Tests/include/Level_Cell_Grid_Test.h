@@ -0,0 +1,88 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_LEVEL_CELL_GRID_TEST_H_
+#define TUNNELOUR_LEVEL_CELL_GRID_TEST_H_
+
+#include <string>
+#include <vector>
+#include "Level_Component.h"
+#include "Tile_Bitmap.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Level_Cell_Grid_Test checks the tiles placed and classified
+//                by Level_Cell_Grid against the builder it replaced, which
+//                searched the line above each tile for its neighbours, and
+//                times the two on a 1000 by 1000 level.
+//-----------------------------------------------------------------------------
+class Level_Cell_Grid_Test {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Runs the checks then the benchmark
+  //---------------------------------------------------------------------------
+  static void Run();
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Checks the shipped level's tiles match the old builder's
+  //---------------------------------------------------------------------------
+  static void TestShippedLevelMatchesOldBuilder();
+
+  //---------------------------------------------------------------------------
+  // Description : Checks generated levels' tiles match the old builder's
+  //---------------------------------------------------------------------------
+  static void TestGeneratedLevelsMatchOldBuilder();
+
+  //---------------------------------------------------------------------------
+  // Description : Times both builders on a generated level of columns by
+  //               rows tiles
+  //---------------------------------------------------------------------------
+  static void BenchmarkBuilders(int columns, int rows);
+
+  //---------------------------------------------------------------------------
+  // Description : Reads a level CSV the way Level_Controller does
+  //---------------------------------------------------------------------------
+  static void LoadLevelCSV(std::string level_csv_path, Level_Component::Level_Metadata *out_level_metadata);
+
+  //---------------------------------------------------------------------------
+  // Description : Places and classifies the level's tiles as the builder
+  //               before Level_Cell_Grid did, for 128 pixel tiles. Like it,
+  //               each line has to start with a middleground tile.
+  //---------------------------------------------------------------------------
+  static void BuildWithOldBuilder(Level_Component::Level_Metadata const &level_metadata, std::vector<Tile_Bitmap*> *out_tiles);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns whether the tile is directly above the other tile,
+  //               the test the old builder made with Bitmap_Helper
+  //---------------------------------------------------------------------------
+  static bool IsTileAbove(Tile_Bitmap *above_tile, Tile_Bitmap *tile);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of tiles whose position or class mask
+  //               differ between the two lists
+  //---------------------------------------------------------------------------
+  static unsigned int CountMismatchedTiles(std::vector<Tile_Bitmap*> const &tiles, std::vector<Tile_Bitmap*> const &expected_tiles);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns whether every tile in the level is 128 pixels
+  //---------------------------------------------------------------------------
+  static bool IsAll128Tiles(Level_Component::Level_Metadata const &level_metadata);
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_LEVEL_CELL_GRID_TEST_H_
@@ -0,0 +1,83 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#ifndef TUNNELOUR_SNAPSHOT_BUFFER_TEST_H_
+#define TUNNELOUR_SNAPSHOT_BUFFER_TEST_H_
+
+#include <vector>
+#include "Snapshot_Buffer.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Snapshot_Buffer_Test pushes snapshots into a
+//                Snapshot_Buffer and checks every one it still holds is got
+//                back as it was pushed, whichever keyframe it is decoded from
+//                and after the bytes have wrapped around.
+//-----------------------------------------------------------------------------
+class Snapshot_Buffer_Test {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Runs the checks
+  //---------------------------------------------------------------------------
+  static void Run();
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Checks changes of every size either way, up to wrapping
+  //               from the largest to the smallest int, come back exactly and
+  //               small changes take a byte each.
+  //---------------------------------------------------------------------------
+  static void TestDeltasRoundTrip();
+
+  //---------------------------------------------------------------------------
+  // Description : Checks snapshots just before, on and just after each
+  //               keyframe are got back whichever is the newest.
+  //---------------------------------------------------------------------------
+  static void TestGetAcrossKeyframes();
+
+  //---------------------------------------------------------------------------
+  // Description : Checks rewinding a buffer whose bytes have wrapped around
+  //               keeps the older snapshots and the ones pushed after it.
+  //---------------------------------------------------------------------------
+  static void TestRewindAfterWrap();
+
+  //---------------------------------------------------------------------------
+  // Description : Pushes the snapshot into the buffer and the list
+  //---------------------------------------------------------------------------
+  static void Push(Snapshot_Buffer *buffer, std::vector<int> const &fields, std::vector<std::vector<int>> *out_pushed);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of snapshots the buffer holds which are
+  //               not the same as the last ones in the list
+  //---------------------------------------------------------------------------
+  static unsigned int CountMismatchedSnapshots(Snapshot_Buffer *buffer, std::vector<std::vector<int>> const &pushed);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the fields with a random change to some of them,
+  //               from a step either way to anything at all
+  //---------------------------------------------------------------------------
+  static std::vector<int> ChangeFields(std::vector<int> const &fields);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns value plus change, wrapping past the ends of int
+  //               as the buffer's deltas do
+  //---------------------------------------------------------------------------
+  static int AddWrapping(int value, int change);
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_SNAPSHOT_BUFFER_TEST_H_
@@ -0,0 +1,96 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#ifndef TUNNELOUR_TEST_HELPER_H_
+#define TUNNELOUR_TEST_HELPER_H_
+
+#include <windows.h>
+#include <string>
+#include <vector>
+#include "Level_Component.h"
+#include "Tile_Bitmap.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Test_Helper counts and prints the checks made by the tests
+//                and times the benchmarks with the performance counter.
+//                It also makes the generated levels and tiles the tests share.
+//-----------------------------------------------------------------------------
+class Test_Helper {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Prints the name of the tests about to run
+  //---------------------------------------------------------------------------
+  static void StartTests(std::string const &name);
+
+  //---------------------------------------------------------------------------
+  // Description : Counts a check, printing the description if it failed
+  //---------------------------------------------------------------------------
+  static void Check(bool is_passed, std::string const &description);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the number of checks made and failed so far
+  //---------------------------------------------------------------------------
+  static unsigned int GetCheckCount();
+
+  static unsigned int GetFailureCount();
+
+  //---------------------------------------------------------------------------
+  // Description : Prints a measurement made by a benchmark
+  //---------------------------------------------------------------------------
+  static void Report(std::string const &description, double value, std::string const &units);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the performance counter's current time
+  //---------------------------------------------------------------------------
+  static INT64 GetTime();
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the milliseconds since a performance counter time
+  //---------------------------------------------------------------------------
+  static double GetMillisecondsSince(INT64 start_time);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns a level of 128 pixel tiles with random tunnels and
+  //               a few exits, walled in by middleground.
+  //---------------------------------------------------------------------------
+  static Level_Component::Level_Metadata GenerateLevel(int columns, int rows, unsigned int seed);
+
+  //---------------------------------------------------------------------------
+  // Description : Places and classifies the level's tiles with
+  //               Level_Cell_Grid, as the level tile controllers do. If
+  //               out_tunnel_tiles is not 0 the tiles that are not
+  //               middleground are added to it as well.
+  //---------------------------------------------------------------------------
+  static void BuildTiles(Level_Component::Level_Metadata const &level_metadata, std::vector<Tile_Bitmap*> *out_tiles, std::vector<Tile_Bitmap*> *out_tunnel_tiles);
+
+  //---------------------------------------------------------------------------
+  // Description : Deletes every tile in the list
+  //---------------------------------------------------------------------------
+  static void DeleteTiles(std::vector<Tile_Bitmap*> *tiles);
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Class variables
+  //---------------------------------------------------------------------------
+  static unsigned int m_check_count;
+  static unsigned int m_failure_count;
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_TEST_HELPER_H_
@@ -0,0 +1,95 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#ifndef TUNNELOUR_TILE_GRID_TEST_H_
+#define TUNNELOUR_TILE_GRID_TEST_H_
+
+#include <vector>
+#include "AABB.h"
+#include "Tile_Bitmap.h"
+#include "Tile_Grid.h"
+
+namespace Tunnelour {
+//-----------------------------------------------------------------------------
+//  Author(s)   : Sean MacDonnell
+//  Description : Tile_Grid_Test checks Tile_Grid's queries against a scan of
+//                every tile and times collision queries on levels of 1
+//                thousand and 1 million tiles, which should cost the same.
+//-----------------------------------------------------------------------------
+class Tile_Grid_Test {
+ public:
+  //---------------------------------------------------------------------------
+  // Description : Runs the checks then the benchmark
+  //---------------------------------------------------------------------------
+  static void Run();
+
+ protected:
+
+ private:
+  //---------------------------------------------------------------------------
+  // Description : Checks queries on tiles of mixed sizes, several spanning
+  //               more than one cell, against a scan of every tile.
+  //---------------------------------------------------------------------------
+  static void TestQueriesMatchScan();
+
+  //---------------------------------------------------------------------------
+  // Description : Checks the grid still matches a scan after tiles are
+  //               removed, re-added and moved, re-added tiles going last.
+  //---------------------------------------------------------------------------
+  static void TestRemoveThenReAdd();
+
+  //---------------------------------------------------------------------------
+  // Description : Times a tick's worth of avatar collision queries on a level
+  //               of columns by rows 128 pixel tiles
+  //---------------------------------------------------------------------------
+  static double BenchmarkLevel(int columns, int rows);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns a new tile, positioned by its top left corner
+  //---------------------------------------------------------------------------
+  static Tile_Bitmap * CreateTile(float left, float top, float size, unsigned int class_mask);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the bounds the grid keeps for a tile
+  //---------------------------------------------------------------------------
+  static AABB GetTileBounds(Tile_Bitmap *tile);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns a random area, some of which only touch a tile
+  //---------------------------------------------------------------------------
+  static AABB GetRandomArea(std::vector<Tile_Bitmap*> const &tiles);
+
+  //---------------------------------------------------------------------------
+  // Description : Checks every query on the areas against a scan of the
+  //               tiles, which are in the order they were added to the grid.
+  //               Returns the number of areas which did not match.
+  //---------------------------------------------------------------------------
+  static unsigned int CountMismatchedQueries(Tile_Grid *grid, std::vector<Tile_Bitmap*> const &tiles, std::vector<AABB> const &areas);
+
+  //---------------------------------------------------------------------------
+  // Description : Returns the tiles touching the area by looking at every
+  //               tile, in order. Tiles must be in a class of class_mask if
+  //               is_class_filtered is set.
+  //---------------------------------------------------------------------------
+  static std::vector<Tile_Bitmap*> ScanTiles(std::vector<Tile_Bitmap*> const &tiles, AABB const &area, unsigned int class_mask, bool is_class_filtered);
+
+  //---------------------------------------------------------------------------
+  // Description : Tile_Grid::FindTouchingBounds by looking at every tile
+  //---------------------------------------------------------------------------
+  static bool ScanTouchingBounds(std::vector<Tile_Bitmap*> const &tiles, AABB const &area, unsigned int class_mask, AABB *out_bounds);
+};
+}  // namespace Tunnelour
+#endif  // TUNNELOUR_TILE_GRID_TEST_H_
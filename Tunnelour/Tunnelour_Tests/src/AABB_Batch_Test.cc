@@ -0,0 +1,215 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "AABB_Batch_Test.h"
+#include <stdlib.h>
+#include <sstream>
+#include "Test_Helper.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+void AABB_Batch_Test::Run() {
+  Test_Helper::StartTests("AABB_Batch");
+  TestMasksMatchScalar();
+  TestRemoveKeepsOrder();
+
+  BenchmarkBatch(30);
+  BenchmarkBatch(1000);
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void AABB_Batch_Test::TestMasksMatchScalar() {
+  srand(33);
+  unsigned int mismatch_count = 0;
+  unsigned int hit_count = 0;
+  for (unsigned int size = 0; size <= 100; size++) {
+    std::vector<AABB> bounds;
+    AABB_Batch batch;
+    for (unsigned int index = 0; index < size; index++) {
+      Fixed_Pixel left = Fixed_Pixel_Helper::FromPixels(static_cast<float>(rand() % 4000) / 4.0f - 500.0f);
+      Fixed_Pixel bottom = Fixed_Pixel_Helper::FromPixels(static_cast<float>(rand() % 4000) / 4.0f - 500.0f);
+      Fixed_Pixel width = (1 + rand() % 512) * Fixed_Pixel_Helper::ONE_PIXEL / 4;
+      Fixed_Pixel height = (1 + rand() % 512) * Fixed_Pixel_Helper::ONE_PIXEL / 4;
+      bounds.push_back(AABB::FromFixedPixels(left, left + width, bottom, bottom + height));
+      batch.Add(bounds.back());
+    }
+
+    for (unsigned int test = 0; test < 50; test++) {
+      AABB box = GetRandomBox(bounds);
+      std::vector<unsigned int> hit_mask;
+      std::vector<unsigned int> scalar_hit_mask;
+      batch.GetTouchingMask(box, &hit_mask);
+      batch.GetTouchingMaskScalar(box, &scalar_hit_mask);
+      if (hit_mask != scalar_hit_mask || !IsMaskMatchingScan(hit_mask, bounds, box)) {
+        mismatch_count++;
+      }
+      for (unsigned int index = 0; index < size; index++) {
+        if (AABB_Batch::IsHit(hit_mask, index)) {
+          hit_count++;
+        }
+      }
+    }
+  }
+
+  Test_Helper::Check(mismatch_count == 0, "GetTouchingMask matches GetTouchingMaskScalar and a scan");
+  Test_Helper::Check(hit_count > 0, "Masks find touching bounds");
+}
+
+//------------------------------------------------------------------------------
+void AABB_Batch_Test::TestRemoveKeepsOrder() {
+  srand(3333);
+  std::vector<AABB> bounds;
+  AABB_Batch batch;
+  for (unsigned int index = 0; index < 70; index++) {
+    float left = static_cast<float>(rand() % 1000);
+    float bottom = static_cast<float>(rand() % 1000);
+    bounds.push_back(AABB(left, left + 64.0f, bottom, bottom + 64.0f));
+    batch.Add(bounds.back());
+  }
+
+  // Remove from the middle, the front and the back so the bounds after
+  // each move down across a group of four and a mask word.
+  unsigned int removes[] = {33, 0, 67, 3, 31};
+  for (unsigned int index = 0; index < 5; index++) {
+    bounds.erase(bounds.begin() + removes[index]);
+    batch.Remove(removes[index]);
+  }
+
+  bool is_matching = (batch.GetSize() == bounds.size());
+  for (unsigned int index = 0; is_matching && index < bounds.size(); index++) {
+    AABB kept = batch.GetAABB(index);
+    is_matching = (kept.left == bounds[index].left && kept.right == bounds[index].right &&
+                   kept.bottom == bounds[index].bottom && kept.top == bounds[index].top);
+  }
+  Test_Helper::Check(is_matching, "Remove keeps the order of the bounds after it");
+
+  unsigned int mismatch_count = 0;
+  for (unsigned int test = 0; test < 200; test++) {
+    AABB box = GetRandomBox(bounds);
+    std::vector<unsigned int> hit_mask;
+    batch.GetTouchingMask(box, &hit_mask);
+    if (!IsMaskMatchingScan(hit_mask, bounds, box)) {
+      mismatch_count++;
+    }
+  }
+  Test_Helper::Check(mismatch_count == 0, "Masks match a scan after removing bounds");
+
+  batch.Clear();
+  std::vector<unsigned int> hit_mask;
+  batch.GetTouchingMask(bounds[0], &hit_mask);
+  Test_Helper::Check(batch.GetSize() == 0 && hit_mask.empty(), "Clear removes every bounds");
+}
+
+//------------------------------------------------------------------------------
+void AABB_Batch_Test::BenchmarkBatch(unsigned int size) {
+  srand(333);
+  std::vector<AABB> bounds;
+  AABB_Batch batch;
+  for (unsigned int index = 0; index < size; index++) {
+    float left = static_cast<float>(rand() % 4000);
+    float bottom = static_cast<float>(rand() % 4000);
+    bounds.push_back(AABB(left, left + 128.0f, bottom, bottom + 128.0f));
+    batch.Add(bounds.back());
+  }
+
+  const unsigned int box_count = 1000;
+  std::vector<AABB> boxes;
+  for (unsigned int index = 0; index < box_count; index++) {
+    boxes.push_back(GetRandomBox(bounds));
+  }
+
+  // Enough repeats that each timing is a few milliseconds or more
+  unsigned int repeat_count = 200000 / size + 1;
+  std::vector<unsigned int> hit_mask;
+  unsigned int hit_count = 0;
+
+  INT64 start_time = Test_Helper::GetTime();
+  for (unsigned int repeat = 0; repeat < repeat_count; repeat++) {
+    for (unsigned int index = 0; index < box_count; index++) {
+      batch.GetTouchingMask(boxes[index], &hit_mask);
+      hit_count += hit_mask[0] & 1;
+    }
+  }
+  double vector_ns = Test_Helper::GetMillisecondsSince(start_time) * 1000000.0 / (repeat_count * box_count);
+
+  start_time = Test_Helper::GetTime();
+  for (unsigned int repeat = 0; repeat < repeat_count; repeat++) {
+    for (unsigned int index = 0; index < box_count; index++) {
+      batch.GetTouchingMaskScalar(boxes[index], &hit_mask);
+      hit_count += hit_mask[0] & 1;
+    }
+  }
+  double scalar_ns = Test_Helper::GetMillisecondsSince(start_time) * 1000000.0 / (repeat_count * box_count);
+
+  std::stringstream description;
+  description << size << " bounds, GetTouchingMask";
+  Test_Helper::Report(description.str(), vector_ns, "ns");
+  description.str("");
+  description << size << " bounds, GetTouchingMaskScalar";
+  Test_Helper::Report(description.str(), scalar_ns, "ns");
+  description.str("");
+  description << size << " bounds, scalar cost over GetTouchingMask";
+  Test_Helper::Report(description.str(), scalar_ns / vector_ns, "x");
+  Test_Helper::Check(hit_count > 0, "Benchmark masks find bounds");
+}
+
+//------------------------------------------------------------------------------
+AABB AABB_Batch_Test::GetRandomBox(std::vector<AABB> const &bounds) {
+  Fixed_Pixel width = (1 + rand() % 800) * Fixed_Pixel_Helper::ONE_PIXEL / 4;
+  Fixed_Pixel height = (1 + rand() % 800) * Fixed_Pixel_Helper::ONE_PIXEL / 4;
+  if (!bounds.empty() && rand() % 4 == 0) {
+    // Only touching one edge or corner of one of the bounds
+    AABB const &edge = bounds[static_cast<unsigned int>(rand()) % bounds.size()];
+    switch (rand() % 3) {
+      case 0:
+        return AABB::FromFixedPixels(edge.right, edge.right + width, edge.bottom - height, edge.bottom);
+      case 1:
+        return AABB::FromFixedPixels(edge.left - width, edge.left, edge.top, edge.top + height);
+      default:
+        return AABB::FromFixedPixels(edge.left, edge.right, edge.top, edge.top + height);
+    }
+  }
+  Fixed_Pixel left = Fixed_Pixel_Helper::FromPixels(static_cast<float>(rand() % 20000) / 4.0f - 600.0f);
+  Fixed_Pixel bottom = Fixed_Pixel_Helper::FromPixels(static_cast<float>(rand() % 20000) / 4.0f - 600.0f);
+  return AABB::FromFixedPixels(left, left + width, bottom, bottom + height);
+}
+
+//------------------------------------------------------------------------------
+bool AABB_Batch_Test::IsMaskMatchingScan(std::vector<unsigned int> const &hit_mask, std::vector<AABB> const &bounds, AABB const &box) {
+  if (hit_mask.size() != (bounds.size() + 31) / 32) {
+    return false;
+  }
+  for (unsigned int index = 0; index < bounds.size(); index++) {
+    if (AABB_Batch::IsHit(hit_mask, index) != bounds[index].IsTouching(box)) {
+      return false;
+    }
+  }
+  // The bits past the last bounds must be clear
+  if (bounds.size() % 32 != 0 && (hit_mask.back() >> (bounds.size() % 32)) != 0) {
+    return false;
+  }
+  return true;
+}
+
+}  // namespace Tunnelour
@@ -0,0 +1,222 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+#include "Avatar_Crowd_Test.h"
+#include <stdlib.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "Test_Helper.h"
+#include "Tileset_Helper.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+void Avatar_Crowd_Test::Run() {
+  Test_Helper::StartTests("Avatar_Crowd");
+
+  Animation_Library animation_library;
+  LoadAnimations(&animation_library);
+  World_Settings_Component world_settings;
+  world_settings.Init();
+
+  std::vector<Tile_Bitmap*> level_tiles;
+  std::vector<Tile_Bitmap*> tunnel_tiles;
+  Test_Helper::BuildTiles(Test_Helper::GenerateLevel(200, 200, 47), &level_tiles, &tunnel_tiles);
+  Tile_Grid tiles;
+  tiles.Add(level_tiles);
+
+  TestThreadedUpdateMatchesOneRange(&animation_library, &tiles, tunnel_tiles, &world_settings);
+
+  BenchmarkCrowd(1000, &animation_library, &tiles, tunnel_tiles, &world_settings);
+  BenchmarkCrowd(100000, &animation_library, &tiles, tunnel_tiles, &world_settings);
+
+  tiles.Clear();
+  Test_Helper::DeleteTiles(&level_tiles);
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void Avatar_Crowd_Test::TestThreadedUpdateMatchesOneRange(Animation_Library *animation_library,
+                                                          Tile_Grid *tiles,
+                                                          std::vector<Tile_Bitmap*> const &tunnel_tiles,
+                                                          World_Settings_Component *world_settings) {
+  Avatar_Crowd crowd;
+  crowd.Init(animation_library, tiles, world_settings);
+  crowd.SetAvatarsPerThread(64);
+  crowd.SetMaxThreadCount(4);
+  AddAvatars(&crowd, 4000, tunnel_tiles, 4747);
+
+  // The ranges are also stepped on threads started for each tick, to be
+  // sure they match however the threads are run
+  Avatar_Crowd range_crowd;
+  range_crowd.Init(animation_library, tiles, world_settings);
+  AddAvatars(&range_crowd, 4000, tunnel_tiles, 4747);
+
+  Avatar_Crowd expected_crowd;
+  expected_crowd.Init(animation_library, tiles, world_settings);
+  AddAvatars(&expected_crowd, 4000, tunnel_tiles, 4747);
+
+  std::vector<Fixed_Point> start_positions;
+  for (unsigned int index = 0; index < expected_crowd.GetSize(); index++) {
+    start_positions.push_back(expected_crowd.GetFixedPosition(index));
+  }
+
+  unsigned int mismatch_count = 0;
+  unsigned int range_mismatch_count = 0;
+  unsigned int most_threads = 0;
+  for (int tick = 0; tick < 300; tick++) {
+    crowd.Update();
+    UpdateOnThreads(&range_crowd, 4);
+    expected_crowd.Update(0, expected_crowd.GetSize());
+    mismatch_count += CountMismatchedAvatars(&crowd, &expected_crowd);
+    range_mismatch_count += CountMismatchedAvatars(&range_crowd, &expected_crowd);
+    if (crowd.GetLastThreadCount() > most_threads) {
+      most_threads = crowd.GetLastThreadCount();
+    }
+  }
+
+  unsigned int moved_count = 0;
+  for (unsigned int index = 0; index < expected_crowd.GetSize(); index++) {
+    if (expected_crowd.GetFixedPosition(index) != start_positions[index]) {
+      moved_count++;
+    }
+  }
+  Test_Helper::Check(moved_count > expected_crowd.GetSize() / 2, "Most of the crowd moves");
+  Test_Helper::Check(range_mismatch_count == 0, "4 ranges stepped at once match Update(0, size) every tick");
+
+  // Stepping the crowd again from where it was added has to start over too
+  crowd.Reset();
+  expected_crowd.Reset();
+  for (int tick = 0; tick < 50; tick++) {
+    crowd.Update();
+    expected_crowd.Update(0, expected_crowd.GetSize());
+    mismatch_count += CountMismatchedAvatars(&crowd, &expected_crowd);
+  }
+
+  Test_Helper::Check(most_threads == 4, "Update uses its 4 threads");
+  std::stringstream description;
+  description << "Update on " << most_threads << " threads matches Update(0, size) every tick";
+  Test_Helper::Check(mismatch_count == 0, description.str());
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd_Test::BenchmarkCrowd(unsigned int avatar_count,
+                                       Animation_Library *animation_library,
+                                       Tile_Grid *tiles,
+                                       std::vector<Tile_Bitmap*> const &tunnel_tiles,
+                                       World_Settings_Component *world_settings) {
+  const int tick_count = 100;
+
+  // No avatars per thread keeps Update on the calling thread
+  Avatar_Crowd crowd;
+  crowd.Init(animation_library, tiles, world_settings);
+  crowd.SetAvatarsPerThread(0);
+  AddAvatars(&crowd, avatar_count, tunnel_tiles, 474);
+  INT64 start_time = Test_Helper::GetTime();
+  for (int tick = 0; tick < tick_count; tick++) {
+    crowd.Update();
+  }
+  double one_thread_ms = Test_Helper::GetMillisecondsSince(start_time);
+
+  Avatar_Crowd threaded_crowd;
+  threaded_crowd.Init(animation_library, tiles, world_settings);
+  AddAvatars(&threaded_crowd, avatar_count, tunnel_tiles, 474);
+  start_time = Test_Helper::GetTime();
+  for (int tick = 0; tick < tick_count; tick++) {
+    threaded_crowd.Update();
+  }
+  double threaded_ms = Test_Helper::GetMillisecondsSince(start_time);
+
+  double stepped_count = static_cast<double>(avatar_count) * tick_count;
+  std::stringstream description;
+  description << avatar_count << " avatars, 1 thread";
+  Test_Helper::Report(description.str(), stepped_count / one_thread_ms, "avatars/ms");
+  description.str("");
+  description << avatar_count << " avatars, " << threaded_crowd.GetLastThreadCount() << " threads";
+  Test_Helper::Report(description.str(), stepped_count / threaded_ms, "avatars/ms");
+  description.str("");
+  description << avatar_count << " avatars, threaded ends where 1 thread does";
+  Test_Helper::Check(CountMismatchedAvatars(&threaded_crowd, &crowd) == 0, description.str());
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd_Test::UpdateOnThreads(Avatar_Crowd *crowd, unsigned int thread_count) {
+  unsigned int size = crowd->GetSize();
+  unsigned int range_size = (size + thread_count - 1) / thread_count;
+  std::vector<std::thread> threads;
+  for (unsigned int first = 0; first < size; first += range_size) {
+    unsigned int last = (first + range_size < size) ? first + range_size : size;
+    threads.push_back(std::thread(static_cast<void (Avatar_Crowd::*)(unsigned int, unsigned int)>(&Avatar_Crowd::Update),
+                                  crowd,
+                                  first,
+                                  last));
+  }
+  for (unsigned int thread = 0; thread < threads.size(); thread++) {
+    threads[thread].join();
+  }
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd_Test::LoadAnimations(Animation_Library *out_animation_library) {
+  std::string tileset_path = "resource/tilesets/";
+
+  Tileset_Helper::Animation_Tileset_Metadata running_metadata;
+  Tileset_Helper::LoadAnimationTilesetMetadataIntoStruct(tileset_path + "Charlie_Running_Animation_Tileset.txt", &running_metadata);
+  out_animation_library->Add(running_metadata);
+
+  Tileset_Helper::Animation_Tileset_Metadata falling_metadata;
+  Tileset_Helper::LoadAnimationTilesetMetadataIntoStruct(tileset_path + "Charlie_Falling_Animation_Tileset.txt", &falling_metadata);
+  out_animation_library->Add(falling_metadata);
+
+  out_animation_library->Build();
+}
+
+//------------------------------------------------------------------------------
+void Avatar_Crowd_Test::AddAvatars(Avatar_Crowd *crowd, unsigned int avatar_count, std::vector<Tile_Bitmap*> const &tunnel_tiles, unsigned int seed) {
+  srand(seed);
+  for (unsigned int index = 0; index < avatar_count; index++) {
+    Tile_Bitmap *tile = tunnel_tiles[rand() % tunnel_tiles.size()];
+    D3DXVECTOR3 position = *(tile->GetPosition());
+    position.z = -2.0f;
+    crowd->Add(position, (rand() % 2 == 0) ? Avatar_Component::LEFT : Avatar_Component::RIGHT);
+  }
+}
+
+//------------------------------------------------------------------------------
+unsigned int Avatar_Crowd_Test::CountMismatchedAvatars(Avatar_Crowd *crowd, Avatar_Crowd *expected_crowd) {
+  if (crowd->GetSize() != expected_crowd->GetSize()) {
+    return crowd->GetSize() + expected_crowd->GetSize();
+  }
+  unsigned int mismatch_count = 0;
+  for (unsigned int index = 0; index < crowd->GetSize(); index++) {
+    if (crowd->GetFixedPosition(index) != expected_crowd->GetFixedPosition(index) ||
+        crowd->GetParentState(index) != expected_crowd->GetParentState(index) ||
+        crowd->GetState(index) != expected_crowd->GetState(index) ||
+        crowd->GetStateIndex(index) != expected_crowd->GetStateIndex(index) ||
+        crowd->GetDirection(index) != expected_crowd->GetDirection(index)) {
+      mismatch_count++;
+    }
+  }
+  return mismatch_count;
+}
+
+}  // namespace Tunnelour
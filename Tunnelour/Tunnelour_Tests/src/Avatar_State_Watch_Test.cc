@@ -0,0 +1,121 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+#include "Avatar_State_Watch_Test.h"
+#include "Test_Helper.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+void Avatar_State_Watch_Test::Run() {
+  Test_Helper::StartTests("Avatar_State_Watch");
+  TestIdleAvatarIsSkipped();
+  TestStateChangeIsSeen();
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void Avatar_State_Watch_Test::TestIdleAvatarIsSkipped() {
+  Avatar_Component avatar;
+  Avatar_State_Watch watch;
+  Avatar_Component::Avatar_State command;
+  command.direction = Avatar_Component::RIGHT;
+  Avatar_Component::Avatar_State state = GetState(0, Avatar_Component::RIGHT);
+
+  // The first frames take the last state and the last rendered state from
+  // nothing to the state, the watch sees a render on the frame after it
+  Test_Helper::Check(PlayFrame(&avatar, &watch, command, state), "The first frame is checked");
+  PlayFrame(&avatar, &watch, command, state);
+  PlayFrame(&avatar, &watch, command, state);
+
+  unsigned int state_version = avatar.GetStateVersion();
+  unsigned int command_version = avatar.GetCommandVersion();
+  unsigned int checked_count = 0;
+  for (int frame = 0; frame < 100; frame++) {
+    if (PlayFrame(&avatar, &watch, command, state)) {
+      checked_count++;
+    }
+  }
+
+  Test_Helper::Check(checked_count == 0, "Idle frames skip the end condition checks");
+  Test_Helper::Check(avatar.GetStateVersion() == state_version, "Idle frames keep the state version");
+  Test_Helper::Check(avatar.GetCommandVersion() == command_version, "Setting the same command keeps the command version");
+}
+
+//------------------------------------------------------------------------------
+void Avatar_State_Watch_Test::TestStateChangeIsSeen() {
+  Avatar_Component avatar;
+  Avatar_State_Watch watch;
+  Avatar_Component::Avatar_State command;
+  command.direction = Avatar_Component::RIGHT;
+  Avatar_Component::Avatar_State state = GetState(0, Avatar_Component::RIGHT);
+  for (int frame = 0; frame < 4; frame++) {
+    PlayFrame(&avatar, &watch, command, state);
+  }
+
+  // A new command alone changes nothing the end conditions read
+  Avatar_Component::Avatar_State new_command;
+  new_command.direction = Avatar_Component::LEFT;
+  unsigned int command_version = avatar.GetCommandVersion();
+  bool is_command_checked = PlayFrame(&avatar, &watch, new_command, state);
+  Test_Helper::Check(!is_command_checked, "A new command alone skips the end condition checks");
+  Test_Helper::Check(avatar.GetCommandVersion() != command_version, "A new command moves the command version");
+
+  // The state changes on the next frame, then the last state and the last
+  // rendered state catch up over the two after
+  Avatar_Component::Avatar_State next_state = GetState(1, Avatar_Component::RIGHT);
+  unsigned int checked_count = 0;
+  for (int frame = 0; frame < 10; frame++) {
+    if (PlayFrame(&avatar, &watch, new_command, next_state)) {
+      checked_count++;
+    }
+  }
+  Test_Helper::Check(checked_count == 3, "A new state is checked on the three frames it changes on");
+
+  watch.Reset();
+  Test_Helper::Check(watch.HasChanged(&avatar), "A reset watch checks again");
+}
+
+//------------------------------------------------------------------------------
+bool Avatar_State_Watch_Test::PlayFrame(Avatar_Component *avatar,
+                                        Avatar_State_Watch *watch,
+                                        Avatar_Component::Avatar_State const &command,
+                                        Avatar_Component::Avatar_State const &state) {
+  // Input, then the state controllers, then the level's end conditions and
+  // last the view, as a frame runs
+  avatar->SetCommand(command);
+  avatar->SetState(state);
+  bool has_changed = watch->HasChanged(avatar);
+  avatar->SetLastRenderedState();
+  return has_changed;
+}
+
+//------------------------------------------------------------------------------
+Avatar_Component::Avatar_State Avatar_State_Watch_Test::GetState(unsigned int state_index, Avatar_Component::Direction direction) {
+  Avatar_Component::Avatar_State state;
+  state.parent_state = Avatar_Component::CHARLIE_RUNNING;
+  state.state = Avatar_Component::RUNNING;
+  state.state_index = state_index;
+  state.direction = direction;
+  return state;
+}
+
+}  // namespace Tunnelour
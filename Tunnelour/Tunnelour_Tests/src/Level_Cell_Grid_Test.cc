@@ -0,0 +1,320 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Level_Cell_Grid_Test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <iterator>
+#include <sstream>
+#include "AABB.h"
+#include "Exceptions.h"
+#include "String_Helper.h"
+#include "Test_Helper.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+void Level_Cell_Grid_Test::Run() {
+  Test_Helper::StartTests("Level_Cell_Grid");
+  TestShippedLevelMatchesOldBuilder();
+  TestGeneratedLevelsMatchOldBuilder();
+
+  BenchmarkBuilders(1000, 1000);
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void Level_Cell_Grid_Test::TestShippedLevelMatchesOldBuilder() {
+  Level_Component::Level_Metadata level_metadata;
+  LoadLevelCSV("resource/levels/Demo.csv", &level_metadata);
+  Test_Helper::Check(IsAll128Tiles(level_metadata), "Demo.csv only has 128 pixel tiles");
+
+  std::vector<Tile_Bitmap*> tiles;
+  std::vector<Tile_Bitmap*> expected_tiles;
+  Test_Helper::BuildTiles(level_metadata, &tiles, 0);
+  BuildWithOldBuilder(level_metadata, &expected_tiles);
+
+  Test_Helper::Check(!tiles.empty() && tiles.size() == expected_tiles.size(), "Demo.csv has the same tiles as the old builder");
+  Test_Helper::Check(CountMismatchedTiles(tiles, expected_tiles) == 0, "Demo.csv tiles have the old builder's positions and classes");
+
+  Test_Helper::DeleteTiles(&tiles);
+  Test_Helper::DeleteTiles(&expected_tiles);
+}
+
+//------------------------------------------------------------------------------
+void Level_Cell_Grid_Test::TestGeneratedLevelsMatchOldBuilder() {
+  unsigned int mismatch_count = 0;
+  unsigned int tile_count = 0;
+  for (unsigned int seed = 1; seed <= 20; seed++) {
+    Level_Component::Level_Metadata level_metadata = Test_Helper::GenerateLevel(20 + seed * 3, 10 + seed * 2, seed);
+    std::vector<Tile_Bitmap*> tiles;
+    std::vector<Tile_Bitmap*> expected_tiles;
+    Test_Helper::BuildTiles(level_metadata, &tiles, 0);
+    BuildWithOldBuilder(level_metadata, &expected_tiles);
+    if (tiles.size() != expected_tiles.size()) {
+      mismatch_count++;
+    } else {
+      mismatch_count += CountMismatchedTiles(tiles, expected_tiles);
+    }
+    tile_count += static_cast<unsigned int>(tiles.size());
+    Test_Helper::DeleteTiles(&tiles);
+    Test_Helper::DeleteTiles(&expected_tiles);
+  }
+
+  std::stringstream description;
+  description << "Generated levels' " << tile_count << " tiles match the old builder";
+  Test_Helper::Check(mismatch_count == 0, description.str());
+}
+
+//------------------------------------------------------------------------------
+void Level_Cell_Grid_Test::BenchmarkBuilders(int columns, int rows) {
+  Level_Component::Level_Metadata level_metadata = Test_Helper::GenerateLevel(columns, rows, 36);
+  std::vector<Tile_Bitmap*> tiles;
+
+  INT64 start_time = Test_Helper::GetTime();
+  Test_Helper::BuildTiles(level_metadata, &tiles, 0);
+  double cell_grid_ms = Test_Helper::GetMillisecondsSince(start_time);
+  Test_Helper::DeleteTiles(&tiles);
+
+  start_time = Test_Helper::GetTime();
+  BuildWithOldBuilder(level_metadata, &tiles);
+  double old_builder_ms = Test_Helper::GetMillisecondsSince(start_time);
+  Test_Helper::DeleteTiles(&tiles);
+
+  std::stringstream description;
+  description << columns << "x" << rows << " level, Level_Cell_Grid build";
+  Test_Helper::Report(description.str(), cell_grid_ms, "ms");
+  description.str("");
+  description << columns << "x" << rows << " level, old builder";
+  Test_Helper::Report(description.str(), old_builder_ms, "ms");
+  description.str("");
+  description << columns << "x" << rows << " level, old builder over Level_Cell_Grid";
+  Test_Helper::Report(description.str(), old_builder_ms / cell_grid_ms, "x");
+}
+
+//------------------------------------------------------------------------------
+void Level_Cell_Grid_Test::LoadLevelCSV(std::string level_csv_path, Level_Component::Level_Metadata *out_level_metadata) {
+  FILE * pFile;
+  if (fopen_s(&pFile, level_csv_path.c_str(), "r") != 0) {
+    std::string error = "Open Level CSV Failed! " + level_csv_path;
+    throw Tunnelour::Exceptions::init_error(error);
+  }
+
+  char line[10000];
+  while (fgets(line, 10000, pFile) != NULL) {
+    std::vector<Level_Component::Tile_Metadata> line_metadata;
+    std::vector<std::string> split_line = String_Helper::Split(line, ',');
+    std::vector<std::string>::iterator line_block;
+    for (line_block = split_line.begin(); line_block != split_line.end(); line_block++) {
+      Level_Component::Tile_Metadata tile_metadata;
+      std::vector<std::string> quote_stripper = String_Helper::Split((*line_block), '\'');
+      std::vector<std::string>::iterator line_tile;
+      for (line_tile = quote_stripper.begin(); line_tile != quote_stripper.end(); line_tile++) {
+        std::vector<std::string> split_tile = String_Helper::Split(line_tile[0], ';');
+        std::vector<std::string>::iterator line_tile_data;
+        for (line_tile_data = split_tile.begin(); line_tile_data != split_tile.end(); line_tile_data++) {
+          std::vector<std::string> split_tile_data = String_Helper::Split((*line_tile_data), ' ');
+          if (split_tile_data.begin()->compare("Size") == 0) {
+            tile_metadata.size = static_cast<float>(atof(split_tile_data[1].c_str()));
+          } else if (split_tile_data.begin()->compare("Type") == 0) {
+            tile_metadata.type = split_tile_data[1];
+          }
+        }
+        line_metadata.push_back(tile_metadata);
+      }
+    }
+    out_level_metadata->level.push_back(line_metadata);
+  }
+
+  fclose(pFile);
+}
+
+//------------------------------------------------------------------------------
+void Level_Cell_Grid_Test::BuildWithOldBuilder(Level_Component::Level_Metadata const &level_metadata, std::vector<Tile_Bitmap*> *out_tiles) {
+  std::vector<std::vector<Tile_Bitmap*>> tile_lines;
+
+  std::vector<std::vector<Level_Component::Tile_Metadata>>::const_iterator line;
+  float offset_y = 0;
+  for (line = level_metadata.level.begin(); line != level_metadata.level.end(); line++) {
+    std::vector<Level_Component::Tile_Metadata>::const_iterator tile;
+    std::vector<Tile_Bitmap*> tile_line;
+    float offset_x = 0.0f;
+    for (tile = (*line).begin(); tile != (*line).end(); tile++) {
+      bool is_middleground = ((*tile).type.compare("Middleground") == 0);
+      Tile_Bitmap* new_tile = new Tile_Bitmap();
+      new_tile->SetSize((*tile).size, (*tile).size);
+      if (tile == (*line).begin()) {
+        new_tile->SetIsLeftEdge(true);
+      }
+      if (tile == (*line).end() - 1) {
+        new_tile->SetIsRightEdge(true);
+      }
+      if (line == level_metadata.level.begin()) {
+        new_tile->SetIsTopEdge(true);
+      }
+      if (line == level_metadata.level.end() - 1) {
+        new_tile->SetIsBottomEdge(true);
+      }
+
+      float position_x = ((*tile).size / 2) + offset_x;
+      float position_y = -(((*tile).size / 2) + offset_y);
+      offset_x += (*tile).size;
+      new_tile->SetPosition(D3DXVECTOR3(position_x, position_y, is_middleground ? -1.0f : 0.0f));
+
+      if (is_middleground) {
+        if (!tile_line.empty()) {
+          if (tile_line.back()->GetPosition()->z == 0) {
+            new_tile->SetIsRightWall(true);
+            std::vector<Tile_Bitmap*>::iterator above_tile;
+            for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
+              if (IsTileAbove(*above_tile, new_tile) && (*above_tile)->GetPosition()->z != 0) {
+                if (!(*above_tile)->IsRightWall()) {
+                  (*above_tile)->SetIsTopRightWallEnd(true);
+                  if ((*std::prev(above_tile))->IsRoof()) {
+                    (*above_tile)->SetIsRightRoofEnd(true);
+                  }
+                  if (std::next(above_tile) != tile_lines.back().end()) {
+                    if ((*std::next(above_tile))->IsRoof()) {
+                      (*above_tile)->SetIsRightRoofEnd(true);
+                    }
+                  }
+                }
+              }
+            }
+          }
+          if (!tile_lines.empty()) {
+            std::vector<Tile_Bitmap*>::iterator above_tile;
+            for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
+              if (IsTileAbove(*above_tile, new_tile) && (*above_tile)->GetPosition()->z == 0) {
+                new_tile->SetIsFloor(true);
+                if (!tile_line.back()->IsFloor()) {
+                  tile_line.back()->SetIsLeftFloorEnd(true);
+                  std::vector<Tile_Bitmap*>::iterator left_above_tile;
+                  for (left_above_tile = tile_lines.back().begin(); left_above_tile != tile_lines.back().end(); left_above_tile++) {
+                    if (IsTileAbove(*left_above_tile, tile_line.back()) && (*left_above_tile)->GetPosition()->z != 0) {
+                      if ((*left_above_tile)->IsLeftWall()) {
+                        tile_line.back()->SetIsBotLeftWallEnd(true);
+                      }
+                    }
+                  }
+                }
+              }
+            }
+            if (!new_tile->IsFloor() && tile_line.back()->IsFloor()) {
+              new_tile->SetIsRightFloorEnd(true);
+              for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
+                if (IsTileAbove(*above_tile, new_tile) && (*above_tile)->GetPosition()->z != 0) {
+                  if ((*above_tile)->IsRightWall()) {
+                    new_tile->SetIsBotRightWallEnd(true);
+                  }
+                }
+              }
+            }
+          }
+        }
+      } else {
+        if (tile_line.back()->GetPosition()->z != 0) {
+          tile_line.back()->SetIsLeftWall(true);
+          if (!tile_lines.empty()) {
+            std::vector<Tile_Bitmap*>::iterator above_tile;
+            for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
+              if (IsTileAbove(*above_tile, tile_line.back()) && (*above_tile)->GetPosition()->z != 0) {
+                if (!(*above_tile)->IsLeftWall()) {
+                  (*above_tile)->SetIsTopLeftWallEnd(true);
+                }
+              }
+            }
+          }
+        }
+        if (!tile_lines.empty()) {
+          std::vector<Tile_Bitmap*>::iterator above_tile;
+          for (above_tile = tile_lines.back().begin(); above_tile != tile_lines.back().end(); above_tile++) {
+            if (IsTileAbove(*above_tile, new_tile) && (*above_tile)->GetPosition()->z != 0) {
+              (*above_tile)->SetIsRoof(true);
+              if ((*std::prev(above_tile))->GetPosition()->z != 0 && !(*std::prev(above_tile))->IsRoof()) {
+                (*std::prev(above_tile))->SetIsLeftRoofEnd(true);
+              }
+              if (std::next(above_tile) != tile_lines.back().end()) {
+                if ((*std::next(above_tile))->GetPosition()->z != 0 && !(*std::next(above_tile))->IsRoof()) {
+                  (*std::next(above_tile))->SetIsRightRoofEnd(true);
+                }
+              }
+            }
+          }
+        }
+        if ((*tile).type.compare("Exit") == 0) {
+          if (tile_line.back()->IsLeftWall()) {
+            new_tile->SetIsLeftExit(true);
+          } else {
+            new_tile->SetIsRightExit(true);
+          }
+        }
+      }
+
+      tile_line.push_back(new_tile);
+      out_tiles->push_back(new_tile);
+    }
+    tile_lines.push_back(tile_line);
+    offset_y += 128;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool Level_Cell_Grid_Test::IsTileAbove(Tile_Bitmap *above_tile, Tile_Bitmap *tile) {
+  D3DXVECTOR3 above_top_left = above_tile->GetTopLeftPostion();
+  D3DXVECTOR3 above_bottom_right = above_tile->GetBottomRightPostion();
+  D3DXVECTOR3 top_left = tile->GetTopLeftPostion();
+  D3DXVECTOR3 bottom_right = tile->GetBottomRightPostion();
+  AABB above_bounds(above_top_left.x, above_bottom_right.x, above_bottom_right.y, above_top_left.y);
+  AABB bounds(top_left.x, bottom_right.x, bottom_right.y, top_left.y);
+  return above_bounds.IsXColliding(bounds) && above_bounds.IsYAdjacent(bounds);
+}
+
+//------------------------------------------------------------------------------
+unsigned int Level_Cell_Grid_Test::CountMismatchedTiles(std::vector<Tile_Bitmap*> const &tiles, std::vector<Tile_Bitmap*> const &expected_tiles) {
+  unsigned int mismatch_count = 0;
+  for (unsigned int index = 0; index < tiles.size() && index < expected_tiles.size(); index++) {
+    D3DXVECTOR3 position = *(tiles[index]->GetPosition());
+    D3DXVECTOR3 expected_position = *(expected_tiles[index]->GetPosition());
+    if (position != expected_position ||
+        tiles[index]->GetClassMask() != expected_tiles[index]->GetClassMask()) {
+      mismatch_count++;
+    }
+  }
+  return mismatch_count;
+}
+
+//------------------------------------------------------------------------------
+bool Level_Cell_Grid_Test::IsAll128Tiles(Level_Component::Level_Metadata const &level_metadata) {
+  std::vector<std::vector<Level_Component::Tile_Metadata>>::const_iterator line;
+  for (line = level_metadata.level.begin(); line != level_metadata.level.end(); line++) {
+    std::vector<Level_Component::Tile_Metadata>::const_iterator tile;
+    for (tile = line->begin(); tile != line->end(); tile++) {
+      if (tile->size != 128) {
+        return false;
+      }
+    }
+  }
+  return !level_metadata.level.empty();
+}
+
+}  // namespace Tunnelour
@@ -0,0 +1,227 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "Snapshot_Buffer_Test.h"
+#include <limits.h>
+#include <stdlib.h>
+#include <sstream>
+#include "Test_Helper.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+void Snapshot_Buffer_Test::Run() {
+  Test_Helper::StartTests("Snapshot_Buffer");
+  TestDeltasRoundTrip();
+  TestGetAcrossKeyframes();
+  TestRewindAfterWrap();
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void Snapshot_Buffer_Test::TestDeltasRoundTrip() {
+  srand(48);
+  Snapshot_Buffer buffer(8, 64 * 1024, 16);
+  std::vector<std::vector<int>> pushed;
+
+  // The changes which sit on the edges of the zigzag and varint sizes
+  int edge_values[] = {0, 1, -1, 63, -64, 64, -65, 8191, -8192, 8192, -8193,
+                       INT_MAX, INT_MIN, INT_MAX - 1, INT_MIN + 1};
+  unsigned int edge_count = sizeof(edge_values) / sizeof(edge_values[0]);
+  std::vector<int> fields(8, 0);
+  for (unsigned int first = 0; first < edge_count; first++) {
+    for (unsigned int second = 0; second < edge_count; second++) {
+      fields[0] = edge_values[first];
+      fields[1] = edge_values[second];
+      // From the largest int to the smallest and back is a change of one
+      // once it wraps
+      fields[2] = (fields[2] == INT_MAX) ? INT_MIN : INT_MAX;
+      Push(&buffer, fields, &pushed);
+    }
+  }
+  for (int snapshot = 0; snapshot < 500; snapshot++) {
+    Push(&buffer, ChangeFields(pushed.back()), &pushed);
+  }
+
+  std::stringstream description;
+  description << buffer.GetSize() << " snapshots of edge and random changes round trip";
+  Test_Helper::Check(buffer.GetSize() == pushed.size(), "Nothing is dropped while there is room");
+  Test_Helper::Check(CountMismatchedSnapshots(&buffer, pushed) == 0, description.str());
+
+  // The next two snapshots are not keyframes. One field moving by a step
+  // either way is the mask and its change, a byte each, and nothing moving
+  // is only the mask.
+  buffer.Clear();
+  pushed.clear();
+  fields.assign(8, 0);
+  Push(&buffer, fields, &pushed);
+  unsigned int bytes_used = buffer.GetBytesUsed();
+  fields[5] = -1;
+  Push(&buffer, fields, &pushed);
+  Test_Helper::Check(buffer.GetBytesUsed() - bytes_used == 2, "A step of one field takes two bytes");
+  bytes_used = buffer.GetBytesUsed();
+  Push(&buffer, fields, &pushed);
+  Test_Helper::Check(buffer.GetBytesUsed() - bytes_used == 1, "An unchanged snapshot takes one byte");
+  Test_Helper::Check(CountMismatchedSnapshots(&buffer, pushed) == 0, "Small changes round trip");
+}
+
+//------------------------------------------------------------------------------
+void Snapshot_Buffer_Test::TestGetAcrossKeyframes() {
+  srand(4848);
+  const unsigned int keyframe_interval = 4;
+  Snapshot_Buffer buffer(3, 4 * 1024, keyframe_interval);
+  std::vector<std::vector<int>> pushed;
+
+  // Checked after every push so each snapshot is got from its keyframe
+  // while it is the newest and with later keyframes after it
+  unsigned int mismatch_count = 0;
+  std::vector<int> fields(3, 0);
+  fields[0] = 100;
+  for (int snapshot = 0; snapshot < 6 * keyframe_interval + 1; snapshot++) {
+    fields = ChangeFields(fields);
+    Push(&buffer, fields, &pushed);
+    mismatch_count += CountMismatchedSnapshots(&buffer, pushed);
+  }
+  Test_Helper::Check(mismatch_count == 0, "Snapshots on either side of each keyframe are got back");
+
+  // Keyframes are stored from all zeros rather than the snapshot before,
+  // so a field going back to zero on one has to come back as zero
+  buffer.Clear();
+  pushed.clear();
+  fields.assign(3, 7);
+  for (unsigned int snapshot = 0; snapshot < keyframe_interval; snapshot++) {
+    Push(&buffer, fields, &pushed);
+  }
+  fields.assign(3, 0);
+  Push(&buffer, fields, &pushed);
+  Push(&buffer, fields, &pushed);
+  Test_Helper::Check(CountMismatchedSnapshots(&buffer, pushed) == 0, "A keyframe of zeros after other values is got back");
+
+  int out_fields[3];
+  Test_Helper::Check(!buffer.Get(buffer.GetSize(), out_fields), "Get past the oldest snapshot fails");
+}
+
+//------------------------------------------------------------------------------
+void Snapshot_Buffer_Test::TestRewindAfterWrap() {
+  srand(484848);
+  // Room for a little over two keyframes of the largest snapshots, so the
+  // bytes wrap many times and keyframes are dropped
+  const unsigned int field_count = 4;
+  const unsigned int keyframe_interval = 4;
+  const unsigned int byte_capacity = 2 * keyframe_interval * (5 + 5 * field_count) + 7;
+  Snapshot_Buffer buffer(field_count, byte_capacity, keyframe_interval);
+  std::vector<std::vector<int>> pushed;
+
+  std::vector<int> fields(field_count, 0);
+  unsigned int mismatch_count = 0;
+  for (int snapshot = 0; snapshot < 400; snapshot++) {
+    fields = ChangeFields(fields);
+    Push(&buffer, fields, &pushed);
+    mismatch_count += CountMismatchedSnapshots(&buffer, pushed);
+  }
+  Test_Helper::Check(buffer.GetSize() < pushed.size(), "The oldest snapshots are dropped once the bytes are full");
+  Test_Helper::Check(buffer.GetBytesUsed() <= byte_capacity, "The snapshots fit in the bytes");
+  Test_Helper::Check(mismatch_count == 0, "Snapshots are got back while the bytes wrap");
+
+  // Rewind to each snapshot still held in turn, then push past it again
+  unsigned int rewind_mismatch_count = 0;
+  unsigned int rewind_count = 0;
+  for (int round = 0; round < 50; round++) {
+    unsigned int ticks_ago = static_cast<unsigned int>(rand()) % buffer.GetSize();
+    unsigned int size = buffer.GetSize();
+    int out_fields[field_count];
+    if (!buffer.Rewind(ticks_ago, out_fields)) {
+      rewind_mismatch_count++;
+      continue;
+    }
+    rewind_count++;
+    pushed.resize(pushed.size() - ticks_ago);
+    if (std::vector<int>(out_fields, out_fields + field_count) != pushed.back() ||
+        buffer.GetSize() != size - ticks_ago) {
+      rewind_mismatch_count++;
+    }
+    rewind_mismatch_count += CountMismatchedSnapshots(&buffer, pushed);
+
+    int pushes = 1 + rand() % (3 * keyframe_interval);
+    for (int snapshot = 0; snapshot < pushes; snapshot++) {
+      fields = ChangeFields(pushed.back());
+      Push(&buffer, fields, &pushed);
+      rewind_mismatch_count += CountMismatchedSnapshots(&buffer, pushed);
+    }
+  }
+
+  std::stringstream description;
+  description << rewind_count << " rewinds of wrapped bytes keep the snapshots before them and those pushed after";
+  Test_Helper::Check(rewind_mismatch_count == 0, description.str());
+  Test_Helper::Check(buffer.GetBytesUsed() <= byte_capacity, "The snapshots still fit in the bytes after rewinding");
+}
+
+//------------------------------------------------------------------------------
+void Snapshot_Buffer_Test::Push(Snapshot_Buffer *buffer, std::vector<int> const &fields, std::vector<std::vector<int>> *out_pushed) {
+  buffer->Push(&fields[0]);
+  out_pushed->push_back(fields);
+}
+
+//------------------------------------------------------------------------------
+unsigned int Snapshot_Buffer_Test::CountMismatchedSnapshots(Snapshot_Buffer *buffer, std::vector<std::vector<int>> const &pushed) {
+  if (buffer->GetSize() > pushed.size()) {
+    return buffer->GetSize();
+  }
+  unsigned int mismatch_count = 0;
+  std::vector<int> fields(pushed.back().size(), 0);
+  for (unsigned int ticks_ago = 0; ticks_ago < buffer->GetSize(); ticks_ago++) {
+    if (!buffer->Get(ticks_ago, &fields[0]) ||
+        fields != pushed[pushed.size() - 1 - ticks_ago]) {
+      mismatch_count++;
+    }
+  }
+  return mismatch_count;
+}
+
+//------------------------------------------------------------------------------
+std::vector<int> Snapshot_Buffer_Test::ChangeFields(std::vector<int> const &fields) {
+  std::vector<int> changed_fields = fields;
+  for (unsigned int field = 0; field < changed_fields.size(); field++) {
+    switch (rand() % 4) {
+      case 0:
+        // Unchanged
+        break;
+      case 1:
+        changed_fields[field] = AddWrapping(changed_fields[field], (rand() % 2 == 0) ? 1 : -1);
+        break;
+      case 2:
+        changed_fields[field] = AddWrapping(changed_fields[field], (rand() % 2001) - 1000);
+        break;
+      default:
+        changed_fields[field] = static_cast<int>((static_cast<unsigned int>(rand()) << 16) ^ static_cast<unsigned int>(rand()));
+        break;
+    }
+  }
+  return changed_fields;
+}
+
+//------------------------------------------------------------------------------
+int Snapshot_Buffer_Test::AddWrapping(int value, int change) {
+  return static_cast<int>(static_cast<unsigned int>(value) + static_cast<unsigned int>(change));
+}
+
+}  // namespace Tunnelour
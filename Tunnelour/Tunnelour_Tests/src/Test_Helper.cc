@@ -0,0 +1,128 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include "Test_Helper.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "Level_Cell_Grid.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+void Test_Helper::StartTests(std::string const &name) {
+  printf("\n%s\n", name.c_str());
+}
+
+//------------------------------------------------------------------------------
+void Test_Helper::Check(bool is_passed, std::string const &description) {
+  m_check_count++;
+  if (!is_passed) {
+    m_failure_count++;
+    printf("  FAILED: %s\n", description.c_str());
+  }
+}
+
+//------------------------------------------------------------------------------
+unsigned int Test_Helper::GetCheckCount() {
+  return m_check_count;
+}
+
+//------------------------------------------------------------------------------
+unsigned int Test_Helper::GetFailureCount() {
+  return m_failure_count;
+}
+
+//------------------------------------------------------------------------------
+void Test_Helper::Report(std::string const &description, double value, std::string const &units) {
+  printf("  %-56s %12.4f %s\n", description.c_str(), value, units.c_str());
+}
+
+//------------------------------------------------------------------------------
+INT64 Test_Helper::GetTime() {
+  INT64 time;
+  QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&time));
+  return time;
+}
+
+//------------------------------------------------------------------------------
+double Test_Helper::GetMillisecondsSince(INT64 start_time) {
+  INT64 frequency;
+  QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&frequency));
+  return static_cast<double>(GetTime() - start_time) * 1000.0 / static_cast<double>(frequency);
+}
+
+//------------------------------------------------------------------------------
+Level_Component::Level_Metadata Test_Helper::GenerateLevel(int columns, int rows, unsigned int seed) {
+  srand(seed);
+  Level_Component::Level_Metadata level_metadata;
+  for (int row = 0; row < rows; row++) {
+    std::vector<Level_Component::Tile_Metadata> line;
+    for (int column = 0; column < columns; column++) {
+      Level_Component::Tile_Metadata tile;
+      tile.size = 128;
+      tile.type = "Middleground";
+      bool is_border = (row == 0 || row == rows - 1 || column == 0 || column == columns - 1);
+      if (!is_border && rand() % 2 == 0) {
+        tile.type = (rand() % 100 == 0) ? "Exit" : "Tunnel";
+      }
+      line.push_back(tile);
+    }
+    level_metadata.level.push_back(line);
+  }
+  return level_metadata;
+}
+
+//------------------------------------------------------------------------------
+void Test_Helper::BuildTiles(Level_Component::Level_Metadata const &level_metadata, std::vector<Tile_Bitmap*> *out_tiles, std::vector<Tile_Bitmap*> *out_tunnel_tiles) {
+  Level_Cell_Grid level_grid;
+  level_grid.Build(level_metadata);
+
+  out_tiles->reserve(level_grid.GetTileCount());
+  for (unsigned int index = 0; index < level_grid.GetTileCount(); index++) {
+    Level_Cell_Grid::Tile_Placement const &placement = level_grid.GetTilePlacement(index);
+    Tile_Bitmap *new_tile = new Tile_Bitmap();
+    new_tile->SetSize(placement.size, placement.size);
+    new_tile->SetPosition(D3DXVECTOR3(placement.position.x, placement.position.y, placement.is_middleground ? -1.0f : 0.0f));
+    new_tile->SetClass(level_grid.GetTileClassMask(index), true);
+    out_tiles->push_back(new_tile);
+    if (out_tunnel_tiles != 0 && !placement.is_middleground) {
+      out_tunnel_tiles->push_back(new_tile);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void Test_Helper::DeleteTiles(std::vector<Tile_Bitmap*> *tiles) {
+  std::vector<Tile_Bitmap*>::iterator tile;
+  for (tile = tiles->begin(); tile != tiles->end(); tile++) {
+    delete (*tile);
+  }
+  tiles->clear();
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+unsigned int Test_Helper::m_check_count = 0;
+unsigned int Test_Helper::m_failure_count = 0;
+
+}  // namespace Tunnelour
@@ -0,0 +1,52 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <exception>
+#include "AABB_Batch_Test.h"
+#include "Avatar_Crowd_Test.h"
+#include "Avatar_State_Watch_Test.h"
+#include "Level_Cell_Grid_Test.h"
+#include "Snapshot_Buffer_Test.h"
+#include "Test_Helper.h"
+#include "Tile_Grid_Test.h"
+
+//-----------------------------------------------------------------------------
+// Description : Runs every test and benchmark, failing if any check fails
+//-----------------------------------------------------------------------------
+int main() {
+  try {
+    Tunnelour::AABB_Batch_Test::Run();
+    Tunnelour::Avatar_Crowd_Test::Run();
+    Tunnelour::Avatar_State_Watch_Test::Run();
+    Tunnelour::Level_Cell_Grid_Test::Run();
+    Tunnelour::Snapshot_Buffer_Test::Run();
+    Tunnelour::Tile_Grid_Test::Run();
+  }
+  catch(const std::exception& e) {
+    printf("Unhandled exception: %s\n", e.what());
+    return EXIT_FAILURE;
+  }
+
+  printf("\n%u checks, %u failed\n",
+         Tunnelour::Test_Helper::GetCheckCount(),
+         Tunnelour::Test_Helper::GetFailureCount());
+  if (Tunnelour::Test_Helper::GetFailureCount() != 0) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,293 @@
+//  Copyright 2014 Sean MacDonnell
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include "Tile_Grid_Test.h"
+#include <stdlib.h>
+#include <algorithm>
+#include <sstream>
+#include "Test_Helper.h"
+
+namespace Tunnelour {
+
+//------------------------------------------------------------------------------
+// public:
+//------------------------------------------------------------------------------
+void Tile_Grid_Test::Run() {
+  Test_Helper::StartTests("Tile_Grid");
+  TestQueriesMatchScan();
+  TestRemoveThenReAdd();
+
+  double small_tick_us = BenchmarkLevel(40, 25);
+  double large_tick_us = BenchmarkLevel(1000, 1000);
+  Test_Helper::Report("Collision cost of 1M tiles over 1k tiles", large_tick_us / small_tick_us, "x");
+}
+
+//------------------------------------------------------------------------------
+// protected:
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// private:
+//------------------------------------------------------------------------------
+void Tile_Grid_Test::TestQueriesMatchScan() {
+  srand(31);
+  float sizes[] = {16.0f, 32.0f, 64.0f, 128.0f, 200.0f, 300.0f};
+  unsigned int classes[] = {0, Tile_Bitmap::FLOOR, Tile_Bitmap::ROOF, Tile_Bitmap::LEFT_WALL,
+                            Tile_Bitmap::RIGHT_WALL | Tile_Bitmap::FLOOR, Tile_Bitmap::LEFT_EXIT};
+
+  std::vector<Tile_Bitmap*> tiles;
+  Tile_Grid grid;
+  for (int index = 0; index < 2000; index++) {
+    // Quarter pixel positions either side of the origin
+    float left = static_cast<float>(rand() % 16000) / 4.0f - 2000.0f;
+    float top = static_cast<float>(rand() % 16000) / 4.0f - 2000.0f;
+    Tile_Bitmap *tile = CreateTile(left, top, sizes[rand() % 6], classes[rand() % 6]);
+    tiles.push_back(tile);
+  }
+  grid.Add(tiles);
+
+  std::vector<AABB> areas;
+  for (int index = 0; index < 2000; index++) {
+    areas.push_back(GetRandomArea(tiles));
+  }
+
+  Test_Helper::Check(grid.GetSize() == tiles.size(), "GetSize counts every tile added");
+  Test_Helper::Check(CountMismatchedQueries(&grid, tiles, areas) == 0, "Queries match a scan of every tile");
+
+  Test_Helper::DeleteTiles(&tiles);
+}
+
+//------------------------------------------------------------------------------
+void Tile_Grid_Test::TestRemoveThenReAdd() {
+  srand(3131);
+  std::vector<Tile_Bitmap*> tiles;
+  std::vector<Tile_Bitmap*> added_tiles;
+  Tile_Grid grid;
+  for (int index = 0; index < 1000; index++) {
+    float left = static_cast<float>(rand() % 8000) / 4.0f - 1000.0f;
+    float top = static_cast<float>(rand() % 8000) / 4.0f - 1000.0f;
+    float size = (index % 5 == 0) ? 260.0f : 64.0f;
+    Tile_Bitmap *tile = CreateTile(left, top, size, (index % 2 == 0) ? Tile_Bitmap::FLOOR : Tile_Bitmap::LEFT_WALL);
+    tiles.push_back(tile);
+    grid.Add(tile);
+  }
+  added_tiles = tiles;
+
+  // Remove a third of the tiles
+  unsigned int version = grid.GetVersion();
+  for (unsigned int index = 0; index < tiles.size(); index += 3) {
+    grid.Remove(tiles[index]);
+    added_tiles.erase(std::find(added_tiles.begin(), added_tiles.end(), tiles[index]));
+  }
+  Test_Helper::Check(grid.GetVersion() != version, "Removing tiles changes the version");
+  Test_Helper::Check(!grid.Contains(tiles[0]) && grid.Contains(tiles[1]), "Contains only finds tiles in the grid");
+
+  version = grid.GetVersion();
+  grid.Remove(tiles[0]);
+  Test_Helper::Check(grid.GetVersion() == version, "Removing a tile not in the grid does nothing");
+
+  // Re-add half of them, they are now the newest tiles
+  for (unsigned int index = 0; index < tiles.size(); index += 6) {
+    grid.Add(tiles[index]);
+    added_tiles.push_back(tiles[index]);
+  }
+
+  // Move some tiles, adding a tile already in the grid moves it to the end
+  for (unsigned int index = 1; index < tiles.size(); index += 7) {
+    if (!grid.Contains(tiles[index])) {
+      continue;
+    }
+    D3DXVECTOR3 position = *(tiles[index]->GetPosition());
+    tiles[index]->SetPosition(position.x + 100.25f, position.y - 37.5f, 0);
+    grid.Add(tiles[index]);
+    added_tiles.erase(std::find(added_tiles.begin(), added_tiles.end(), tiles[index]));
+    added_tiles.push_back(tiles[index]);
+  }
+
+  std::vector<AABB> areas;
+  for (int index = 0; index < 2000; index++) {
+    areas.push_back(GetRandomArea(added_tiles));
+  }
+
+  Test_Helper::Check(grid.GetSize() == added_tiles.size(), "GetSize counts tiles after removing and re-adding");
+  Test_Helper::Check(CountMismatchedQueries(&grid, added_tiles, areas) == 0, "Queries match a scan after removing and re-adding");
+
+  grid.Clear();
+  Test_Helper::Check(grid.IsEmpty() && grid.Query(areas[0]).empty(), "Clear removes every tile");
+
+  Test_Helper::DeleteTiles(&tiles);
+}
+
+//------------------------------------------------------------------------------
+double Tile_Grid_Test::BenchmarkLevel(int columns, int rows) {
+  srand(131);
+  std::vector<Tile_Bitmap*> tiles;
+  tiles.reserve(static_cast<unsigned int>(columns * rows));
+  for (int row = 0; row < rows; row++) {
+    for (int column = 0; column < columns; column++) {
+      unsigned int class_mask = 0;
+      if ((row + column) % 3 == 0) {
+        class_mask = Tile_Bitmap::FLOOR;
+      } else if ((row + column) % 3 == 1) {
+        class_mask = Tile_Bitmap::LEFT_WALL;
+      }
+      tiles.push_back(CreateTile(column * 128.0f, row * -128.0f, 128.0f, class_mask));
+    }
+  }
+
+  INT64 start_time = Test_Helper::GetTime();
+  Tile_Grid grid;
+  grid.Add(tiles);
+  double build_ms = Test_Helper::GetMillisecondsSince(start_time);
+
+  // The avatar runs 8 pixels a tick along a row of the level, starting a new
+  // row at a random place when it reaches the end. Each tick makes the
+  // avatar's queries with its block swept from where it was last tick.
+  const int tick_count = 100000;
+  std::vector<AABB> blocks;
+  float x = 0;
+  float y = 0;
+  for (int tick = 0; tick < tick_count; tick++) {
+    if (tick % 1000 == 0 || x + 40.0f > columns * 128.0f) {
+      x = static_cast<float>((rand() % columns) * 128);
+      y = static_cast<float>((rand() % rows) * -128 - 100);
+    }
+    blocks.push_back(AABB(x, x + 40.0f, y, y + 100.0f));
+    x += 8.0f;
+  }
+
+  unsigned int found_count = 0;
+  start_time = Test_Helper::GetTime();
+  for (int tick = 0; tick < tick_count; tick++) {
+    AABB const &block = blocks[tick];
+    AABB last_block = AABB::FromFixedPixels(block.left - 8 * Fixed_Pixel_Helper::ONE_PIXEL,
+                                            block.right - 8 * Fixed_Pixel_Helper::ONE_PIXEL,
+                                            block.bottom + 6 * Fixed_Pixel_Helper::ONE_PIXEL,
+                                            block.top + 6 * Fixed_Pixel_Helper::ONE_PIXEL);
+    AABB swept_block = block.Union(last_block);
+    found_count += static_cast<unsigned int>(grid.Query(swept_block, Tile_Bitmap::WALL).size());
+    found_count += static_cast<unsigned int>(grid.Query(swept_block, Tile_Bitmap::FLOOR).size());
+    AABB floor_bounds;
+    if (grid.FindTouchingBounds(block, Tile_Bitmap::FLOOR, &floor_bounds)) {
+      found_count++;
+    }
+  }
+  double tick_us = Test_Helper::GetMillisecondsSince(start_time) * 1000.0 / tick_count;
+
+  std::stringstream description;
+  description << columns * rows << " tiles, grid build";
+  Test_Helper::Report(description.str(), build_ms, "ms");
+  description.str("");
+  description << columns * rows << " tiles, collision queries per tick";
+  Test_Helper::Report(description.str(), tick_us, "us");
+  Test_Helper::Check(found_count > 0, "Benchmark queries find tiles");
+
+  grid.Clear();
+  Test_Helper::DeleteTiles(&tiles);
+  return tick_us;
+}
+
+//------------------------------------------------------------------------------
+Tile_Bitmap * Tile_Grid_Test::CreateTile(float left, float top, float size, unsigned int class_mask) {
+  Tile_Bitmap *tile = new Tile_Bitmap();
+  tile->SetSize(size, size);
+  tile->SetPosition(left + (size / 2), top - (size / 2), 0);
+  tile->SetClass(class_mask, true);
+  return tile;
+}
+
+//------------------------------------------------------------------------------
+AABB Tile_Grid_Test::GetTileBounds(Tile_Bitmap *tile) {
+  return AABB::FromCentre(tile->GetFixedPosition(), tile->GetSize());
+}
+
+//------------------------------------------------------------------------------
+AABB Tile_Grid_Test::GetRandomArea(std::vector<Tile_Bitmap*> const &tiles) {
+  Fixed_Pixel width = (1 + rand() % 400) * Fixed_Pixel_Helper::ONE_PIXEL / 4;
+  Fixed_Pixel height = (1 + rand() % 400) * Fixed_Pixel_Helper::ONE_PIXEL / 4;
+  if (rand() % 4 == 0) {
+    // Only touching the right or top edge of a tile
+    AABB tile = GetTileBounds(tiles[static_cast<unsigned int>(rand()) % tiles.size()]);
+    if (rand() % 2 == 0) {
+      return AABB::FromFixedPixels(tile.right, tile.right + width, tile.top - height, tile.top);
+    }
+    return AABB::FromFixedPixels(tile.right - width, tile.right, tile.top, tile.top + height);
+  }
+  Fixed_Pixel left = Fixed_Pixel_Helper::FromPixels(static_cast<float>(rand() % 17000) / 4.0f - 2200.0f);
+  Fixed_Pixel bottom = Fixed_Pixel_Helper::FromPixels(static_cast<float>(rand() % 17000) / 4.0f - 2200.0f);
+  return AABB::FromFixedPixels(left, left + width, bottom, bottom + height);
+}
+
+//------------------------------------------------------------------------------
+unsigned int Tile_Grid_Test::CountMismatchedQueries(Tile_Grid *grid, std::vector<Tile_Bitmap*> const &tiles, std::vector<AABB> const &areas) {
+  unsigned int class_masks[] = {Tile_Bitmap::FLOOR, Tile_Bitmap::WALL, Tile_Bitmap::FLOOR | Tile_Bitmap::ROOF, Tile_Bitmap::EXIT};
+  unsigned int mismatch_count = 0;
+  std::vector<AABB>::const_iterator area;
+  for (area = areas.begin(); area != areas.end(); area++) {
+    bool is_matching = (grid->Query(*area) == ScanTiles(tiles, *area, 0, false));
+    for (unsigned int index = 0; index < 4; index++) {
+      unsigned int class_mask = class_masks[index];
+      is_matching = is_matching && (grid->Query(*area, class_mask) == ScanTiles(tiles, *area, class_mask, true));
+
+      AABB grid_bounds;
+      AABB scan_bounds;
+      bool is_grid_touching = grid->FindTouchingBounds(*area, class_mask, &grid_bounds);
+      bool is_scan_touching = ScanTouchingBounds(tiles, *area, class_mask, &scan_bounds);
+      is_matching = is_matching && (is_grid_touching == is_scan_touching);
+      if (is_grid_touching && is_scan_touching) {
+        is_matching = is_matching && (grid_bounds.left == scan_bounds.left &&
+                                      grid_bounds.right == scan_bounds.right &&
+                                      grid_bounds.bottom == scan_bounds.bottom &&
+                                      grid_bounds.top == scan_bounds.top);
+      }
+    }
+    if (!is_matching) {
+      mismatch_count++;
+    }
+  }
+  return mismatch_count;
+}
+
+//------------------------------------------------------------------------------
+std::vector<Tile_Bitmap*> Tile_Grid_Test::ScanTiles(std::vector<Tile_Bitmap*> const &tiles, AABB const &area, unsigned int class_mask, bool is_class_filtered) {
+  std::vector<Tile_Bitmap*> touching_tiles;
+  std::vector<Tile_Bitmap*>::const_iterator tile;
+  for (tile = tiles.begin(); tile != tiles.end(); tile++) {
+    if (is_class_filtered && !(*tile)->IsAnyOf(class_mask)) {
+      continue;
+    }
+    if (GetTileBounds(*tile).IsTouching(area)) {
+      touching_tiles.push_back(*tile);
+    }
+  }
+  return touching_tiles;
+}
+
+//------------------------------------------------------------------------------
+bool Tile_Grid_Test::ScanTouchingBounds(std::vector<Tile_Bitmap*> const &tiles, AABB const &area, unsigned int class_mask, AABB *out_bounds) {
+  std::vector<Tile_Bitmap*> touching_tiles = ScanTiles(tiles, area, class_mask, true);
+  if (touching_tiles.empty()) {
+    return false;
+  }
+  *out_bounds = GetTileBounds(touching_tiles[0]);
+  std::vector<Tile_Bitmap*>::iterator tile;
+  for (tile = touching_tiles.begin(); tile != touching_tiles.end(); tile++) {
+    *out_bounds = out_bounds->Union(GetTileBounds(*tile));
+  }
+  return true;
+}
+
+}  // namespace Tunnelour